@@ -0,0 +1,268 @@
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "simd/Simd.hpp"
+
+namespace math
+{
+
+namespace detail
+{
+
+constexpr double PI      = 3.141592653589793116;
+constexpr double HALF_PI = 1.570796326794896558;
+
+//pi / 2 split in a part with a short mantissa and the rest, so k * HALF_PI_HI 
+//is exact for the quadrant counts used here (Cody-Waite reduction)
+constexpr double HALF_PI_HI = 1.57079632673412561417;
+constexpr double HALF_PI_LO = 6.07710050650619224932e-11;
+
+constexpr bool SignBit(double value)
+{
+    return (std::bit_cast<uint64_t>(value) >> 63) != 0;
+}
+
+constexpr double ConstSqrt(double value)
+{
+    if(value != value || value < 0)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    if(value == 0 || value == std::numeric_limits<double>::infinity())
+    {
+        return value;
+    }
+
+    //Halving the exponent gives a guess within a factor of ~1.5, Newton-Raphson 
+    //then doubles the correct bits each step
+    double result = std::bit_cast<double>((std::bit_cast<uint64_t>(value) >> 1) + 0x1FF8000000000000ull);
+
+    for(int32_t i = 0; i < 6; ++i)
+    {
+        result = 0.5 * (result + value / result);
+    }
+
+    return result;
+}
+
+//Taylor series on [-pi / 4, pi / 4], the last term is below 2^-60
+constexpr double SinKernel(double x)
+{
+    double x2 = x * x;
+    return x * (1 + x2 * (-1.0 / 6 + x2 * (1.0 / 120 + x2 * (-1.0 / 5040 + x2 * (1.0 / 362880 + 
+        x2 * (-1.0 / 39916800 + x2 * (1.0 / 6227020800 + x2 * (-1.0 / 1307674368000))))))));
+}
+
+constexpr double CosKernel(double x)
+{
+    double x2 = x * x;
+    return 1 + x2 * (-1.0 / 2 + x2 * (1.0 / 24 + x2 * (-1.0 / 720 + x2 * (1.0 / 40320 + 
+        x2 * (-1.0 / 3628800 + x2 * (1.0 / 479001600 + x2 * (-1.0 / 87178291200 + x2 * (1.0 / 20922789888000))))))));
+}
+
+//Reduces radians to [-pi / 4, pi / 4] and returns the quadrant in [0, 3]
+constexpr int32_t ReduceQuadrant(double radians, double& reduced)
+{
+    double  q = radians / HALF_PI;
+    int64_t k = static_cast<int64_t>(q < 0 ? q - 0.5 : q + 0.5);
+
+    reduced = (radians - k * HALF_PI_HI) - k * HALF_PI_LO;
+    return static_cast<int32_t>(k & 3);
+}
+
+constexpr double ConstSin(double radians)
+{
+    if(radians != radians || radians == std::numeric_limits<double>::infinity() || 
+       radians == -std::numeric_limits<double>::infinity())
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double  r        = 0;
+    int32_t quadrant = ReduceQuadrant(radians, r);
+
+    switch(quadrant)
+    {
+    case 0:  return SinKernel(r);
+    case 1:  return CosKernel(r);
+    case 2:  return -SinKernel(r);
+    default: return -CosKernel(r);
+    }
+}
+
+constexpr double ConstCos(double radians)
+{
+    if(radians != radians || radians == std::numeric_limits<double>::infinity() || 
+       radians == -std::numeric_limits<double>::infinity())
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double  r        = 0;
+    int32_t quadrant = ReduceQuadrant(radians, r);
+
+    switch(quadrant)
+    {
+    case 0:  return CosKernel(r);
+    case 1:  return -SinKernel(r);
+    case 2:  return -CosKernel(r);
+    default: return SinKernel(r);
+    }
+}
+
+//atan for value in [0, 1]. Values above tan(pi / 8) are moved around pi / 4 so 
+//the series argument stays under 0.42 and converges in ~20 terms
+constexpr double AtanUnit(double value)
+{
+    double offset = 0;
+
+    if(value > 0.41421356237309503)
+    {
+        value  = (value - 1) / (value + 1);
+        offset = PI / 4;
+    }
+
+    double x2     = value * value;
+    double term   = value;
+    double result = 0;
+
+    for(int32_t n = 0; n < 24; ++n)
+    {
+        result += term / (2 * n + 1);
+        term   *= -x2;
+    }
+
+    return offset + result;
+}
+
+constexpr double ConstAtan2(double y, double x)
+{
+    if(y != y || x != x)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double ay = y < 0 ? -y : y;
+    double ax = x < 0 ? -x : x;
+
+    if(ax == 0 && ay == 0)
+    {
+        return SignBit(x) ? (SignBit(y) ? -PI : PI) : y;
+    }
+
+    double angle = ay <= ax ? AtanUnit(ay / ax) : HALF_PI - AtanUnit(ax / ay);
+
+    if(SignBit(x))
+    {
+        angle = PI - angle;
+    }
+
+    return SignBit(y) ? -angle : angle;
+}
+
+} //namespace detail
+
+template<typename T>
+constexpr T FastInvSqrt(T value)
+{
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if !consteval
+        {
+            return _mm_cvtss_f32(simd::FastInvSqrt(_mm_set_ss(value)));
+        }
+    }
+#endif
+
+    return 1 / Sqrt(value);
+}
+
+template<typename T>
+constexpr T Sqrt(T value)
+{
+    if consteval
+    {
+        return static_cast<T>(detail::ConstSqrt(value));
+    }
+    else
+    {
+        return std::sqrt(value);
+    }
+}
+
+template<typename T>
+constexpr T Sin(T radians)
+{
+    if consteval
+    {
+        return static_cast<T>(detail::ConstSin(radians));
+    }
+    else
+    {
+        return std::sin(radians);
+    }
+}
+
+template<typename T>
+constexpr T Cos(T radians)
+{
+    if consteval
+    {
+        return static_cast<T>(detail::ConstCos(radians));
+    }
+    else
+    {
+        return std::cos(radians);
+    }
+}
+
+template<typename T>
+constexpr T Tan(T radians)
+{
+    if consteval
+    {
+        return static_cast<T>(detail::ConstSin(radians) / detail::ConstCos(radians));
+    }
+    else
+    {
+        return std::tan(radians);
+    }
+}
+
+template<typename T>
+constexpr T Acos(T value)
+{
+    if consteval
+    {
+        if(value < -1 || value > 1)
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+
+        double v = value;
+        return static_cast<T>(detail::ConstAtan2(detail::ConstSqrt((1 - v) * (1 + v)), v));
+    }
+    else
+    {
+        return std::acos(value);
+    }
+}
+
+template<typename T>
+constexpr T Atan2(T y, T x)
+{
+    if consteval
+    {
+        return static_cast<T>(detail::ConstAtan2(y, x));
+    }
+    else
+    {
+        return std::atan2(y, x);
+    }
+}
+
+} //namespace math
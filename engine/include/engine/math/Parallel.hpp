@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace math
+{
+
+//Worker count of the threaded kernels and scene structures, 0 is one per
+//hardware thread
+inline uint32_t ResolveThreadCount(uint32_t threadCount);
+
+//Calls func(thread, begin, end) on threadCount contiguous chunks of [0, count),
+//the first one on the calling thread. Every thread is called, the last ones
+//with empty chunks when count is smaller than threadCount
+template<typename Func>
+void ParallelFor(uint32_t threadCount, std::size_t count, const Func& func);
+
+} //namespace math
+
+#include "Parallel.inl"
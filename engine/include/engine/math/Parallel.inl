@@ -0,0 +1,38 @@
+#include <algorithm>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+namespace math
+{
+
+inline uint32_t ResolveThreadCount(uint32_t threadCount)
+{
+    if(threadCount == 0)
+    {
+        threadCount = std::thread::hardware_concurrency();
+    }
+
+    return std::max(threadCount, 1u);
+}
+
+template<typename Func>
+void ParallelFor(uint32_t threadCount, std::size_t count, const Func& func)
+{
+    assert(threadCount > 0);
+
+    std::size_t chunk = (count + threadCount - 1) / threadCount;
+    std::vector<std::jthread> threads {};
+    threads.reserve(threadCount - 1);
+
+    for(uint32_t thread = 1; thread < threadCount; ++thread)
+    {
+        std::size_t begin = std::min(chunk * thread, count);
+        std::size_t end   = std::min(begin + chunk, count);
+        threads.emplace_back(func, thread, begin, end);
+    }
+
+    func(0u, std::size_t{0}, std::min(chunk, count));
+}
+
+} //namespace math
@@ -0,0 +1,85 @@
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include "../vector/Vector3.hpp"
+#include "Support.hpp"
+
+namespace math
+{
+
+//Simplex a query ended with, as support points in the local frames of both
+//shapes. Passing the cache of a pair back on the next frame starts from the
+//same points moved by the new transforms, coherent motion then converges in
+//one or two iterations instead of rebuilding the simplex from scratch
+template<typename T>
+struct GjkCache
+{
+    Vector3<T> localA[4] {};
+    Vector3<T> localB[4] {};
+    uint32_t   count {0};
+};
+
+template<typename T>
+struct GjkResult
+{
+    //Distance between the surfaces, 0 when the shapes intersect
+    T          distance {0};
+    //Closest points on the surfaces of A and B, in world space. When the cores
+    //touch these are points of the cores instead, see ComputeDistance
+    Vector3<T> pointA {};
+    Vector3<T> pointB {};
+    //Unit direction from A to B, zero when the cores touch
+    Vector3<T> normal {};
+    uint32_t   iterations {0};
+    bool       intersecting {false};
+};
+
+template<typename T>
+struct PenetrationResult
+{
+    //Distance A has to move along -normal to separate the shapes, negative
+    //when they are already apart
+    T          depth {0};
+    //Deepest point of A inside B and of B inside A, pointA - pointB is
+    //normal * depth
+    Vector3<T> pointA {};
+    Vector3<T> pointB {};
+    //Unit direction from A to B
+    Vector3<T> normal {};
+    bool       intersecting {false};
+};
+
+template<typename A, typename B>
+concept ConvexPairConcept = ConvexShapeConcept<A> && ConvexShapeConcept<B> &&
+    std::same_as<typename A::Type, typename B::Type>;
+
+//! GJK
+//Closest points of two convex shapes placed by their transforms (Gilbert,
+//Johnson and Keerthi). The cores are queried and the radii subtracted after,
+//so spheres and capsules converge as fast as the polytopes they are built on.
+//When the cores touch or overlap there is no direction to offset the points
+//by the radii: the result is intersecting with distance 0, pointA and pointB
+//are the same point shared by both cores and the normal is zero.
+//ComputePenetration gives the direction and depth in that case
+template<typename A, typename B> requires ConvexPairConcept<A, B>
+GjkResult<typename A::Type> ComputeDistance(const A& a, const RigidTransform<typename A::Type>& transformA,
+    const B& b, const RigidTransform<typename A::Type>& transformB, GjkCache<typename A::Type>* cache = nullptr);
+
+//Stops as soon as a separating axis is found, which is usually well before
+//the closest points are
+template<typename A, typename B> requires ConvexPairConcept<A, B>
+bool Intersects(const A& a, const RigidTransform<typename A::Type>& transformA,
+    const B& b, const RigidTransform<typename A::Type>& transformB, GjkCache<typename A::Type>* cache = nullptr);
+
+//! EPA
+//Penetration depth and contact points of intersecting shapes. Overlapping
+//radii are resolved from the GJK closest points, overlapping cores with the
+//expanding polytope algorithm. Separated shapes give the GJK result with a
+//negative depth
+template<typename A, typename B> requires ConvexPairConcept<A, B>
+PenetrationResult<typename A::Type> ComputePenetration(const A& a, const RigidTransform<typename A::Type>& transformA,
+    const B& b, const RigidTransform<typename A::Type>& transformB, GjkCache<typename A::Type>* cache = nullptr);
+
+} //namespace math
+
+#include "Gjk.inl"
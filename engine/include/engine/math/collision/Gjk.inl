@@ -0,0 +1,862 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace math
+{
+
+namespace detail
+{
+
+constexpr uint32_t MaxGjkIterations = 64;
+constexpr uint32_t MaxEpaIterations = 64;
+//A closed triangulated polytope of V vertices has 2V - 4 faces and every
+//face removed from it gives back at most 3 horizon edges
+constexpr uint32_t MaxEpaVertices   = MaxEpaIterations + 4;
+constexpr uint32_t MaxEpaFaces      = 2 * MaxEpaVertices - 4;
+constexpr uint32_t MaxEpaEdges      = 3 * MaxEpaFaces;
+
+template<typename T>
+struct GjkTolerance
+{
+    //Relative improvement of the squared distance under which GJK has converged
+    static constexpr T Convergence = std::numeric_limits<T>::epsilon() * 128;
+    //Squared distance, relative to the squared size of the simplex, under
+    //which the cores touch, (64 epsilon)^2
+    static constexpr T Touching    = std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * 4096;
+    //Gap between a face and the support point along its normal, relative to
+    //the size of the polytope, under which EPA has converged
+    static constexpr T Expansion   = std::numeric_limits<T>::epsilon() * 128;
+    //Squared sine of the angle under which a point is taken as on a line or plane
+    static constexpr T Flat        = std::numeric_limits<T>::epsilon();
+};
+
+//! Minkowski difference
+template<typename T>
+struct SimplexVertex
+{
+    //pointA - pointB, a point of the Minkowski difference of the cores
+    Vector3<T> w;
+    Vector3<T> pointA;
+    Vector3<T> pointB;
+    Vector3<T> localA;
+    Vector3<T> localB;
+};
+
+//Support points of the cores of A - B. The query runs in the local frame of A
+//with B placed by the relative transform as the 3 columns of a rotation
+//matrix, which saves 3 of the 4 quaternion rotations of every support point
+template<typename A, typename B>
+struct MinkowskiDifference
+{
+    using T = typename A::Type;
+
+    MinkowskiDifference(const A& a, const RigidTransform<T>& transformA, const B& b, const RigidTransform<T>& transformB) :
+        a{a}, b{b}, axes{}, translation{transformA.InverseTransformPoint(transformB.position)}
+    {
+        Matrix4<T> m = (transformA.rotation.GetConjugated() * transformB.rotation).ToMatrix4();
+
+        for(int32_t i = 0; i < 3; ++i)
+        {
+            axes[i] = Vector3<T>(m.arr[i * 4], m.arr[i * 4 + 1], m.arr[i * 4 + 2]);
+        }
+    }
+
+    SimplexVertex<T> FromLocal(const Vector3<T>& localA, const Vector3<T>& localB) const
+    {
+        SimplexVertex<T> vertex;
+        vertex.localA = localA;
+        vertex.localB = localB;
+        vertex.pointA = localA;
+        vertex.pointB = axes[0] * localB.x + axes[1] * localB.y + axes[2] * localB.z + translation;
+        vertex.w      = vertex.pointA - vertex.pointB;
+        return vertex;
+    }
+
+    SimplexVertex<T> GetSupport(const Vector3<T>& direction) const
+    {
+        Vector3<T> directionB(-axes[0].Dot(direction), -axes[1].Dot(direction), -axes[2].Dot(direction));
+
+        return FromLocal(SupportMapping<A>::GetSupport(a, direction), SupportMapping<B>::GetSupport(b, directionB));
+    }
+
+    T GetRadius() const
+    {
+        return SupportMapping<A>::GetRadius(a) + SupportMapping<B>::GetRadius(b);
+    }
+
+    const A&   a;
+    const B&   b;
+    Vector3<T> axes[3];
+    //Position of B in the frame of A
+    Vector3<T> translation;
+};
+
+//! Simplex
+template<typename T>
+struct Simplex
+{
+    SimplexVertex<T> vertices[4];
+    //Barycentric weights of the closest point
+    T                weights[4];
+    uint32_t         count;
+    //Point of the simplex closest to the origin
+    Vector3<T>       closest;
+};
+
+//Vertices of the simplex its closest point lies on with the barycentric
+//weights of that point, kept apart from the simplex so it is only reduced
+//when the new closest point is an improvement
+template<typename T>
+struct SimplexSolution
+{
+    Vector3<T> closest;
+    T          weights[4];
+    uint32_t   indices[4];
+    uint32_t   count;
+    //The origin is inside the tetrahedron
+    bool       enclosed;
+};
+
+template<typename T>
+SimplexSolution<T> SolvePoint(const SimplexVertex<T>* vertices, uint32_t a)
+{
+    return SimplexSolution<T> { vertices[a].w, {1}, {a}, 1, false };
+}
+
+template<typename T>
+SimplexSolution<T> SolveSegment(const SimplexVertex<T>* vertices, uint32_t a, uint32_t b)
+{
+    const Vector3<T>& wa = vertices[a].w;
+    Vector3<T>        ab = vertices[b].w - wa;
+    T                 t  = -wa.Dot(ab);
+    T                 l  = ab.LengthSquared();
+
+    if(t <= 0)
+    {
+        return SolvePoint(vertices, a);
+    }
+    if(t >= l)
+    {
+        return SolvePoint(vertices, b);
+    }
+
+    t /= l;
+    return SimplexSolution<T> { wa + ab * t, {1 - t, t}, {a, b}, 2, false };
+}
+
+//Voronoi regions of the triangle (Ericson, Real-Time Collision Detection
+//5.1.5) with the query point at the origin
+template<typename T>
+SimplexSolution<T> SolveTriangle(const SimplexVertex<T>* vertices, uint32_t a, uint32_t b, uint32_t c)
+{
+    const Vector3<T>& wa = vertices[a].w;
+    const Vector3<T>& wb = vertices[b].w;
+    const Vector3<T>& wc = vertices[c].w;
+    Vector3<T>        ab = wb - wa;
+    Vector3<T>        ac = wc - wa;
+
+    T d1 = -ab.Dot(wa);
+    T d2 = -ac.Dot(wa);
+    if(d1 <= 0 && d2 <= 0)
+    {
+        return SolvePoint(vertices, a);
+    }
+
+    T d3 = -ab.Dot(wb);
+    T d4 = -ac.Dot(wb);
+    if(d3 >= 0 && d4 <= d3)
+    {
+        return SolvePoint(vertices, b);
+    }
+
+    T vc = d1 * d4 - d3 * d2;
+    if(vc <= 0 && d1 >= 0 && d3 <= 0)
+    {
+        return SolveSegment(vertices, a, b);
+    }
+
+    T d5 = -ab.Dot(wc);
+    T d6 = -ac.Dot(wc);
+    if(d6 >= 0 && d5 <= d6)
+    {
+        return SolvePoint(vertices, c);
+    }
+
+    T vb = d5 * d2 - d1 * d6;
+    if(vb <= 0 && d2 >= 0 && d6 <= 0)
+    {
+        return SolveSegment(vertices, a, c);
+    }
+
+    T va = d3 * d6 - d5 * d4;
+    if(va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+    {
+        return SolveSegment(vertices, b, c);
+    }
+
+    T sum = va + vb + vc;
+
+    //Collinear vertices, the closest point is on one of the edges
+    if(!(sum > 0))
+    {
+        SimplexSolution<T> best = SolveSegment(vertices, a, b);
+        for(const SimplexSolution<T>& edge : { SolveSegment(vertices, a, c), SolveSegment(vertices, b, c) })
+        {
+            if(edge.closest.LengthSquared() < best.closest.LengthSquared())
+            {
+                best = edge;
+            }
+        }
+        return best;
+    }
+
+    T v = vb / sum;
+    T w = vc / sum;
+    return SimplexSolution<T> { wa + ab * v + ac * w, {1 - v - w, v, w}, {a, b, c}, 3, false };
+}
+
+//Encloses the origin, or reduces to the closest of the faces the origin is in front of
+template<typename T>
+SimplexSolution<T> SolveTetrahedron(const SimplexVertex<T>* vertices)
+{
+    //Vertices of every face followed by the opposite one
+    constexpr uint32_t Faces[4][4] = { {0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0} };
+
+    SimplexSolution<T> best {};
+    T                  bestDistance = std::numeric_limits<T>::infinity();
+
+    for(const auto& face : Faces)
+    {
+        const Vector3<T>& p0 = vertices[face[0]].w;
+        Vector3<T>        e0 = vertices[face[1]].w - p0;
+        Vector3<T>        e1 = vertices[face[2]].w - p0;
+        Vector3<T>        e2 = vertices[face[3]].w - p0;
+        Vector3<T>        n  = e0.Cross(e1);
+
+        //Both on the same side, flat tetrahedra test every face
+        T origin   = -p0.Dot(n);
+        T opposite = e2.Dot(n);
+        if(origin * opposite > 0 && opposite * opposite > GjkTolerance<T>::Flat * n.LengthSquared() * e2.LengthSquared())
+        {
+            continue;
+        }
+
+        SimplexSolution<T> candidate = SolveTriangle(vertices, face[0], face[1], face[2]);
+        T                  distance  = candidate.closest.LengthSquared();
+        if(distance < bestDistance)
+        {
+            best         = candidate;
+            bestDistance = distance;
+        }
+    }
+
+    if(bestDistance < std::numeric_limits<T>::infinity())
+    {
+        return best;
+    }
+
+    //Barycentric weights from the signed volumes
+    const Vector3<T>& wa     = vertices[0].w;
+    Vector3<T>        ab     = vertices[1].w - wa;
+    Vector3<T>        ac     = vertices[2].w - wa;
+    Vector3<T>        ad     = vertices[3].w - wa;
+    T                 volume = ab.Cross(ac).Dot(ad);
+    T                 wb     = -wa.Cross(ac).Dot(ad) / volume;
+    T                 wc     = ab.Cross(-wa).Dot(ad) / volume;
+    T                 wd     = ab.Cross(ac).Dot(-wa) / volume;
+
+    return SimplexSolution<T> { Vector3<T>(0), {1 - wb - wc - wd, wb, wc, wd}, {0, 1, 2, 3}, 4, true };
+}
+
+template<typename T>
+SimplexSolution<T> SolveSimplex(const Simplex<T>& simplex)
+{
+    switch(simplex.count)
+    {
+        case 1:
+            return SolvePoint(simplex.vertices, 0);
+        case 2:
+            return SolveSegment(simplex.vertices, 0, 1);
+        case 3:
+            return SolveTriangle(simplex.vertices, 0, 1, 2);
+        default:
+            return SolveTetrahedron(simplex.vertices);
+    }
+}
+
+//Reduces the simplex to the vertices of the solution
+template<typename T>
+void ApplySolution(Simplex<T>& simplex, const SimplexSolution<T>& solution)
+{
+    SimplexVertex<T> vertices[4];
+
+    for(uint32_t i = 0; i < solution.count; ++i)
+    {
+        vertices[i] = simplex.vertices[solution.indices[i]];
+    }
+    for(uint32_t i = 0; i < solution.count; ++i)
+    {
+        simplex.vertices[i] = vertices[i];
+        simplex.weights[i]  = solution.weights[i];
+    }
+
+    simplex.count   = solution.count;
+    simplex.closest = solution.closest;
+}
+
+template<typename T>
+T GetMaxLengthSquared(const SimplexVertex<T>* vertices, uint32_t count)
+{
+    T result = 0;
+
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        result = std::max(result, vertices[i].w.LengthSquared());
+    }
+
+    return result;
+}
+
+//Closest points of the cores from the barycentric weights
+template<typename T>
+void GetClosestPoints(const Simplex<T>& simplex, Vector3<T>& pointA, Vector3<T>& pointB)
+{
+    pointA = Vector3<T>(0);
+    pointB = Vector3<T>(0);
+
+    for(uint32_t i = 0; i < simplex.count; ++i)
+    {
+        pointA += simplex.vertices[i].pointA * simplex.weights[i];
+        pointB += simplex.vertices[i].pointB * simplex.weights[i];
+    }
+}
+
+template<typename T>
+void StoreCache(const Simplex<T>& simplex, GjkCache<T>* cache)
+{
+    if(cache == nullptr)
+    {
+        return;
+    }
+
+    for(uint32_t i = 0; i < simplex.count; ++i)
+    {
+        cache->localA[i] = simplex.vertices[i].localA;
+        cache->localB[i] = simplex.vertices[i].localB;
+    }
+    cache->count = simplex.count;
+}
+
+//! GJK
+enum class GjkStatus
+{
+    //A separating axis wider than the radii was found, only with earlyOut
+    Separated,
+    //The simplex holds the closest point of the separated cores
+    Converged,
+    //The cores touch or intersect
+    Touching
+};
+
+template<typename A, typename B>
+GjkStatus RunGjk(const MinkowskiDifference<A, B>& difference, const GjkCache<typename A::Type>* cache, bool earlyOut,
+    Simplex<typename A::Type>& simplex, uint32_t& iterations)
+{
+    using T = typename A::Type;
+
+    simplex.count = 0;
+    iterations    = 0;
+
+    if(cache != nullptr)
+    {
+        for(uint32_t i = 0; i < cache->count; ++i)
+        {
+            simplex.vertices[i] = difference.FromLocal(cache->localA[i], cache->localB[i]);
+        }
+        simplex.count = cache->count;
+    }
+
+    if(simplex.count == 0)
+    {
+        Vector3<T> direction = difference.translation;
+        if(direction.LengthSquared() == 0)
+        {
+            direction = Vector3<T>(1, 0, 0);
+        }
+
+        simplex.vertices[0] = difference.GetSupport(direction);
+        simplex.count       = 1;
+    }
+
+    SimplexSolution<T> solution = SolveSimplex(simplex);
+    ApplySolution(simplex, solution);
+    if(solution.enclosed)
+    {
+        return GjkStatus::Touching;
+    }
+
+    T radius = difference.GetRadius();
+
+    for(; iterations < MaxGjkIterations; ++iterations)
+    {
+        Vector3<T> v  = simplex.closest;
+        T          vv = v.LengthSquared();
+
+        if(vv <= GjkTolerance<T>::Touching * GetMaxLengthSquared(simplex.vertices, simplex.count))
+        {
+            return GjkStatus::Touching;
+        }
+
+        SimplexVertex<T> vertex = difference.GetSupport(-v);
+        T                vw     = v.Dot(vertex.w);
+
+        //Every point of the difference is further than the radii along v
+        if(earlyOut && vw > 0 && vw * vw > vv * radius * radius)
+        {
+            return GjkStatus::Separated;
+        }
+
+        if(vv - vw <= GjkTolerance<T>::Convergence * vv)
+        {
+            return GjkStatus::Converged;
+        }
+
+        for(uint32_t i = 0; i < simplex.count; ++i)
+        {
+            if(simplex.vertices[i].w == vertex.w)
+            {
+                return GjkStatus::Converged;
+            }
+        }
+
+        simplex.vertices[simplex.count++] = vertex;
+        solution = SolveSimplex(simplex);
+
+        //Rounding stopped the progress, keep the previous simplex
+        if(!solution.enclosed && solution.closest.LengthSquared() >= vv)
+        {
+            --simplex.count;
+            return GjkStatus::Converged;
+        }
+
+        ApplySolution(simplex, solution);
+        if(solution.enclosed)
+        {
+            return GjkStatus::Touching;
+        }
+    }
+
+    return GjkStatus::Converged;
+}
+
+//! EPA
+template<typename T>
+struct EpaFace
+{
+    uint32_t   vertices[3];
+    //Outward unit normal and distance of the plane from the origin
+    Vector3<T> normal;
+    T          distance;
+};
+
+template<typename T>
+struct EpaResult
+{
+    Vector3<T> normal;
+    T          depth;
+    Vector3<T> pointA;
+    Vector3<T> pointB;
+};
+
+template<typename T>
+EpaFace<T> CreateEpaFace(const SimplexVertex<T>* vertices, uint32_t i0, uint32_t i1, uint32_t i2)
+{
+    EpaFace<T> face { {i0, i1, i2}, Vector3<T>(0), std::numeric_limits<T>::infinity() };
+    Vector3<T> n      = (vertices[i1].w - vertices[i0].w).Cross(vertices[i2].w - vertices[i0].w);
+    T          length = n.Length();
+
+    //Degenerate faces are never expanded
+    if(length > 0)
+    {
+        face.normal   = n / length;
+        face.distance = face.normal.Dot(vertices[i0].w);
+    }
+
+    return face;
+}
+
+//Any direction perpendicular to d, crossed with the axis d is the least aligned with
+template<typename T>
+Vector3<T> GetPerpendicular(const Vector3<T>& d)
+{
+    int32_t axis = std::abs(d.x) < std::abs(d.y) ? (std::abs(d.x) < std::abs(d.z) ? 0 : 2) :
+        (std::abs(d.y) < std::abs(d.z) ? 1 : 2);
+    Vector3<T> unit(0);
+    unit[axis] = 1;
+
+    return d.Cross(unit);
+}
+
+//Adds support points until the simplex GJK ended with is a tetrahedron,
+//returns false when the difference is flat
+template<typename A, typename B>
+bool BuildTetrahedron(const MinkowskiDifference<A, B>& difference, SimplexVertex<typename A::Type>* vertices,
+    uint32_t& count)
+{
+    using T = typename A::Type;
+
+    T tolerance = GjkTolerance<T>::Touching * std::max(GetMaxLengthSquared(vertices, count), T(1));
+    T flat      = GjkTolerance<T>::Flat;
+
+    if(count == 1)
+    {
+        const Vector3<T> axes[6] = { Vector3<T>(1, 0, 0), Vector3<T>(-1, 0, 0), Vector3<T>(0, 1, 0),
+            Vector3<T>(0, -1, 0), Vector3<T>(0, 0, 1), Vector3<T>(0, 0, -1) };
+
+        for(const Vector3<T>& axis : axes)
+        {
+            vertices[1] = difference.GetSupport(axis);
+            if((vertices[1].w - vertices[0].w).LengthSquared() > tolerance)
+            {
+                count = 2;
+                break;
+            }
+        }
+    }
+
+    if(count == 2)
+    {
+        Vector3<T> d  = vertices[1].w - vertices[0].w;
+        Vector3<T> n0 = GetPerpendicular(d);
+        Vector3<T> n1 = d.Cross(n0);
+        const Vector3<T> directions[4] = { n0, -n0, n1, -n1 };
+
+        for(const Vector3<T>& direction : directions)
+        {
+            vertices[2]  = difference.GetSupport(direction);
+            Vector3<T> e = vertices[2].w - vertices[0].w;
+            if(e.Cross(d).LengthSquared() > flat * e.LengthSquared() * d.LengthSquared())
+            {
+                count = 3;
+                break;
+            }
+        }
+    }
+
+    if(count == 3)
+    {
+        Vector3<T> n = (vertices[1].w - vertices[0].w).Cross(vertices[2].w - vertices[0].w);
+        T          l = n.LengthSquared();
+
+        for(const Vector3<T>& direction : { n, -n })
+        {
+            vertices[3]  = difference.GetSupport(direction);
+            Vector3<T> e = vertices[3].w - vertices[0].w;
+            T height     = n.Dot(e);
+            if(height * height > flat * l * e.LengthSquared())
+            {
+                count = 4;
+                break;
+            }
+        }
+    }
+
+    return count == 4;
+}
+
+template<typename A, typename B>
+EpaResult<typename A::Type> RunEpa(const MinkowskiDifference<A, B>& difference, const Simplex<typename A::Type>& simplex)
+{
+    using T = typename A::Type;
+
+    SimplexVertex<T> vertices[MaxEpaVertices];
+    EpaFace<T>       faces[MaxEpaFaces];
+    uint32_t         edges[MaxEpaEdges][2];
+    uint32_t         vertexCount = simplex.count;
+    uint32_t         faceCount   = 0;
+
+    std::copy(simplex.vertices, simplex.vertices + simplex.count, vertices);
+
+    EpaResult<T> result { Vector3<T>(0, 1, 0), 0, Vector3<T>(0), Vector3<T>(0) };
+
+    if(!BuildTetrahedron(difference, vertices, vertexCount))
+    {
+        //No volume, the cores only touch. Any direction out of the flat
+        //difference separates them by the radii
+        if(vertexCount == 3)
+        {
+            result.normal = (vertices[1].w - vertices[0].w).Cross(vertices[2].w - vertices[0].w).GetNormalized();
+        }
+        else if(vertexCount == 2)
+        {
+            result.normal = GetPerpendicular(vertices[1].w - vertices[0].w).GetNormalized();
+        }
+        GetClosestPoints(simplex, result.pointA, result.pointB);
+        return result;
+    }
+
+    //Wind the faces outwards
+    if((vertices[1].w - vertices[0].w).Cross(vertices[2].w - vertices[0].w).Dot(vertices[3].w - vertices[0].w) > 0)
+    {
+        std::swap(vertices[1], vertices[2]);
+    }
+    faces[faceCount++] = CreateEpaFace(vertices, 0, 1, 2);
+    faces[faceCount++] = CreateEpaFace(vertices, 0, 3, 1);
+    faces[faceCount++] = CreateEpaFace(vertices, 0, 2, 3);
+    faces[faceCount++] = CreateEpaFace(vertices, 1, 3, 2);
+
+    T          tolerance = GjkTolerance<T>::Expansion * std::sqrt(GetMaxLengthSquared(vertices, vertexCount));
+    EpaFace<T> closest   = faces[0];
+
+    //Adds the edges of a removed face, they cancel against the opposite edges
+    //of faces removed before so the list ends up holding the horizon
+    uint32_t edgeCount = 0;
+    auto     addEdges  = [&](const EpaFace<T>& face)
+    {
+        for(uint32_t e = 0; e < 3; ++e)
+        {
+            uint32_t from = face.vertices[e];
+            uint32_t to   = face.vertices[(e + 1) % 3];
+            uint32_t twin = 0;
+
+            while(twin < edgeCount && !(edges[twin][0] == to && edges[twin][1] == from))
+            {
+                ++twin;
+            }
+
+            if(twin < edgeCount)
+            {
+                edges[twin][0] = edges[edgeCount - 1][0];
+                edges[twin][1] = edges[edgeCount - 1][1];
+                --edgeCount;
+            }
+            else
+            {
+                edges[edgeCount][0] = from;
+                edges[edgeCount][1] = to;
+                ++edgeCount;
+            }
+        }
+    };
+
+    auto isAdjacent = [&](const EpaFace<T>& face)
+    {
+        for(uint32_t e = 0; e < 3; ++e)
+        {
+            uint32_t from = face.vertices[e];
+            uint32_t to   = face.vertices[(e + 1) % 3];
+            for(uint32_t h = 0; h < edgeCount; ++h)
+            {
+                if(edges[h][0] == to && edges[h][1] == from)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    for(uint32_t iteration = 0; iteration < MaxEpaIterations; ++iteration)
+    {
+        const EpaFace<T>* nearest = std::min_element(faces, faces + faceCount, [](const EpaFace<T>& a, const EpaFace<T>& b)
+        {
+            return a.distance < b.distance;
+        });
+        closest = *nearest;
+
+        SimplexVertex<T> vertex = difference.GetSupport(closest.normal);
+        if(closest.normal.Dot(vertex.w) - closest.distance <= tolerance || vertexCount == MaxEpaVertices)
+        {
+            break;
+        }
+
+        //Removes the closest face and grows the hole over the neighbouring
+        //faces the new vertex sees. The differences of polytopes have many
+        //coplanar points, removing every face that sees the vertex would let
+        //rounding pick one of them apart from the hole and pinch the horizon
+        //into several loops. The first removedCount entries of visible are
+        //the faces of the hole
+        uint32_t visible[MaxEpaFaces];
+        uint32_t visibleCount = 0;
+        uint32_t removedCount = 1;
+
+        visible[visibleCount++] = static_cast<uint32_t>(nearest - faces);
+        for(uint32_t f = 0; f < faceCount; ++f)
+        {
+            if(&faces[f] != nearest && faces[f].normal.Dot(vertex.w - vertices[faces[f].vertices[0]].w) > 0)
+            {
+                visible[visibleCount++] = f;
+            }
+        }
+
+        edgeCount = 0;
+        addEdges(*nearest);
+        for(bool grown = true; grown;)
+        {
+            grown = false;
+            for(uint32_t i = removedCount; i < visibleCount; ++i)
+            {
+                if(isAdjacent(faces[visible[i]]))
+                {
+                    addEdges(faces[visible[i]]);
+                    std::swap(visible[i], visible[removedCount++]);
+                    grown = true;
+                }
+            }
+        }
+
+        //From the back so no face is moved before it is removed
+        std::sort(visible, visible + removedCount, std::greater<uint32_t>());
+        for(uint32_t i = 0; i < removedCount; ++i)
+        {
+            faces[visible[i]] = faces[--faceCount];
+        }
+
+        //Only reachable when rounding broke the horizon, stop with the last closest face
+        if(faceCount + edgeCount > MaxEpaFaces || edgeCount < 3)
+        {
+            break;
+        }
+
+        vertices[vertexCount] = vertex;
+        for(uint32_t e = 0; e < edgeCount; ++e)
+        {
+            faces[faceCount++] = CreateEpaFace(vertices, edges[e][0], edges[e][1], vertexCount);
+        }
+        ++vertexCount;
+    }
+
+    //Barycentric coordinates of the origin projected on the closest face
+    const SimplexVertex<T>& a = vertices[closest.vertices[0]];
+    const SimplexVertex<T>& b = vertices[closest.vertices[1]];
+    const SimplexVertex<T>& c = vertices[closest.vertices[2]];
+
+    Vector3<T> e0    = b.w - a.w;
+    Vector3<T> e1    = c.w - a.w;
+    Vector3<T> e2    = closest.normal * closest.distance - a.w;
+    T          d00   = e0.Dot(e0);
+    T          d01   = e0.Dot(e1);
+    T          d11   = e1.Dot(e1);
+    T          d20   = e2.Dot(e0);
+    T          d21   = e2.Dot(e1);
+    T          denom = d00 * d11 - d01 * d01;
+    T          v     = denom > 0 ? (d11 * d20 - d01 * d21) / denom : 0;
+    T          w     = denom > 0 ? (d00 * d21 - d01 * d20) / denom : 0;
+    T          u     = 1 - v - w;
+
+    result.normal = closest.normal;
+    result.depth  = std::max(closest.distance, T(0));
+    result.pointA = a.pointA * u + b.pointA * v + c.pointA * w;
+    result.pointB = a.pointB * u + b.pointB * v + c.pointB * w;
+    return result;
+}
+
+} //namespace detail
+
+//! GJK
+template<typename A, typename B> requires ConvexPairConcept<A, B>
+GjkResult<typename A::Type> ComputeDistance(const A& a, const RigidTransform<typename A::Type>& transformA,
+    const B& b, const RigidTransform<typename A::Type>& transformB, GjkCache<typename A::Type>* cache)
+{
+    using T = typename A::Type;
+
+    detail::MinkowskiDifference<A, B> difference { a, transformA, b, transformB };
+    detail::Simplex<T>                simplex;
+    GjkResult<T>                      result;
+
+    detail::GjkStatus status = detail::RunGjk(difference, cache, false, simplex, result.iterations);
+    detail::StoreCache(simplex, cache);
+
+    Vector3<T> coreA, coreB;
+    detail::GetClosestPoints(simplex, coreA, coreB);
+
+    if(status == detail::GjkStatus::Touching)
+    {
+        result.pointA       = transformA.TransformPoint(coreA);
+        result.pointB       = transformA.TransformPoint(coreB);
+        result.intersecting = true;
+        return result;
+    }
+
+    T          coreDistance = simplex.closest.Length();
+    Vector3<T> normal       = -simplex.closest / coreDistance;
+    result.normal           = transformA.TransformDirection(normal);
+    result.pointA           = transformA.TransformPoint(coreA + normal * SupportMapping<A>::GetRadius(a));
+    result.pointB           = transformA.TransformPoint(coreB - normal * SupportMapping<B>::GetRadius(b));
+
+    T distance          = coreDistance - difference.GetRadius();
+    result.intersecting = distance <= 0;
+    result.distance     = std::max(distance, T(0));
+    return result;
+}
+
+template<typename A, typename B> requires ConvexPairConcept<A, B>
+bool Intersects(const A& a, const RigidTransform<typename A::Type>& transformA,
+    const B& b, const RigidTransform<typename A::Type>& transformB, GjkCache<typename A::Type>* cache)
+{
+    using T = typename A::Type;
+
+    detail::MinkowskiDifference<A, B> difference { a, transformA, b, transformB };
+    detail::Simplex<T>                simplex;
+    uint32_t                          iterations;
+
+    detail::GjkStatus status = detail::RunGjk(difference, cache, true, simplex, iterations);
+    detail::StoreCache(simplex, cache);
+
+    if(status != detail::GjkStatus::Converged)
+    {
+        return status == detail::GjkStatus::Touching;
+    }
+
+    T radius = difference.GetRadius();
+    return simplex.closest.LengthSquared() <= radius * radius;
+}
+
+//! EPA
+template<typename A, typename B> requires ConvexPairConcept<A, B>
+PenetrationResult<typename A::Type> ComputePenetration(const A& a, const RigidTransform<typename A::Type>& transformA,
+    const B& b, const RigidTransform<typename A::Type>& transformB, GjkCache<typename A::Type>* cache)
+{
+    using T = typename A::Type;
+
+    detail::MinkowskiDifference<A, B> difference { a, transformA, b, transformB };
+    detail::Simplex<T>                simplex;
+    PenetrationResult<T>              result;
+    uint32_t                          iterations;
+
+    detail::GjkStatus status = detail::RunGjk(difference, cache, false, simplex, iterations);
+    detail::StoreCache(simplex, cache);
+
+    T          radiusA = SupportMapping<A>::GetRadius(a);
+    T          radiusB = SupportMapping<B>::GetRadius(b);
+    Vector3<T> normal, coreA, coreB;
+    T          coreDepth;
+
+    if(status == detail::GjkStatus::Touching)
+    {
+        detail::EpaResult<T> epa = detail::RunEpa(difference, simplex);
+        normal                   = epa.normal;
+        coreA                    = epa.pointA;
+        coreB                    = epa.pointB;
+        coreDepth                = epa.depth;
+    }
+    else
+    {
+        T coreDistance = simplex.closest.Length();
+        normal         = -simplex.closest / coreDistance;
+        coreDepth      = -coreDistance;
+        detail::GetClosestPoints(simplex, coreA, coreB);
+    }
+
+    result.depth        = coreDepth + radiusA + radiusB;
+    result.normal       = transformA.TransformDirection(normal);
+    result.pointA       = transformA.TransformPoint(coreA + normal * radiusA);
+    result.pointB       = transformA.TransformPoint(coreB - normal * radiusB);
+    result.intersecting = result.depth >= 0;
+    return result;
+}
+
+} //namespace math
@@ -0,0 +1,95 @@
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include "../vector/Vector3.hpp"
+#include "../quat/Quaternion.hpp"
+#include "../geometry/AABB.hpp"
+#include "../geometry/OBB.hpp"
+#include "../geometry/Sphere.hpp"
+#include "../geometry/Capsule.hpp"
+#include "../geometry/ConvexHull.hpp"
+
+namespace math
+{
+
+//Rotation followed by a translation, places a shape given in its local frame
+template<typename T>
+struct RigidTransform
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr RigidTransform();
+    constexpr RigidTransform(const Vector3<T>& position, const Quaternion<T>& rotation = Quaternion<T>(0, 0, 0, 1));
+
+    //! Operations
+    Vector3<T> TransformPoint(const Vector3<T>& point) const;
+    Vector3<T> TransformDirection(const Vector3<T>& direction) const;
+    Vector3<T> InverseTransformPoint(const Vector3<T>& point) const;
+    Vector3<T> InverseTransformDirection(const Vector3<T>& direction) const;
+
+public:
+    Vector3<T>    position;
+    Quaternion<T> rotation;
+};
+template struct RigidTransform<float>;
+template struct RigidTransform<double>;
+
+using RigidTransform3  = RigidTransform<float>;
+using RigidTransform3d = RigidTransform<double>;
+
+//Support mappings used by the GJK and EPA queries of collision/Gjk.hpp. Every
+//shape is split into a core, whose support point is the point of the shape
+//furthest along a direction, and a radius the core is inflated by. Spheres
+//and capsules are a point and a segment with a radius, so the queries only
+//iterate on polytopes and add the radii at the end. Directions do not need
+//to be normalised
+template<typename Shape>
+struct SupportMapping;
+
+template<typename T>
+struct SupportMapping<Sphere<T>>
+{
+    static constexpr Vector3<T> GetSupport(const Sphere<T>& sphere, const Vector3<T>& direction);
+    static constexpr T          GetRadius(const Sphere<T>& sphere)  { return sphere.radius; }
+};
+
+template<typename T>
+struct SupportMapping<Capsule<T>>
+{
+    static constexpr Vector3<T> GetSupport(const Capsule<T>& capsule, const Vector3<T>& direction);
+    static constexpr T          GetRadius(const Capsule<T>& capsule) { return capsule.radius; }
+};
+
+template<typename T>
+struct SupportMapping<AABB<T>>
+{
+    static constexpr Vector3<T> GetSupport(const AABB<T>& box, const Vector3<T>& direction);
+    static constexpr T          GetRadius(const AABB<T>&)            { return 0; }
+};
+
+template<typename T>
+struct SupportMapping<OBB<T>>
+{
+    static constexpr Vector3<T> GetSupport(const OBB<T>& box, const Vector3<T>& direction);
+    static constexpr T          GetRadius(const OBB<T>&)             { return 0; }
+};
+
+template<typename T>
+struct SupportMapping<ConvexHull<T>>
+{
+    static Vector3<T>  GetSupport(const ConvexHull<T>& hull, const Vector3<T>& direction);
+    static constexpr T GetRadius(const ConvexHull<T>& hull)          { return hull.radius; }
+};
+
+template<typename Shape>
+concept ConvexShapeConcept = requires(const Shape& shape, const Vector3<typename Shape::Type>& direction)
+{
+    { SupportMapping<Shape>::GetSupport(shape, direction) } -> std::same_as<Vector3<typename Shape::Type>>;
+    { SupportMapping<Shape>::GetRadius(shape) } -> std::same_as<typename Shape::Type>;
+};
+
+} //namespace math
+
+#include "Support.inl"
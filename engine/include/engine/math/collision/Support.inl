@@ -0,0 +1,79 @@
+#include "../operations.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr RigidTransform<T>::RigidTransform() : position{}, rotation{0, 0, 0, 1} { }
+
+template<typename T>
+constexpr RigidTransform<T>::RigidTransform(const Vector3<T>& position, const Quaternion<T>& rotation) :
+    position{position}, rotation{rotation} { }
+
+//! Operations
+template<typename T>
+Vector3<T> RigidTransform<T>::TransformPoint(const Vector3<T>& point) const
+{
+    return rotation * point + position;
+}
+
+template<typename T>
+Vector3<T> RigidTransform<T>::TransformDirection(const Vector3<T>& direction) const
+{
+    return rotation * direction;
+}
+
+template<typename T>
+Vector3<T> RigidTransform<T>::InverseTransformPoint(const Vector3<T>& point) const
+{
+    return rotation.GetConjugated() * (point - position);
+}
+
+template<typename T>
+Vector3<T> RigidTransform<T>::InverseTransformDirection(const Vector3<T>& direction) const
+{
+    return rotation.GetConjugated() * direction;
+}
+
+//! Support mappings
+template<typename T>
+constexpr Vector3<T> SupportMapping<Sphere<T>>::GetSupport(const Sphere<T>& sphere, const Vector3<T>&)
+{
+    return sphere.center;
+}
+
+template<typename T>
+constexpr Vector3<T> SupportMapping<Capsule<T>>::GetSupport(const Capsule<T>& capsule, const Vector3<T>& direction)
+{
+    return (capsule.b - capsule.a).Dot(direction) > 0 ? capsule.b : capsule.a;
+}
+
+template<typename T>
+constexpr Vector3<T> SupportMapping<AABB<T>>::GetSupport(const AABB<T>& box, const Vector3<T>& direction)
+{
+    return Vector3<T>(direction.x > 0 ? box.max.x : box.min.x,
+        direction.y > 0 ? box.max.y : box.min.y,
+        direction.z > 0 ? box.max.z : box.min.z);
+}
+
+template<typename T>
+constexpr Vector3<T> SupportMapping<OBB<T>>::GetSupport(const OBB<T>& box, const Vector3<T>& direction)
+{
+    Vector3<T> result = box.center;
+
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        result += box.axes[i] * (box.axes[i].Dot(direction) > 0 ? box.extents[i] : -box.extents[i]);
+    }
+
+    return result;
+}
+
+template<typename T>
+Vector3<T> SupportMapping<ConvexHull<T>>::GetSupport(const ConvexHull<T>& hull, const Vector3<T>& direction)
+{
+    return hull.points[hull.GetSupportIndex(direction)];
+}
+
+} //namespace math
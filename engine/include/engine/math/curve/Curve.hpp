@@ -0,0 +1,112 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "../quat/Quaternion.hpp"
+#include "../simd/AlignedAllocator.hpp"
+
+namespace math
+{
+
+//Piecewise cubic curve over Vector2, Vector3 or Quaternion values. Every form
+//is stored as the power basis coefficients of its segments, so Bezier,
+//Catmull-Rom and Hermite curves evaluate the same way. The parameter u in
+//[0, 1] covers all segments evenly and is clamped.
+//Rotation curves interpolate the 4 components and normalise the result, which
+//is smooth but does not rotate at constant angular speed. Vector curves keep
+//a table of parameters at uniform distances for constant speed travel, built
+//from arcLengthSamples intervals per segment. The default keeps the speed
+//within 0.1% on smooth paths, but near cusps where a segment almost stops the
+//error reaches tens of percent and only falls slowly with more samples
+template<typename V>
+struct Curve
+{
+public:
+    using Value = V;
+    using Type  = typename V::Type;
+    using Array = std::vector<Type, simd::AlignedAllocator<Type>>;
+    constexpr static bool     IsRotation              = std::is_same_v<V, Quaternion<Type>>;
+    //Arc length table intervals per segment unless given to the Create functions
+    constexpr static uint32_t DefaultArcLengthSamples = 64;
+    //Parameter samples per segment searched for closest points
+    constexpr static uint32_t ClosestPointSamples     = 16;
+
+    //! Constructors
+    Curve();
+    //Cubic Bezier segments sharing their end points, 3 * n + 1 control points
+    static Curve CreateBezier(std::span<const V> points, uint32_t arcLengthSamples = DefaultArcLengthSamples);
+    //Passes through every point (at least 2) with uniform Catmull-Rom
+    //tangents, the end points mirror their neighbour
+    static Curve CreateCatmullRom(std::span<const V> points, uint32_t arcLengthSamples = DefaultArcLengthSamples);
+    //Passes through every point with the given tangents, which are derivatives
+    //with respect to the parameter of a single segment
+    static Curve CreateHermite(std::span<const V> points, std::span<const V> tangents,
+        uint32_t arcLengthSamples = DefaultArcLengthSamples);
+
+    //! Accessors
+    uint32_t GetSegmentCount() const;
+
+    //! Evaluation
+    V Evaluate(Type u) const;
+    //Derivative with respect to u
+    V EvaluateDerivative(Type u) const requires (!IsRotation);
+    //4 (SSE) or 8 (AVX2) parameters at a time for float. The output span must
+    //be at least as big as the input span
+    void Evaluate(std::span<const Type> parameters, std::span<V> output) const;
+    void EvaluateDerivatives(std::span<const Type> parameters, std::span<V> output) const requires (!IsRotation);
+
+    //! Arc length
+    Type GetLength() const requires (!IsRotation);
+    //Distances are clamped to [0, GetLength()]
+    Type GetParameterAtDistance(Type distance) const requires (!IsRotation);
+    V    EvaluateAtDistance(Type distance) const requires (!IsRotation);
+    //Batched like Evaluate, moving followers at constant speed is a matter of
+    //advancing their distances
+    void EvaluateAtDistances(std::span<const Type> distances, std::span<V> output) const requires (!IsRotation);
+
+    //! Closest point
+    //Every local minimum of ClosestPointSamples samples per segment is refined,
+    //so only dips narrower than a sample can be missed
+    Type GetClosestParameter(const V& point) const requires (!IsRotation);
+    V    GetClosestPoint(const V& point) const requires (!IsRotation);
+
+private:
+    static Curve CreateFromHermite(std::span<const V> points, std::span<const V> tangents, uint32_t arcLengthSamples);
+
+    void Locate(Type u, uint32_t& segment, Type& t) const;
+    //Order 0 is the value, 1 and 2 the derivatives with respect to u
+    template<int32_t Order>
+    V    EvaluateSegment(uint32_t segment, Type t) const;
+    Type RefineClosestParameter(const V& point, Type u, Type spacing) const requires (!IsRotation);
+    void BuildArcLengthTable(uint32_t samples) requires (!IsRotation);
+
+private:
+    //16 values per segment, see simd/CurveSimd.hpp
+    Array    m_coefficients;
+    //(parameter, slope) pairs at uniform distances, see simd/CurveSimd.hpp
+    Array    m_arcLengthTable;
+    Type     m_length;
+    uint32_t m_segmentCount;
+};
+
+template struct Curve<Vector2<float>>;
+template struct Curve<Vector2<double>>;
+template struct Curve<Vector3<float>>;
+template struct Curve<Vector3<double>>;
+template struct Curve<Quaternion<float>>;
+template struct Curve<Quaternion<double>>;
+
+using Curve2         = Curve<Vector2<float>>;
+using Curve2d        = Curve<Vector2<double>>;
+using Curve3         = Curve<Vector3<float>>;
+using Curve3d        = Curve<Vector3<double>>;
+using RotationCurve  = Curve<Quaternion<float>>;
+using RotationCurved = Curve<Quaternion<double>>;
+
+} //namespace math
+
+#include "Curve.inl"
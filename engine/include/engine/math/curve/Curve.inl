@@ -0,0 +1,507 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include "../simd/CurveSimd.hpp"
+
+namespace math
+{
+
+namespace detail
+{
+
+//Flips values onto the hemisphere of their predecessor so the components of
+//neighbouring rotations interpolate the short way. Tangents follow their point
+template<typename T>
+void AlignHemispheres(std::span<Quaternion<T>> points, std::span<Quaternion<T>> tangents)
+{
+    for(std::size_t i = 1; i < points.size(); ++i)
+    {
+        if(points[i].Dot(points[i - 1]) < 0)
+        {
+            points[i] = points[i] * static_cast<T>(-1);
+            if(!tangents.empty())
+            {
+                tangents[i] = tangents[i] * static_cast<T>(-1);
+            }
+        }
+    }
+}
+
+} //namespace detail
+
+//! Constructors
+template<typename V>
+Curve<V>::Curve() : m_coefficients{}, m_arcLengthTable{}, m_length{0}, m_segmentCount{0} { }
+
+template<typename V>
+Curve<V> Curve<V>::CreateBezier(std::span<const V> points, uint32_t arcLengthSamples)
+{
+    assert(points.size() >= 4 && (points.size() - 1) % 3 == 0 && arcLengthSamples > 0);
+
+    std::vector<V> p(points.begin(), points.end());
+    if constexpr (IsRotation)
+    {
+        detail::AlignHemispheres<Type>(p, {});
+    }
+
+    Curve curve;
+    curve.m_segmentCount = static_cast<uint32_t>((p.size() - 1) / 3);
+    curve.m_coefficients.resize(std::size_t{curve.m_segmentCount} * 16);
+
+    for(uint32_t segment = 0; segment < curve.m_segmentCount; ++segment)
+    {
+        const V* c  = p.data() + segment * 3;
+        Type* terms = curve.m_coefficients.data() + segment * 16;
+
+        for(int32_t i = 0; i < V::Size; ++i)
+        {
+            terms[i]      = c[3][i] - c[0][i] + (c[1][i] - c[2][i]) * 3;
+            terms[4 + i]  = (c[0][i] - c[1][i] * 2 + c[2][i]) * 3;
+            terms[8 + i]  = (c[1][i] - c[0][i]) * 3;
+            terms[12 + i] = c[0][i];
+        }
+    }
+
+    if constexpr (!IsRotation)
+    {
+        curve.BuildArcLengthTable(arcLengthSamples);
+    }
+    return curve;
+}
+
+template<typename V>
+Curve<V> Curve<V>::CreateCatmullRom(std::span<const V> points, uint32_t arcLengthSamples)
+{
+    assert(points.size() >= 2);
+
+    std::vector<V> p(points.begin(), points.end());
+    if constexpr (IsRotation)
+    {
+        detail::AlignHemispheres<Type>(p, {});
+    }
+
+    //m[i] = (p[i + 1] - p[i - 1]) / 2 with p[-1] = 2 * p[0] - p[1] and
+    //p[n] = 2 * p[n - 1] - p[n - 2]
+    std::size_t last = p.size() - 1;
+    std::vector<V> tangents(p.size());
+    tangents[0]    = p[1] - p[0];
+    tangents[last] = p[last] - p[last - 1];
+    for(std::size_t i = 1; i < last; ++i)
+    {
+        tangents[i] = (p[i + 1] - p[i - 1]) * static_cast<Type>(0.5);
+    }
+
+    return CreateFromHermite(p, tangents, arcLengthSamples);
+}
+
+template<typename V>
+Curve<V> Curve<V>::CreateHermite(std::span<const V> points, std::span<const V> tangents, uint32_t arcLengthSamples)
+{
+    assert(points.size() >= 2 && tangents.size() == points.size());
+
+    std::vector<V> p(points.begin(), points.end());
+    std::vector<V> m(tangents.begin(), tangents.end());
+    if constexpr (IsRotation)
+    {
+        detail::AlignHemispheres<Type>(p, m);
+    }
+
+    return CreateFromHermite(p, m, arcLengthSamples);
+}
+
+//! Accessors
+template<typename V>
+uint32_t Curve<V>::GetSegmentCount() const
+{
+    return m_segmentCount;
+}
+
+//! Evaluation
+template<typename V>
+V Curve<V>::Evaluate(Type u) const
+{
+    uint32_t segment;
+    Type t;
+    Locate(u, segment, t);
+
+    V value = EvaluateSegment<0>(segment, t);
+    if constexpr (IsRotation)
+    {
+        value = value.GetNormalized();
+    }
+    return value;
+}
+
+template<typename V>
+V Curve<V>::EvaluateDerivative(Type u) const requires (!IsRotation)
+{
+    uint32_t segment;
+    Type t;
+    Locate(u, segment, t);
+
+    return EvaluateSegment<1>(segment, t);
+}
+
+template<typename V>
+void Curve<V>::Evaluate(std::span<const Type> parameters, std::span<V> output) const
+{
+    assert(output.size() >= parameters.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<Type, float>)
+    {
+        i = simd::EvaluateCurve<V::Size, false, IsRotation>(m_coefficients.data(), m_segmentCount,
+            parameters.data(), reinterpret_cast<float*>(output.data()), parameters.size());
+    }
+#endif
+
+    for(; i < parameters.size(); ++i)
+    {
+        output[i] = Evaluate(parameters[i]);
+    }
+}
+
+template<typename V>
+void Curve<V>::EvaluateDerivatives(std::span<const Type> parameters, std::span<V> output) const requires (!IsRotation)
+{
+    assert(output.size() >= parameters.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<Type, float>)
+    {
+        i = simd::EvaluateCurve<V::Size, true, false>(m_coefficients.data(), m_segmentCount,
+            parameters.data(), reinterpret_cast<float*>(output.data()), parameters.size());
+    }
+#endif
+
+    for(; i < parameters.size(); ++i)
+    {
+        output[i] = EvaluateDerivative(parameters[i]);
+    }
+}
+
+//! Arc length
+template<typename V>
+typename Curve<V>::Type Curve<V>::GetLength() const requires (!IsRotation)
+{
+    return m_length;
+}
+
+//Cubic Hermite between the uniform distance samples of the table, like
+//simd::EvaluateCurveAtDistances
+template<typename V>
+typename Curve<V>::Type Curve<V>::GetParameterAtDistance(Type distance) const requires (!IsRotation)
+{
+    assert(m_segmentCount > 0);
+
+    std::size_t intervals = m_arcLengthTable.size() / 2 - 1;
+    Type scale            = m_length > 0 ? static_cast<Type>(intervals) / m_length : 0;
+    Type x                = std::clamp(distance, Type{0}, m_length) * scale;
+    std::size_t index     = std::min(static_cast<std::size_t>(x), intervals - 1);
+    Type f                = x - static_cast<Type>(index);
+
+    const Type* table = m_arcLengthTable.data() + index * 2;
+    Type delta        = table[2] - table[0];
+    Type c3           = (table[1] + table[3]) - delta * 2;
+    Type c2           = (delta * 3 - (table[1] + table[1])) - table[3];
+
+    return ((c3 * f + c2) * f + table[1]) * f + table[0];
+}
+
+template<typename V>
+V Curve<V>::EvaluateAtDistance(Type distance) const requires (!IsRotation)
+{
+    return Evaluate(GetParameterAtDistance(distance));
+}
+
+template<typename V>
+void Curve<V>::EvaluateAtDistances(std::span<const Type> distances, std::span<V> output) const requires (!IsRotation)
+{
+    assert(output.size() >= distances.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<Type, float>)
+    {
+        i = simd::EvaluateCurveAtDistances<V::Size>(m_coefficients.data(), m_segmentCount, m_arcLengthTable.data(),
+            static_cast<uint32_t>(m_arcLengthTable.size() / 2 - 1), m_length, distances.data(),
+            reinterpret_cast<float*>(output.data()), distances.size());
+    }
+#endif
+
+    for(; i < distances.size(); ++i)
+    {
+        output[i] = EvaluateAtDistance(distances[i]);
+    }
+}
+
+//! Closest point
+template<typename V>
+typename Curve<V>::Type Curve<V>::GetClosestParameter(const V& point) const requires (!IsRotation)
+{
+    assert(m_segmentCount > 0);
+
+    uint32_t samples  = m_segmentCount * ClosestPointSamples;
+    Type spacing      = 1 / static_cast<Type>(samples);
+    Type best         = 0;
+    Type bestDistance = std::numeric_limits<Type>::max();
+    Type previous     = std::numeric_limits<Type>::max();
+    Type current      = (EvaluateSegment<0>(0, 0) - point).LengthSquared();
+
+    //Sample i - 1 is refined once sample i shows it is a local minimum
+    for(uint32_t i = 1; i <= samples + 1; ++i)
+    {
+        Type next = std::numeric_limits<Type>::max();
+        if(i <= samples)
+        {
+            uint32_t segment = std::min(i / ClosestPointSamples, m_segmentCount - 1);
+            Type t           = static_cast<Type>(i - segment * ClosestPointSamples) / ClosestPointSamples;
+            next             = (EvaluateSegment<0>(segment, t) - point).LengthSquared();
+        }
+
+        if(current <= previous && current <= next)
+        {
+            Type sample   = static_cast<Type>(i - 1) * spacing;
+            Type u        = RefineClosestParameter(point, sample, spacing);
+            Type distance = (Evaluate(u) - point).LengthSquared();
+            if(distance > current)
+            {
+                u        = sample;
+                distance = current;
+            }
+
+            if(distance < bestDistance)
+            {
+                best         = u;
+                bestDistance = distance;
+            }
+        }
+
+        previous = current;
+        current  = next;
+    }
+
+    return best;
+}
+
+template<typename V>
+V Curve<V>::GetClosestPoint(const V& point) const requires (!IsRotation)
+{
+    return Evaluate(GetClosestParameter(point));
+}
+
+//! Private
+template<typename V>
+Curve<V> Curve<V>::CreateFromHermite(std::span<const V> points, std::span<const V> tangents, uint32_t arcLengthSamples)
+{
+    assert(arcLengthSamples > 0);
+
+    Curve curve;
+    curve.m_segmentCount = static_cast<uint32_t>(points.size() - 1);
+    curve.m_coefficients.resize(std::size_t{curve.m_segmentCount} * 16);
+
+    for(uint32_t segment = 0; segment < curve.m_segmentCount; ++segment)
+    {
+        const V* p  = points.data() + segment;
+        const V* m  = tangents.data() + segment;
+        Type* terms = curve.m_coefficients.data() + segment * 16;
+
+        for(int32_t i = 0; i < V::Size; ++i)
+        {
+            terms[i]      = (p[0][i] - p[1][i]) * 2 + m[0][i] + m[1][i];
+            terms[4 + i]  = (p[1][i] - p[0][i]) * 3 - m[0][i] * 2 - m[1][i];
+            terms[8 + i]  = m[0][i];
+            terms[12 + i] = p[0][i];
+        }
+    }
+
+    if constexpr (!IsRotation)
+    {
+        curve.BuildArcLengthTable(arcLengthSamples);
+    }
+    return curve;
+}
+
+//u = 1 ends on the last segment at t = 1, like simd::LocateSegments
+template<typename V>
+void Curve<V>::Locate(Type u, uint32_t& segment, Type& t) const
+{
+    assert(m_segmentCount > 0);
+
+    Type count  = static_cast<Type>(m_segmentCount);
+    Type scaled = std::clamp(u, Type{0}, Type{1}) * count;
+
+    segment = static_cast<uint32_t>(std::min(scaled, count - 1));
+    t       = scaled - static_cast<Type>(segment);
+}
+
+template<typename V>
+template<int32_t Order>
+V Curve<V>::EvaluateSegment(uint32_t segment, Type t) const
+{
+    const Type* terms = m_coefficients.data() + std::size_t{segment} * 16;
+    Type count        = static_cast<Type>(m_segmentCount);
+
+    V value {};
+    for(int32_t i = 0; i < V::Size; ++i)
+    {
+        Type a = terms[i];
+        Type b = terms[4 + i];
+        Type c = terms[8 + i];
+
+        if constexpr (Order == 0)
+        {
+            value[i] = ((a * t + b) * t + c) * t + terms[12 + i];
+        }
+        else if constexpr (Order == 1)
+        {
+            value[i] = ((a * 3 * t + (b + b)) * t + c) * count;
+        }
+        else
+        {
+            value[i] = (a * 6 * t + (b + b)) * (count * count);
+        }
+    }
+    return value;
+}
+
+//Newton steps on f(u) = (p(u) - point) . p'(u) within a sample of u, with
+//bisection whenever a step leaves the bracket or the curvature is negative
+template<typename V>
+typename Curve<V>::Type Curve<V>::RefineClosestParameter(const V& point, Type u, Type spacing) const
+    requires (!IsRotation)
+{
+    Type low  = std::max(u - spacing, Type{0});
+    Type high = std::min(u + spacing, Type{1});
+
+    for(int32_t iteration = 0; iteration < 16; ++iteration)
+    {
+        uint32_t segment;
+        Type t;
+        Locate(u, segment, t);
+
+        V offset   = EvaluateSegment<0>(segment, t) - point;
+        V first    = EvaluateSegment<1>(segment, t);
+        Type slope = first.Dot(first) + offset.Dot(EvaluateSegment<2>(segment, t));
+        Type value = offset.Dot(first);
+
+        if(value < 0)
+        {
+            low = u;
+        }
+        else
+        {
+            high = u;
+        }
+
+        Type next = slope > 0 ? u - value / slope : low;
+        if(!(next > low && next < high))
+        {
+            next = (low + high) * static_cast<Type>(0.5);
+        }
+
+        if(std::abs(next - u) <= std::numeric_limits<Type>::epsilon())
+        {
+            break;
+        }
+        u = next;
+    }
+
+    return u;
+}
+
+//Segment lengths come from 5 point Gauss-Legendre quadrature of the speed on
+//samples intervals per segment, which are then inverted at uniform distances
+//with a few Newton steps each
+template<typename V>
+void Curve<V>::BuildArcLengthTable(uint32_t samples) requires (!IsRotation)
+{
+    constexpr Type Nodes[5]   = { static_cast<Type>(-0.906179845938664), static_cast<Type>(-0.538469310105683), 0,
+                                  static_cast<Type>(0.538469310105683), static_cast<Type>(0.906179845938664) };
+    constexpr Type Weights[5] = { static_cast<Type>(0.236926885056189), static_cast<Type>(0.478628670499366),
+                                  static_cast<Type>(0.568888888888889), static_cast<Type>(0.478628670499366),
+                                  static_cast<Type>(0.236926885056189) };
+
+    Type count = static_cast<Type>(m_segmentCount);
+
+    //Length of segment between t0 and t1, dp/dt is dp/du / count
+    auto integrate = [&](uint32_t segment, Type t0, Type t1)
+    {
+        Type half = (t1 - t0) * static_cast<Type>(0.5);
+        Type sum  = 0;
+        for(int32_t i = 0; i < 5; ++i)
+        {
+            sum += Weights[i] * EvaluateSegment<1>(segment, (Nodes[i] + 1) * half + t0).Length();
+        }
+        return sum * half / count;
+    };
+
+    std::size_t intervals = std::size_t{m_segmentCount} * samples;
+    Type step             = 1 / static_cast<Type>(samples);
+
+    std::vector<Type> lengths(intervals + 1);
+    lengths[0] = 0;
+    for(std::size_t i = 0; i < intervals; ++i)
+    {
+        uint32_t segment = static_cast<uint32_t>(i / samples);
+        Type t0          = static_cast<Type>(i % samples) * step;
+        lengths[i + 1]   = lengths[i] + integrate(segment, t0, t0 + step);
+    }
+    m_length = lengths[intervals];
+
+    //Slopes are du/ds times the distance between samples, limited to 3 times
+    //the smaller neighbouring step so the interpolation stays monotonic even
+    //where the curve stops (Fritsch-Carlson)
+    Type spacing = m_length / static_cast<Type>(intervals);
+    m_arcLengthTable.resize((intervals + 1) * 2);
+
+    for(std::size_t k = 0, i = 0; k <= intervals; ++k)
+    {
+        Type target = m_length * static_cast<Type>(k) / static_cast<Type>(intervals);
+        while(i + 1 < intervals && lengths[i + 1] < target)
+        {
+            ++i;
+        }
+
+        uint32_t segment = static_cast<uint32_t>(i / samples);
+        Type t0          = static_cast<Type>(i % samples) * step;
+        Type range       = lengths[i + 1] - lengths[i];
+        Type t           = range > 0 ? t0 + step * std::clamp((target - lengths[i]) / range, Type{0}, Type{1}) : t0;
+
+        for(int32_t iteration = 0; iteration < 4; ++iteration)
+        {
+            Type speed = EvaluateSegment<1>(segment, t).Length() / count;
+            if(!(speed > 0))
+            {
+                break;
+            }
+
+            Type error = lengths[i] + integrate(segment, t0, t) - target;
+            t          = std::clamp(t - error / speed, t0, t0 + step);
+        }
+
+        Type speed                  = EvaluateSegment<1>(segment, t).Length();
+        m_arcLengthTable[k * 2]     = (static_cast<Type>(segment) + t) / count;
+        m_arcLengthTable[k * 2 + 1] = speed > 0 ? spacing / speed : std::numeric_limits<Type>::max();
+    }
+
+    for(std::size_t k = 0; k <= intervals; ++k)
+    {
+        Type limit = std::numeric_limits<Type>::max();
+        if(k > 0)
+        {
+            limit = std::min(limit, m_arcLengthTable[k * 2] - m_arcLengthTable[k * 2 - 2]);
+        }
+        if(k < intervals)
+        {
+            limit = std::min(limit, m_arcLengthTable[k * 2 + 2] - m_arcLengthTable[k * 2]);
+        }
+
+        m_arcLengthTable[k * 2 + 1] = std::min(m_arcLengthTable[k * 2 + 1], limit * 3);
+    }
+}
+
+} //namespace math
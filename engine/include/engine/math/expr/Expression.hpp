@@ -0,0 +1,255 @@
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "../vector/Vector4.hpp"
+#include "../matrix/Matrix2.hpp"
+#include "../matrix/Matrix3.hpp"
+#include "../matrix/Matrix4.hpp"
+
+//Opt in lazy evaluation of vector and matrix arithmetic. Wrapping an operand
+//with Lazy makes the operators that touch it build expression nodes instead
+//of values:
+//  Vec3 p = Lazy(a) + Lazy(b) * s - c;     //one pass, no temporaries
+//  Vec4 q = Lazy(proj) * view * model * x; //proj * (view * (model * x))
+//Operators between plain operands are not affected, Lazy(a) + b * s still
+//computes b * s as a temporary vector first.
+//Element wise vector expressions are computed component by component when
+//converted to a vector. A chain of square matrix products applied to a vector
+//is evaluated right to left, k matrix vector products instead of k - 1 matrix
+//products, and a chain converted to a matrix is multiplied left to right.
+//
+//Nodes keep references to their leaves so an expression has to be converted
+//in the statement that builds it, never stored with auto. The node accessors
+//are forced inline so debug builds get the fused code as well (GCC and Clang
+//honour it at -O0, MSVC needs /Ob1)
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define MATH_EXPR_INLINE [[msvc::forceinline]]
+#else
+    #define MATH_EXPR_INLINE [[gnu::always_inline]]
+#endif
+
+namespace math::expr
+{
+
+enum class Operation
+{
+    Add,
+    Subtract,
+    Multiply,
+    Divide
+};
+
+namespace detail
+{
+
+template<typename T>
+struct IsVector : std::false_type { };
+template<typename T>
+struct IsVector<Vector2<T>> : std::true_type { };
+template<typename T>
+struct IsVector<Vector3<T>> : std::true_type { };
+template<typename T>
+struct IsVector<Vector4<T>> : std::true_type { };
+
+template<typename T>
+struct IsMatrix : std::false_type { };
+template<typename T>
+struct IsMatrix<Matrix2<T>> : std::true_type { };
+template<typename T>
+struct IsMatrix<Matrix3<T>> : std::true_type { };
+template<typename T>
+struct IsMatrix<Matrix4<T>> : std::true_type { };
+
+template<typename T, int32_t N>
+struct VectorOf;
+template<typename T>
+struct VectorOf<T, 2> { using type = Vector2<T>; };
+template<typename T>
+struct VectorOf<T, 3> { using type = Vector3<T>; };
+template<typename T>
+struct VectorOf<T, 4> { using type = Vector4<T>; };
+
+//Value type of an operand, the operand itself for plain vectors and matrices
+template<typename T>
+struct ResultOf { using type = T; };
+template<typename T> requires requires { typename T::Result; }
+struct ResultOf<T> { using type = typename T::Result; };
+
+} //namespace detail
+
+template<typename T>
+concept VectorExpressionConcept = requires { requires T::IsVectorExpression; };
+
+template<typename T>
+concept MatrixExpressionConcept = requires { requires T::IsMatrixExpression; };
+
+template<typename T>
+concept VectorOperandConcept = VectorExpressionConcept<T> || detail::IsVector<T>::value;
+
+template<typename T>
+concept MatrixOperandConcept = MatrixExpressionConcept<T> || detail::IsMatrix<T>::value;
+
+//Two vector operands of the same type where at least one is an expression,
+//so the plain vector operators are never hijacked
+template<typename L, typename R>
+concept VectorPairConcept = VectorOperandConcept<L> && VectorOperandConcept<R> &&
+    (VectorExpressionConcept<L> || VectorExpressionConcept<R>) &&
+    L::Size == R::Size && std::same_as<typename L::Type, typename R::Type>;
+
+template<typename L, typename R>
+concept MatrixPairConcept = MatrixOperandConcept<L> && MatrixOperandConcept<R> &&
+    (MatrixExpressionConcept<L> || MatrixExpressionConcept<R>) &&
+    L::Size == R::Size && std::same_as<typename L::Type, typename R::Type>;
+
+template<typename M, typename V>
+concept MatrixVectorConcept = MatrixOperandConcept<M> && VectorOperandConcept<V> &&
+    (MatrixExpressionConcept<M> || VectorExpressionConcept<V>) &&
+    requires(const typename detail::ResultOf<M>::type& m, const typename detail::ResultOf<V>::type& v) { m * v; };
+
+//! Vector nodes
+template<typename V>
+struct VectorRef
+{
+public:
+    using Type   = typename V::Type;
+    using Result = V;
+    constexpr static int32_t Size               = V::Size;
+    constexpr static bool    IsVectorExpression = true;
+
+    template<std::size_t I>
+    MATH_EXPR_INLINE constexpr Type Get() const;
+    MATH_EXPR_INLINE constexpr operator Result() const;
+
+public:
+    const V& vector;
+};
+
+//Scalar broadcast to every component
+template<typename T, int32_t N>
+struct VectorScalar
+{
+public:
+    using Type   = T;
+    using Result = typename detail::VectorOf<T, N>::type;
+    constexpr static int32_t Size               = N;
+    constexpr static bool    IsVectorExpression = true;
+
+    template<std::size_t I>
+    MATH_EXPR_INLINE constexpr Type Get() const;
+    MATH_EXPR_INLINE constexpr operator Result() const;
+
+public:
+    T value;
+};
+
+template<Operation Op, typename L, typename R>
+struct VectorBinary
+{
+public:
+    using Type   = typename L::Type;
+    using Result = typename detail::VectorOf<Type, L::Size>::type;
+    constexpr static int32_t Size               = L::Size;
+    constexpr static bool    IsVectorExpression = true;
+
+    template<std::size_t I>
+    MATH_EXPR_INLINE constexpr Type Get() const;
+    MATH_EXPR_INLINE constexpr operator Result() const;
+
+public:
+    L left;
+    R right;
+};
+
+template<typename E>
+struct VectorNegate
+{
+public:
+    using Type   = typename E::Type;
+    using Result = typename E::Result;
+    constexpr static int32_t Size               = E::Size;
+    constexpr static bool    IsVectorExpression = true;
+
+    template<std::size_t I>
+    MATH_EXPR_INLINE constexpr Type Get() const;
+    MATH_EXPR_INLINE constexpr operator Result() const;
+
+public:
+    E expression;
+};
+
+//! Matrix nodes
+template<typename M>
+struct MatrixRef
+{
+public:
+    using Type   = typename M::Type;
+    using Result = M;
+    constexpr static int32_t Size               = M::Size;
+    constexpr static int32_t NumColumns         = M::NumColumns;
+    constexpr static bool    IsMatrixExpression = true;
+
+    MATH_EXPR_INLINE constexpr operator Result() const;
+
+public:
+    const M& matrix;
+};
+
+template<typename L, typename R>
+struct MatrixProduct
+{
+public:
+    using Type   = typename L::Type;
+    using Result = typename L::Result;
+    constexpr static int32_t Size               = L::Size;
+    constexpr static int32_t NumColumns         = L::NumColumns;
+    constexpr static bool    IsMatrixExpression = true;
+
+    MATH_EXPR_INLINE constexpr operator Result() const;
+
+public:
+    L left;
+    R right;
+};
+
+//! Operations
+template<typename V> requires detail::IsVector<V>::value
+MATH_EXPR_INLINE constexpr VectorRef<V> Lazy(const V& vector);
+template<typename M> requires detail::IsMatrix<M>::value
+MATH_EXPR_INLINE constexpr MatrixRef<M> Lazy(const M& matrix);
+
+template<VectorExpressionConcept E>
+MATH_EXPR_INLINE constexpr typename E::Result Evaluate(const E& expression);
+template<MatrixExpressionConcept E>
+MATH_EXPR_INLINE constexpr typename E::Result Evaluate(const E& expression);
+
+//! Operators
+template<typename L, typename R> requires VectorPairConcept<L, R>
+MATH_EXPR_INLINE constexpr auto operator+(const L& left, const R& right);
+template<typename L, typename R> requires VectorPairConcept<L, R>
+MATH_EXPR_INLINE constexpr auto operator-(const L& left, const R& right);
+template<typename L, typename R> requires VectorPairConcept<L, R>
+MATH_EXPR_INLINE constexpr auto operator*(const L& left, const R& right);
+template<typename L, typename R> requires VectorPairConcept<L, R>
+MATH_EXPR_INLINE constexpr auto operator/(const L& left, const R& right);
+template<VectorExpressionConcept E>
+MATH_EXPR_INLINE constexpr auto operator*(const E& expression, typename E::Type value);
+template<VectorExpressionConcept E>
+MATH_EXPR_INLINE constexpr auto operator*(typename E::Type value, const E& expression);
+template<VectorExpressionConcept E>
+MATH_EXPR_INLINE constexpr auto operator/(const E& expression, typename E::Type value);
+template<VectorExpressionConcept E>
+MATH_EXPR_INLINE constexpr auto operator-(const E& expression);
+
+template<typename L, typename R> requires MatrixPairConcept<L, R>
+MATH_EXPR_INLINE constexpr auto operator*(const L& left, const R& right);
+//Evaluated right away, the result is a plain vector
+template<typename M, typename V> requires MatrixVectorConcept<M, V>
+MATH_EXPR_INLINE constexpr auto operator*(const M& matrix, const V& vector);
+
+} //namespace math::expr
+
+#include "Expression.inl"
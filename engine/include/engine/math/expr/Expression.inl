@@ -0,0 +1,262 @@
+#include <utility>
+
+namespace math::expr
+{
+
+namespace detail
+{
+
+//Plain vectors and matrices become reference leaves, nodes are kept as is
+template<typename T>
+MATH_EXPR_INLINE constexpr auto AsExpression(const T& operand)
+{
+    if constexpr (IsVector<T>::value)
+    {
+        return VectorRef<T>{operand};
+    }
+    else if constexpr (IsMatrix<T>::value)
+    {
+        return MatrixRef<T>{operand};
+    }
+    else
+    {
+        return operand;
+    }
+}
+
+template<typename T>
+using ExpressionOf = decltype(AsExpression(std::declval<const T&>()));
+
+template<typename E, std::size_t... I>
+MATH_EXPR_INLINE constexpr typename E::Result EvaluateVector(const E& expression, std::index_sequence<I...>)
+{
+    return typename E::Result(expression.template Get<I>()...);
+}
+
+//Leaves are returned by reference so a single matrix is not copied
+template<typename M>
+MATH_EXPR_INLINE constexpr const M& Product(const MatrixRef<M>& expression)
+{
+    return expression.matrix;
+}
+
+template<typename L, typename R>
+MATH_EXPR_INLINE constexpr typename L::Result Product(const MatrixProduct<L, R>& expression)
+{
+    return Product(expression.left) * Product(expression.right);
+}
+
+//(A * B) * v is applied as A * (B * v), square matrices make this the
+//cheapest order for any chain
+template<typename M, typename V>
+MATH_EXPR_INLINE constexpr auto Apply(const MatrixRef<M>& expression, const V& vector)
+{
+    return expression.matrix * vector;
+}
+
+template<typename L, typename R, typename V>
+MATH_EXPR_INLINE constexpr auto Apply(const MatrixProduct<L, R>& expression, const V& vector)
+{
+    return Apply(expression.left, Apply(expression.right, vector));
+}
+
+} //namespace detail
+
+//! Vector nodes
+template<typename V>
+template<std::size_t I>
+constexpr typename VectorRef<V>::Type VectorRef<V>::Get() const
+{
+    if constexpr (I == 0)
+    {
+        return vector.x;
+    }
+    else if constexpr (I == 1)
+    {
+        return vector.y;
+    }
+    else if constexpr (I == 2)
+    {
+        return vector.z;
+    }
+    else
+    {
+        return vector.w;
+    }
+}
+
+template<typename V>
+constexpr VectorRef<V>::operator Result() const
+{
+    return vector;
+}
+
+template<typename T, int32_t N>
+template<std::size_t I>
+constexpr T VectorScalar<T, N>::Get() const
+{
+    return value;
+}
+
+template<typename T, int32_t N>
+constexpr VectorScalar<T, N>::operator Result() const
+{
+    return Result(value);
+}
+
+template<Operation Op, typename L, typename R>
+template<std::size_t I>
+constexpr typename VectorBinary<Op, L, R>::Type VectorBinary<Op, L, R>::Get() const
+{
+    if constexpr (Op == Operation::Add)
+    {
+        return left.template Get<I>() + right.template Get<I>();
+    }
+    else if constexpr (Op == Operation::Subtract)
+    {
+        return left.template Get<I>() - right.template Get<I>();
+    }
+    else if constexpr (Op == Operation::Multiply)
+    {
+        return left.template Get<I>() * right.template Get<I>();
+    }
+    else
+    {
+        return left.template Get<I>() / right.template Get<I>();
+    }
+}
+
+template<Operation Op, typename L, typename R>
+constexpr VectorBinary<Op, L, R>::operator Result() const
+{
+    return Evaluate(*this);
+}
+
+template<typename E>
+template<std::size_t I>
+constexpr typename VectorNegate<E>::Type VectorNegate<E>::Get() const
+{
+    return -expression.template Get<I>();
+}
+
+template<typename E>
+constexpr VectorNegate<E>::operator Result() const
+{
+    return Evaluate(*this);
+}
+
+//! Matrix nodes
+template<typename M>
+constexpr MatrixRef<M>::operator Result() const
+{
+    return matrix;
+}
+
+template<typename L, typename R>
+constexpr MatrixProduct<L, R>::operator Result() const
+{
+    return detail::Product(*this);
+}
+
+//! Operations
+template<typename V> requires detail::IsVector<V>::value
+constexpr VectorRef<V> Lazy(const V& vector)
+{
+    return VectorRef<V>{vector};
+}
+
+template<typename M> requires detail::IsMatrix<M>::value
+constexpr MatrixRef<M> Lazy(const M& matrix)
+{
+    return MatrixRef<M>{matrix};
+}
+
+template<VectorExpressionConcept E>
+constexpr typename E::Result Evaluate(const E& expression)
+{
+    return detail::EvaluateVector(expression, std::make_index_sequence<E::Size>());
+}
+
+template<MatrixExpressionConcept E>
+constexpr typename E::Result Evaluate(const E& expression)
+{
+    return detail::Product(expression);
+}
+
+//! Operators
+template<typename L, typename R> requires VectorPairConcept<L, R>
+constexpr auto operator+(const L& left, const R& right)
+{
+    using Node = VectorBinary<Operation::Add, detail::ExpressionOf<L>, detail::ExpressionOf<R>>;
+    return Node{detail::AsExpression(left), detail::AsExpression(right)};
+}
+
+template<typename L, typename R> requires VectorPairConcept<L, R>
+constexpr auto operator-(const L& left, const R& right)
+{
+    using Node = VectorBinary<Operation::Subtract, detail::ExpressionOf<L>, detail::ExpressionOf<R>>;
+    return Node{detail::AsExpression(left), detail::AsExpression(right)};
+}
+
+template<typename L, typename R> requires VectorPairConcept<L, R>
+constexpr auto operator*(const L& left, const R& right)
+{
+    using Node = VectorBinary<Operation::Multiply, detail::ExpressionOf<L>, detail::ExpressionOf<R>>;
+    return Node{detail::AsExpression(left), detail::AsExpression(right)};
+}
+
+template<typename L, typename R> requires VectorPairConcept<L, R>
+constexpr auto operator/(const L& left, const R& right)
+{
+    using Node = VectorBinary<Operation::Divide, detail::ExpressionOf<L>, detail::ExpressionOf<R>>;
+    return Node{detail::AsExpression(left), detail::AsExpression(right)};
+}
+
+template<VectorExpressionConcept E>
+constexpr auto operator*(const E& expression, typename E::Type value)
+{
+    using Scalar = VectorScalar<typename E::Type, E::Size>;
+    return VectorBinary<Operation::Multiply, E, Scalar>{expression, Scalar{value}};
+}
+
+template<VectorExpressionConcept E>
+constexpr auto operator*(typename E::Type value, const E& expression)
+{
+    using Scalar = VectorScalar<typename E::Type, E::Size>;
+    return VectorBinary<Operation::Multiply, Scalar, E>{Scalar{value}, expression};
+}
+
+//Multiplies by the reciprocal like the vector operators
+template<VectorExpressionConcept E>
+constexpr auto operator/(const E& expression, typename E::Type value)
+{
+    using Scalar = VectorScalar<typename E::Type, E::Size>;
+    return VectorBinary<Operation::Multiply, E, Scalar>{expression, Scalar{1 / value}};
+}
+
+template<VectorExpressionConcept E>
+constexpr auto operator-(const E& expression)
+{
+    return VectorNegate<E>{expression};
+}
+
+template<typename L, typename R> requires MatrixPairConcept<L, R>
+constexpr auto operator*(const L& left, const R& right)
+{
+    return MatrixProduct<detail::ExpressionOf<L>, detail::ExpressionOf<R>>{detail::AsExpression(left), detail::AsExpression(right)};
+}
+
+template<typename M, typename V> requires MatrixVectorConcept<M, V>
+constexpr auto operator*(const M& matrix, const V& vector)
+{
+    if constexpr (VectorExpressionConcept<V>)
+    {
+        return detail::Apply(detail::AsExpression(matrix), Evaluate(vector));
+    }
+    else
+    {
+        return detail::Apply(detail::AsExpression(matrix), vector);
+    }
+}
+
+} //namespace math::expr
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector3.hpp"
+#include "../matrix/Matrix4.hpp"
+
+namespace math
+{
+
+//Axis aligned box given by its min and max corners
+template<typename T>
+struct AABB
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr AABB();
+    constexpr AABB(const Vector3<T>& min, const Vector3<T>& max);
+
+    //! Operations
+    constexpr Vector3<T>  GetCenter() const;
+    //Half of the size
+    constexpr Vector3<T>  GetExtents() const;
+    constexpr Vector3<T>  GetSize() const;
+    constexpr T           GetSurfaceArea() const;
+    //False for empty (inverted) boxes
+    constexpr bool        IsValid() const;
+    constexpr bool        Contains(const Vector3<T>& point) const;
+    constexpr bool        IntersectsAABB(const AABB& other) const;
+    constexpr Vector3<T>  GetClosestPoint(const Vector3<T>& point) const;
+    constexpr AABB        GetMerged(const AABB& other) const;
+    constexpr AABB        GetMerged(const Vector3<T>& point) const;
+    //Bounds of the transformed box (Arvo), exact for affine transforms
+    constexpr AABB        GetTransformed(const Matrix4<T>& transform) const;
+    //Inverted box with min = +max and max = -max, merging anything into it
+    //gives that thing's bounds
+    constexpr static AABB CreateEmpty();
+    constexpr static AABB CreateFromCenter(const Vector3<T>& center, const Vector3<T>& extents);
+
+public:
+    Vector3<T> min;
+    Vector3<T> max;
+};
+template struct AABB<float>;
+template struct AABB<double>;
+
+using AABB3  = AABB<float>;
+using AABB3d = AABB<double>;
+
+} //namespace math
+
+#include "AABB.inl"
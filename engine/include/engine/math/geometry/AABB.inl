@@ -0,0 +1,125 @@
+#include <limits>
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr AABB<T>::AABB() : min{}, max{} { }
+
+template<typename T>
+constexpr AABB<T>::AABB(const Vector3<T>& min, const Vector3<T>& max) : min{min}, max{max} { }
+
+//! Operations
+template<typename T>
+constexpr Vector3<T> AABB<T>::GetCenter() const
+{
+    return (min + max) * static_cast<T>(0.5);
+}
+
+template<typename T>
+constexpr Vector3<T> AABB<T>::GetExtents() const
+{
+    return (max - min) * static_cast<T>(0.5);
+}
+
+template<typename T>
+constexpr Vector3<T> AABB<T>::GetSize() const
+{
+    return max - min;
+}
+
+template<typename T>
+constexpr T AABB<T>::GetSurfaceArea() const
+{
+    Vector3<T> size = max - min;
+
+    return 2 * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+template<typename T>
+constexpr bool AABB<T>::IsValid() const
+{
+    return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+}
+
+template<typename T>
+constexpr bool AABB<T>::Contains(const Vector3<T>& point) const
+{
+    return point.x >= min.x && point.x <= max.x &&
+           point.y >= min.y && point.y <= max.y &&
+           point.z >= min.z && point.z <= max.z;
+}
+
+template<typename T>
+constexpr bool AABB<T>::IntersectsAABB(const AABB<T>& other) const
+{
+    return min.x <= other.max.x && max.x >= other.min.x &&
+           min.y <= other.max.y && max.y >= other.min.y &&
+           min.z <= other.max.z && max.z >= other.min.z;
+}
+
+template<typename T>
+constexpr Vector3<T> AABB<T>::GetClosestPoint(const Vector3<T>& point) const
+{
+    return Vector3<T>(point.x < min.x ? min.x : (point.x > max.x ? max.x : point.x),
+                      point.y < min.y ? min.y : (point.y > max.y ? max.y : point.y),
+                      point.z < min.z ? min.z : (point.z > max.z ? max.z : point.z));
+}
+
+template<typename T>
+constexpr AABB<T> AABB<T>::GetMerged(const AABB<T>& other) const
+{
+    return AABB(Vector3<T>(min.x < other.min.x ? min.x : other.min.x,
+                           min.y < other.min.y ? min.y : other.min.y,
+                           min.z < other.min.z ? min.z : other.min.z),
+                Vector3<T>(max.x > other.max.x ? max.x : other.max.x,
+                           max.y > other.max.y ? max.y : other.max.y,
+                           max.z > other.max.z ? max.z : other.max.z));
+}
+
+template<typename T>
+constexpr AABB<T> AABB<T>::GetMerged(const Vector3<T>& point) const
+{
+    return GetMerged(AABB(point, point));
+}
+
+//Each row of the matrix adds its smallest and largest products with the box
+//extremes to the translation
+template<typename T>
+constexpr AABB<T> AABB<T>::GetTransformed(const Matrix4<T>& transform) const
+{
+    const T* m = transform.arr;
+    Vector3<T> newMin(m[12], m[13], m[14]);
+    Vector3<T> newMax(m[12], m[13], m[14]);
+
+    for(int32_t column = 0; column < 3; ++column)
+    {
+        for(int32_t row = 0; row < 3; ++row)
+        {
+            T a = m[column * 4 + row] * min[column];
+            T b = m[column * 4 + row] * max[column];
+
+            newMin[row] += a < b ? a : b;
+            newMax[row] += a < b ? b : a;
+        }
+    }
+
+    return AABB(newMin, newMax);
+}
+
+template<typename T>
+constexpr AABB<T> AABB<T>::CreateEmpty()
+{
+    constexpr T limit = std::numeric_limits<T>::max();
+
+    return AABB(Vector3<T>(limit), Vector3<T>(-limit));
+}
+
+template<typename T>
+constexpr AABB<T> AABB<T>::CreateFromCenter(const Vector3<T>& center, const Vector3<T>& extents)
+{
+    return AABB(center - extents, center + extents);
+}
+
+} //namespace math
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector3.hpp"
+#include "AABB.hpp"
+#include "Sphere.hpp"
+
+namespace math
+{
+
+//Points within radius of the segment from a to b
+template<typename T>
+struct Capsule
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr Capsule();
+    constexpr Capsule(const Vector3<T>& a, const Vector3<T>& b, T radius);
+
+    //! Operations
+    constexpr Vector3<T> GetClosestSegmentPoint(const Vector3<T>& point) const;
+    constexpr bool       Contains(const Vector3<T>& point) const;
+    constexpr bool       IntersectsSphere(const Sphere<T>& sphere) const;
+    constexpr AABB<T>    GetBounds() const;
+
+public:
+    Vector3<T> a;
+    Vector3<T> b;
+    T          radius;
+};
+template struct Capsule<float>;
+template struct Capsule<double>;
+
+using Capsule3  = Capsule<float>;
+using Capsule3d = Capsule<double>;
+
+} //namespace math
+
+#include "Capsule.inl"
@@ -0,0 +1,51 @@
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr Capsule<T>::Capsule() : a{}, b{}, radius{} { }
+
+template<typename T>
+constexpr Capsule<T>::Capsule(const Vector3<T>& a, const Vector3<T>& b, T radius) : a{a}, b{b}, radius{radius} { }
+
+//! Operations
+template<typename T>
+constexpr Vector3<T> Capsule<T>::GetClosestSegmentPoint(const Vector3<T>& point) const
+{
+    Vector3<T> ab     = b - a;
+    T          length = ab.LengthSquared();
+
+    if(length <= 0)
+    {
+        return a;
+    }
+
+    T t = (point - a).Dot(ab) / length;
+    t   = t < 0 ? 0 : (t > 1 ? 1 : t);
+
+    return a + ab * t;
+}
+
+template<typename T>
+constexpr bool Capsule<T>::Contains(const Vector3<T>& point) const
+{
+    return (point - GetClosestSegmentPoint(point)).LengthSquared() <= radius * radius;
+}
+
+template<typename T>
+constexpr bool Capsule<T>::IntersectsSphere(const Sphere<T>& sphere) const
+{
+    T reach = radius + sphere.radius;
+
+    return (sphere.center - GetClosestSegmentPoint(sphere.center)).LengthSquared() <= reach * reach;
+}
+
+template<typename T>
+constexpr AABB<T> Capsule<T>::GetBounds() const
+{
+    AABB<T> segment = AABB<T>(a, a).GetMerged(b);
+
+    return AABB<T>(segment.min - Vector3<T>(radius), segment.max + Vector3<T>(radius));
+}
+
+} //namespace math
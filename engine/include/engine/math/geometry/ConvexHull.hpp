@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include "../vector/Vector3.hpp"
+#include "AABB.hpp"
+
+namespace math
+{
+
+//Convex hull of a point cloud, optionally rounded by radius. The points are
+//referenced, not copied, and must outlive the hull. They do not need to be
+//the hull vertices only, interior points just make GetSupportIndex slower
+template<typename T>
+struct ConvexHull
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr ConvexHull();
+    constexpr ConvexHull(std::span<const Vector3<T>> points, T radius = 0);
+
+    //! Operations
+    //Point furthest along direction, the first one on ties. 4 (SSE) or 8
+    //(AVX2) points at a time for float. The hull must not be empty
+    uint32_t          GetSupportIndex(const Vector3<T>& direction) const;
+    constexpr AABB<T> GetBounds() const;
+
+public:
+    std::span<const Vector3<T>> points;
+    T                           radius;
+};
+template struct ConvexHull<float>;
+template struct ConvexHull<double>;
+
+using ConvexHull3  = ConvexHull<float>;
+using ConvexHull3d = ConvexHull<double>;
+
+} //namespace math
+
+#include "ConvexHull.inl"
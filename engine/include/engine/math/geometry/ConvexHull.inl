@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include "../simd/SupportSimd.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr ConvexHull<T>::ConvexHull() : points{}, radius{} { }
+
+template<typename T>
+constexpr ConvexHull<T>::ConvexHull(std::span<const Vector3<T>> points, T radius) : points{points}, radius{radius} { }
+
+//! Operations
+template<typename T>
+uint32_t ConvexHull<T>::GetSupportIndex(const Vector3<T>& direction) const
+{
+    assert(!points.empty());
+
+    T           bestDot   = points[0].Dot(direction);
+    uint32_t    bestIndex = 0;
+    std::size_t i         = 1;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = std::max<std::size_t>(simd::FindSupport(reinterpret_cast<const float*>(points.data()), points.size(),
+            &direction.x, bestDot, bestIndex), 1);
+    }
+#endif
+
+    for(; i < points.size(); ++i)
+    {
+        T dot = points[i].Dot(direction);
+        if(dot > bestDot)
+        {
+            bestDot   = dot;
+            bestIndex = static_cast<uint32_t>(i);
+        }
+    }
+
+    return bestIndex;
+}
+
+template<typename T>
+constexpr AABB<T> ConvexHull<T>::GetBounds() const
+{
+    AABB<T> bounds = AABB<T>::CreateEmpty();
+
+    for(const Vector3<T>& point : points)
+    {
+        bounds = bounds.GetMerged(point);
+    }
+
+    return AABB<T>(bounds.min - Vector3<T>(radius), bounds.max + Vector3<T>(radius));
+}
+
+} //namespace math
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include "../vector/Vector3.hpp"
+#include "../vector/Vector4.hpp"
+#include "../vector/Vector3Stream.hpp"
+#include "../matrix/Matrix4.hpp"
+
+namespace math
+{
+
+//View frustum as 6 normalised planes (nx, ny, nz, d) whose normals point
+//inside, so a point p is inside when dot(n, p) + d >= 0 for every plane.
+//Planes are extracted from a view projection matrix built with
+//Matrix4::CreatePerspective (clip space depth in [0, 1])
+template<typename T>
+struct Frustum
+{
+public:
+    using Type = T;
+    constexpr static int32_t NumPlanes = 6;
+
+    enum PlaneIndex
+    {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far
+    };
+
+    //! Constructors
+    constexpr Frustum();
+    constexpr explicit Frustum(const Matrix4<T>& viewProjection);
+
+    //! Operations
+    constexpr bool IntersectsSphere(const Vector3<T>& center, T radius) const;
+    //Box given by its center and half extents
+    constexpr bool IntersectsAABB(const Vector3<T>& center, const Vector3<T>& extents) const;
+
+    //Batched tests over structure of arrays bounds. The indices of the visible
+    //objects are written to visible in increasing order and their count is
+    //returned. visible must have room for every object
+    std::size_t CullSpheres(const Vector3Stream<T>& centers, std::span<const T> radii, 
+        std::span<uint32_t> visible) const;
+    std::size_t CullAABBs(const Vector3Stream<T>& centers, const Vector3Stream<T>& extents, 
+        std::span<uint32_t> visible) const;
+
+public:
+    Vector4<T> planes[NumPlanes];
+};
+template struct Frustum<float>;
+template struct Frustum<double>;
+
+using Frust  = Frustum<float>;
+using Frustd = Frustum<double>;
+
+} //namespace math
+
+#include "Frustum.inl"
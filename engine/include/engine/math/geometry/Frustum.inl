@@ -0,0 +1,125 @@
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include "../Functions.hpp"
+#include "../simd/CullingSimd.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr Frustum<T>::Frustum() : planes{} { }
+
+//Gribb-Hartmann extraction, every plane is a sum or difference of the rows
+//of the clip space transform
+template<typename T>
+constexpr Frustum<T>::Frustum(const Matrix4<T>& viewProjection) : planes{}
+{
+    const T* m = viewProjection.arr;
+    Vector4<T> row0(m[0], m[4], m[8],  m[12]);
+    Vector4<T> row1(m[1], m[5], m[9],  m[13]);
+    Vector4<T> row2(m[2], m[6], m[10], m[14]);
+    Vector4<T> row3(m[3], m[7], m[11], m[15]);
+
+    planes[Left]   = row3 + row0;
+    planes[Right]  = row3 - row0;
+    planes[Bottom] = row3 + row1;
+    planes[Top]    = row3 - row1;
+    planes[Near]   = row2;
+    planes[Far]    = row3 - row2;
+
+    for(Vector4<T>& plane : planes)
+    {
+        T invL = 1 / Sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        plane *= invL;
+    }
+}
+
+//! Operations
+template<typename T>
+constexpr bool Frustum<T>::IntersectsSphere(const Vector3<T>& center, T radius) const
+{
+    for(const Vector4<T>& plane : planes)
+    {
+        if(plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+constexpr bool Frustum<T>::IntersectsAABB(const Vector3<T>& center, const Vector3<T>& extents) const
+{
+    for(const Vector4<T>& plane : planes)
+    {
+        T distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        T reach    = std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y + std::abs(plane.z) * extents.z;
+
+        if(distance + reach < 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+std::size_t Frustum<T>::CullSpheres(const Vector3Stream<T>& centers, std::span<const T> radii, 
+    std::span<uint32_t> visible) const
+{
+    assert(radii.size() >= centers.Size() && visible.size() >= centers.Size());
+
+    std::size_t i     = 0;
+    std::size_t count = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::CullSpheres(&planes[0].x, centers.x.data(), centers.y.data(), centers.z.data(), 
+            radii.data(), centers.Size(), visible.data(), count);
+    }
+#endif
+
+    for(; i < centers.Size(); ++i)
+    {
+        if(IntersectsSphere(centers.Get(i), radii[i]))
+        {
+            visible[count++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    return count;
+}
+
+template<typename T>
+std::size_t Frustum<T>::CullAABBs(const Vector3Stream<T>& centers, const Vector3Stream<T>& extents, 
+    std::span<uint32_t> visible) const
+{
+    assert(extents.Size() == centers.Size() && visible.size() >= centers.Size());
+
+    std::size_t i     = 0;
+    std::size_t count = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::CullAABBs(&planes[0].x, centers.x.data(), centers.y.data(), centers.z.data(), 
+            extents.x.data(), extents.y.data(), extents.z.data(), centers.Size(), visible.data(), count);
+    }
+#endif
+
+    for(; i < centers.Size(); ++i)
+    {
+        if(IntersectsAABB(centers.Get(i), extents.Get(i)))
+        {
+            visible[count++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    return count;
+}
+
+} //namespace math
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector3.hpp"
+#include "../quat/Quaternion.hpp"
+#include "AABB.hpp"
+#include "Sphere.hpp"
+
+namespace math
+{
+
+//Oriented box given by its center, half extents and orthonormal local axes
+template<typename T>
+struct OBB
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr OBB();
+    constexpr OBB(const Vector3<T>& center, const Vector3<T>& extents);
+    constexpr OBB(const Vector3<T>& center, const Vector3<T>& extents, const Quaternion<T>& rotation);
+    constexpr explicit OBB(const AABB<T>& box);
+
+    //! Operations
+    //The point relative to the center expressed on the local axes
+    constexpr Vector3<T> ToLocal(const Vector3<T>& point) const;
+    constexpr bool       Contains(const Vector3<T>& point) const;
+    constexpr Vector3<T> GetClosestPoint(const Vector3<T>& point) const;
+    constexpr AABB<T>    GetBounds() const;
+    constexpr bool       IntersectsSphere(const Sphere<T>& sphere) const;
+    //Separating axis test on the 3 + 3 face normals and 9 edge cross products
+    constexpr bool       IntersectsOBB(const OBB& other) const;
+    constexpr bool       IntersectsAABB(const AABB<T>& box) const;
+
+public:
+    Vector3<T> center;
+    Vector3<T> extents;
+    Vector3<T> axes[3];
+};
+template struct OBB<float>;
+template struct OBB<double>;
+
+using OBB3  = OBB<float>;
+using OBB3d = OBB<double>;
+
+} //namespace math
+
+#include "OBB.inl"
@@ -0,0 +1,150 @@
+#include <cmath>
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr OBB<T>::OBB() : center{}, extents{}, axes{Vector3<T>(1, 0, 0), Vector3<T>(0, 1, 0), Vector3<T>(0, 0, 1)} { }
+
+template<typename T>
+constexpr OBB<T>::OBB(const Vector3<T>& center, const Vector3<T>& extents) : 
+    center{center}, extents{extents}, axes{Vector3<T>(1, 0, 0), Vector3<T>(0, 1, 0), Vector3<T>(0, 0, 1)} { }
+
+template<typename T>
+constexpr OBB<T>::OBB(const Vector3<T>& center, const Vector3<T>& extents, const Quaternion<T>& rotation) : 
+    center{center}, extents{extents}, axes{}
+{
+    Matrix4<T> m = rotation.ToMatrix4();
+
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        axes[i] = Vector3<T>(m.arr[i * 4], m.arr[i * 4 + 1], m.arr[i * 4 + 2]);
+    }
+}
+
+template<typename T>
+constexpr OBB<T>::OBB(const AABB<T>& box) : OBB(box.GetCenter(), box.GetExtents()) { }
+
+//! Operations
+template<typename T>
+constexpr Vector3<T> OBB<T>::ToLocal(const Vector3<T>& point) const
+{
+    Vector3<T> d = point - center;
+
+    return Vector3<T>(d.Dot(axes[0]), d.Dot(axes[1]), d.Dot(axes[2]));
+}
+
+template<typename T>
+constexpr bool OBB<T>::Contains(const Vector3<T>& point) const
+{
+    Vector3<T> local = ToLocal(point);
+
+    return std::abs(local.x) <= extents.x && std::abs(local.y) <= extents.y && std::abs(local.z) <= extents.z;
+}
+
+template<typename T>
+constexpr Vector3<T> OBB<T>::GetClosestPoint(const Vector3<T>& point) const
+{
+    Vector3<T> local  = ToLocal(point);
+    Vector3<T> result = center;
+
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        T d = local[i] < -extents[i] ? -extents[i] : (local[i] > extents[i] ? extents[i] : local[i]);
+        result += axes[i] * d;
+    }
+
+    return result;
+}
+
+template<typename T>
+constexpr AABB<T> OBB<T>::GetBounds() const
+{
+    Vector3<T> reach;
+
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        reach[i] = std::abs(axes[0][i]) * extents.x + std::abs(axes[1][i]) * extents.y + std::abs(axes[2][i]) * extents.z;
+    }
+
+    return AABB<T>::CreateFromCenter(center, reach);
+}
+
+template<typename T>
+constexpr bool OBB<T>::IntersectsSphere(const Sphere<T>& sphere) const
+{
+    return (GetClosestPoint(sphere.center) - sphere.center).LengthSquared() <= sphere.radius * sphere.radius;
+}
+
+//Gottschalk's test, the other box is expressed in the frame of this one. The
+//epsilon keeps near parallel edges from producing a null cross product axis
+template<typename T>
+constexpr bool OBB<T>::IntersectsOBB(const OBB<T>& other) const
+{
+    constexpr T epsilon = static_cast<T>(1e-6);
+
+    T r[3][3];
+    T absR[3][3];
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        for(int32_t j = 0; j < 3; ++j)
+        {
+            r[i][j]    = axes[i].Dot(other.axes[j]);
+            absR[i][j] = std::abs(r[i][j]) + epsilon;
+        }
+    }
+
+    Vector3<T> d = other.center - center;
+    T t[3]       = { d.Dot(axes[0]), d.Dot(axes[1]), d.Dot(axes[2]) };
+
+    //Face normals of this box
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        T rb = other.extents.x * absR[i][0] + other.extents.y * absR[i][1] + other.extents.z * absR[i][2];
+        if(std::abs(t[i]) > extents[i] + rb)
+        {
+            return false;
+        }
+    }
+
+    //Face normals of the other box
+    for(int32_t j = 0; j < 3; ++j)
+    {
+        T ra = extents.x * absR[0][j] + extents.y * absR[1][j] + extents.z * absR[2][j];
+        if(std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > ra + other.extents[j])
+        {
+            return false;
+        }
+    }
+
+    //Cross products of the edges, axes[i] x other.axes[j]
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        int32_t i1 = (i + 1) % 3;
+        int32_t i2 = (i + 2) % 3;
+
+        for(int32_t j = 0; j < 3; ++j)
+        {
+            int32_t j1 = (j + 1) % 3;
+            int32_t j2 = (j + 2) % 3;
+
+            T ra = extents[i1] * absR[i2][j] + extents[i2] * absR[i1][j];
+            T rb = other.extents[j1] * absR[i][j2] + other.extents[j2] * absR[i][j1];
+            if(std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+constexpr bool OBB<T>::IntersectsAABB(const AABB<T>& box) const
+{
+    return IntersectsOBB(OBB(box));
+}
+
+} //namespace math
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector3.hpp"
+#include "AABB.hpp"
+#include "Sphere.hpp"
+
+namespace math
+{
+
+//Points p with dot(normal, p) + distance = 0, the same convention as the
+//Frustum planes. The normal is expected to be normalised for the distance
+//based tests
+template<typename T>
+struct Plane
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr Plane();
+    constexpr Plane(const Vector3<T>& normal, T distance);
+
+    //! Operations
+    //Positive on the side the normal points to
+    constexpr T            GetSignedDistance(const Vector3<T>& point) const;
+    constexpr Vector3<T>   GetProjected(const Vector3<T>& point) const;
+    constexpr Plane        GetNormalized() const;
+    constexpr bool         IntersectsSphere(const Sphere<T>& sphere) const;
+    constexpr bool         IntersectsAABB(const AABB<T>& box) const;
+    constexpr static Plane CreateFromPoint(const Vector3<T>& normal, const Vector3<T>& point);
+    //Counter clockwise points seen from the side the normal points to
+    constexpr static Plane CreateFromPoints(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c);
+
+public:
+    Vector3<T> normal;
+    T          distance;
+};
+template struct Plane<float>;
+template struct Plane<double>;
+
+using Plane3  = Plane<float>;
+using Plane3d = Plane<double>;
+
+} //namespace math
+
+#include "Plane.inl"
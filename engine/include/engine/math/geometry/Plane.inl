@@ -0,0 +1,63 @@
+#include <cmath>
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr Plane<T>::Plane() : normal{0, 1, 0}, distance{} { }
+
+template<typename T>
+constexpr Plane<T>::Plane(const Vector3<T>& normal, T distance) : normal{normal}, distance{distance} { }
+
+//! Operations
+template<typename T>
+constexpr T Plane<T>::GetSignedDistance(const Vector3<T>& point) const
+{
+    return normal.Dot(point) + distance;
+}
+
+template<typename T>
+constexpr Vector3<T> Plane<T>::GetProjected(const Vector3<T>& point) const
+{
+    return point - normal * GetSignedDistance(point);
+}
+
+template<typename T>
+constexpr Plane<T> Plane<T>::GetNormalized() const
+{
+    T invL = 1 / normal.Length();
+
+    return Plane(normal * invL, distance * invL);
+}
+
+template<typename T>
+constexpr bool Plane<T>::IntersectsSphere(const Sphere<T>& sphere) const
+{
+    return std::abs(GetSignedDistance(sphere.center)) <= sphere.radius;
+}
+
+//The box touches the plane when the center is closer than the projection of
+//the extents on the normal
+template<typename T>
+constexpr bool Plane<T>::IntersectsAABB(const AABB<T>& box) const
+{
+    Vector3<T> extents = box.GetExtents();
+    T reach            = std::abs(normal.x) * extents.x + std::abs(normal.y) * extents.y + std::abs(normal.z) * extents.z;
+
+    return std::abs(GetSignedDistance(box.GetCenter())) <= reach;
+}
+
+template<typename T>
+constexpr Plane<T> Plane<T>::CreateFromPoint(const Vector3<T>& normal, const Vector3<T>& point)
+{
+    return Plane(normal, -normal.Dot(point));
+}
+
+template<typename T>
+constexpr Plane<T> Plane<T>::CreateFromPoints(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c)
+{
+    return CreateFromPoint((b - a).Cross(c - a).GetNormalized(), a);
+}
+
+} //namespace math
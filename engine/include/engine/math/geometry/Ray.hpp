@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "AABB.hpp"
+#include "OBB.hpp"
+#include "Plane.hpp"
+#include "Sphere.hpp"
+#include "Triangle.hpp"
+
+namespace math
+{
+
+//Half line origin + direction * t for t >= 0. The direction does not have to
+//be normalised, hit distances are then in units of its length. The tests
+//return the distance of the first point of the primitive along the ray, 0
+//when the origin is inside it
+template<typename T>
+struct Ray
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr Ray();
+    constexpr Ray(const Vector3<T>& origin, const Vector3<T>& direction);
+
+    //! Operations
+    constexpr Vector3<T> GetPoint(T distance) const;
+    //Slab test, axis parallel rays on a slab boundary count as inside
+    constexpr bool       IntersectsAABB(const AABB<T>& box, T& distance) const;
+    constexpr bool       IntersectsOBB(const OBB<T>& box, T& distance) const;
+    constexpr bool       IntersectsSphere(const Sphere<T>& sphere, T& distance) const;
+    //Rays parallel to the plane never hit it
+    constexpr bool       IntersectsPlane(const Plane<T>& plane, T& distance) const;
+    //Moller-Trumbore, double sided. Degenerate triangles are never hit
+    constexpr bool       IntersectsTriangle(const Triangle<T>& triangle, T& distance) const;
+    //Also gives the barycentric coordinates (u, v) of the hit, the point is
+    //v0 * (1 - u - v) + v1 * u + v2 * v
+    constexpr bool       IntersectsTriangle(const Triangle<T>& triangle, T& distance, Vector2<T>& barycentric) const;
+
+public:
+    Vector3<T> origin;
+    Vector3<T> direction;
+};
+template struct Ray<float>;
+template struct Ray<double>;
+
+using Ray3  = Ray<float>;
+using Ray3d = Ray<double>;
+
+} //namespace math
+
+#include "Ray.inl"
@@ -0,0 +1,150 @@
+#include <limits>
+#include "../Functions.hpp"
+
+namespace math
+{
+
+namespace detail
+{
+
+//Slab test against [min, max] on each axis. The min and max selections
+//return their second operand on NaN like minps / maxps so the scalar and
+//SIMD tests agree when 0 * inf appears on a slab boundary
+template<typename T>
+constexpr bool IntersectSlabs(const Vector3<T>& origin, const Vector3<T>& invDirection, 
+    const Vector3<T>& min, const Vector3<T>& max, T& distance)
+{
+    T tMin = 0;
+    T tMax = std::numeric_limits<T>::infinity();
+
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        T t1   = (min[i] - origin[i]) * invDirection[i];
+        T t2   = (max[i] - origin[i]) * invDirection[i];
+        T near = t1 < t2 ? t1 : t2;
+        T far  = t1 > t2 ? t1 : t2;
+
+        tMin = near > tMin ? near : tMin;
+        tMax = far < tMax ? far : tMax;
+    }
+
+    distance = tMin;
+    return tMin <= tMax;
+}
+
+} //namespace detail
+
+//! Constructors
+template<typename T>
+constexpr Ray<T>::Ray() : origin{}, direction{0, 0, 1} { }
+
+template<typename T>
+constexpr Ray<T>::Ray(const Vector3<T>& origin, const Vector3<T>& direction) : origin{origin}, direction{direction} { }
+
+//! Operations
+template<typename T>
+constexpr Vector3<T> Ray<T>::GetPoint(T distance) const
+{
+    return origin + direction * distance;
+}
+
+template<typename T>
+constexpr bool Ray<T>::IntersectsAABB(const AABB<T>& box, T& distance) const
+{
+    Vector3<T> invDirection(1 / direction.x, 1 / direction.y, 1 / direction.z);
+
+    return detail::IntersectSlabs(origin, invDirection, box.min, box.max, distance);
+}
+
+//Slab test in the local frame of the box
+template<typename T>
+constexpr bool Ray<T>::IntersectsOBB(const OBB<T>& box, T& distance) const
+{
+    Vector3<T> localOrigin = box.ToLocal(origin);
+    Vector3<T> invDirection(1 / direction.Dot(box.axes[0]), 1 / direction.Dot(box.axes[1]), 
+        1 / direction.Dot(box.axes[2]));
+
+    return detail::IntersectSlabs(localOrigin, invDirection, -box.extents, box.extents, distance);
+}
+
+//Roots of |origin + direction * t - center|^2 = radius^2
+template<typename T>
+constexpr bool Ray<T>::IntersectsSphere(const Sphere<T>& sphere, T& distance) const
+{
+    Vector3<T> offset = origin - sphere.center;
+    T c               = offset.Dot(offset) - sphere.radius * sphere.radius;
+
+    if(c <= 0)
+    {
+        distance = 0;
+        return true;
+    }
+
+    T a = direction.Dot(direction);
+    T b = offset.Dot(direction);
+    T discriminant = b * b - a * c;
+
+    //Outside and moving away, or passing by
+    if(b >= 0 || discriminant < 0)
+    {
+        return false;
+    }
+
+    distance = (-b - Sqrt(discriminant)) / a;
+    return true;
+}
+
+template<typename T>
+constexpr bool Ray<T>::IntersectsPlane(const Plane<T>& plane, T& distance) const
+{
+    T denominator = plane.normal.Dot(direction);
+
+    if(denominator == 0)
+    {
+        return false;
+    }
+
+    T t = -plane.GetSignedDistance(origin) / denominator;
+    if(t < 0)
+    {
+        return false;
+    }
+
+    distance = t;
+    return true;
+}
+
+template<typename T>
+constexpr bool Ray<T>::IntersectsTriangle(const Triangle<T>& triangle, T& distance) const
+{
+    Vector2<T> barycentric;
+
+    return IntersectsTriangle(triangle, distance, barycentric);
+}
+
+//The comparisons are written so that a NaN from a null determinant fails them
+template<typename T>
+constexpr bool Ray<T>::IntersectsTriangle(const Triangle<T>& triangle, T& distance, Vector2<T>& barycentric) const
+{
+    Vector3<T> edge1 = triangle.v1 - triangle.v0;
+    Vector3<T> edge2 = triangle.v2 - triangle.v0;
+    Vector3<T> p     = direction.Cross(edge2);
+    T invDeterminant = 1 / edge1.Dot(p);
+
+    Vector3<T> s = origin - triangle.v0;
+    Vector3<T> q = s.Cross(edge1);
+    T u          = s.Dot(p) * invDeterminant;
+    T v          = direction.Dot(q) * invDeterminant;
+    T t          = edge2.Dot(q) * invDeterminant;
+
+    if(!(u >= 0 && v >= 0 && u + v <= 1 && t >= 0))
+    {
+        return false;
+    }
+
+    distance    = t;
+    barycentric = Vector2<T>(u, v);
+    return true;
+}
+
+} //namespace math
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector3.hpp"
+#include "AABB.hpp"
+
+namespace math
+{
+
+template<typename T>
+struct Sphere
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr Sphere();
+    constexpr Sphere(const Vector3<T>& center, T radius);
+
+    //! Operations
+    constexpr bool    Contains(const Vector3<T>& point) const;
+    constexpr bool    IntersectsSphere(const Sphere& other) const;
+    constexpr bool    IntersectsAABB(const AABB<T>& box) const;
+    constexpr AABB<T> GetBounds() const;
+
+public:
+    Vector3<T> center;
+    T          radius;
+};
+template struct Sphere<float>;
+template struct Sphere<double>;
+
+using Sphere3  = Sphere<float>;
+using Sphere3d = Sphere<double>;
+
+} //namespace math
+
+#include "Sphere.inl"
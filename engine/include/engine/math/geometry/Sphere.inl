@@ -0,0 +1,38 @@
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr Sphere<T>::Sphere() : center{}, radius{} { }
+
+template<typename T>
+constexpr Sphere<T>::Sphere(const Vector3<T>& center, T radius) : center{center}, radius{radius} { }
+
+//! Operations
+template<typename T>
+constexpr bool Sphere<T>::Contains(const Vector3<T>& point) const
+{
+    return (point - center).LengthSquared() <= radius * radius;
+}
+
+template<typename T>
+constexpr bool Sphere<T>::IntersectsSphere(const Sphere<T>& other) const
+{
+    T reach = radius + other.radius;
+
+    return (other.center - center).LengthSquared() <= reach * reach;
+}
+
+template<typename T>
+constexpr bool Sphere<T>::IntersectsAABB(const AABB<T>& box) const
+{
+    return (box.GetClosestPoint(center) - center).LengthSquared() <= radius * radius;
+}
+
+template<typename T>
+constexpr AABB<T> Sphere<T>::GetBounds() const
+{
+    return AABB<T>::CreateFromCenter(center, Vector3<T>(radius));
+}
+
+} //namespace math
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector3.hpp"
+#include "AABB.hpp"
+#include "Plane.hpp"
+
+namespace math
+{
+
+template<typename T>
+struct Triangle
+{
+public:
+    using Type = T;
+
+    //! Constructors
+    constexpr Triangle();
+    constexpr Triangle(const Vector3<T>& v0, const Vector3<T>& v1, const Vector3<T>& v2);
+
+    //! Operations
+    //Counter clockwise winding faces the normal
+    constexpr Vector3<T> GetNormal() const;
+    constexpr T          GetArea() const;
+    constexpr Vector3<T> GetCentroid() const;
+    constexpr AABB<T>    GetBounds() const;
+    constexpr Plane<T>   GetPlane() const;
+    //Closest point of the triangle surface (Ericson, Real-Time Collision Detection 5.1.5)
+    constexpr Vector3<T> GetClosestPoint(const Vector3<T>& point) const;
+
+public:
+    Vector3<T> v0;
+    Vector3<T> v1;
+    Vector3<T> v2;
+};
+template struct Triangle<float>;
+template struct Triangle<double>;
+
+using Triangle3  = Triangle<float>;
+using Triangle3d = Triangle<double>;
+
+} //namespace math
+
+#include "Triangle.inl"
@@ -0,0 +1,96 @@
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr Triangle<T>::Triangle() : v0{}, v1{}, v2{} { }
+
+template<typename T>
+constexpr Triangle<T>::Triangle(const Vector3<T>& v0, const Vector3<T>& v1, const Vector3<T>& v2) : 
+    v0{v0}, v1{v1}, v2{v2} { }
+
+//! Operations
+template<typename T>
+constexpr Vector3<T> Triangle<T>::GetNormal() const
+{
+    return (v1 - v0).Cross(v2 - v0).GetNormalized();
+}
+
+template<typename T>
+constexpr T Triangle<T>::GetArea() const
+{
+    return (v1 - v0).Cross(v2 - v0).Length() * static_cast<T>(0.5);
+}
+
+template<typename T>
+constexpr Vector3<T> Triangle<T>::GetCentroid() const
+{
+    return (v0 + v1 + v2) * (1 / static_cast<T>(3));
+}
+
+template<typename T>
+constexpr AABB<T> Triangle<T>::GetBounds() const
+{
+    return AABB<T>(v0, v0).GetMerged(v1).GetMerged(v2);
+}
+
+template<typename T>
+constexpr Plane<T> Triangle<T>::GetPlane() const
+{
+    return Plane<T>::CreateFromPoints(v0, v1, v2);
+}
+
+//Finds the Voronoi region of the point from the barycentric coordinates
+//of its projection, vertices and edges first and the face last
+template<typename T>
+constexpr Vector3<T> Triangle<T>::GetClosestPoint(const Vector3<T>& point) const
+{
+    Vector3<T> ab = v1 - v0;
+    Vector3<T> ac = v2 - v0;
+    Vector3<T> ap = point - v0;
+    T d1          = ab.Dot(ap);
+    T d2          = ac.Dot(ap);
+    if(d1 <= 0 && d2 <= 0)
+    {
+        return v0;
+    }
+
+    Vector3<T> bp = point - v1;
+    T d3          = ab.Dot(bp);
+    T d4          = ac.Dot(bp);
+    if(d3 >= 0 && d4 <= d3)
+    {
+        return v1;
+    }
+
+    T vc = d1 * d4 - d3 * d2;
+    if(vc <= 0 && d1 >= 0 && d3 <= 0)
+    {
+        return v0 + ab * (d1 / (d1 - d3));
+    }
+
+    Vector3<T> cp = point - v2;
+    T d5          = ab.Dot(cp);
+    T d6          = ac.Dot(cp);
+    if(d6 >= 0 && d5 <= d6)
+    {
+        return v2;
+    }
+
+    T vb = d5 * d2 - d1 * d6;
+    if(vb <= 0 && d2 >= 0 && d6 <= 0)
+    {
+        return v0 + ac * (d2 / (d2 - d6));
+    }
+
+    T va = d3 * d6 - d5 * d4;
+    if(va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+    {
+        return v1 + (v2 - v1) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    T denominator = 1 / (va + vb + vc);
+    return v0 + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
+} //namespace math
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "../vector/Vector3.hpp"
+
+namespace math
+{
+
+template<typename T>
+struct Matrix4;
+
+template<typename T>
+struct Quaternion;
+
+//Column based 3x4 affine matrix. The first three columns hold the linear part
+//and the last one the translation. The implicit last row is (0, 0, 0, 1)
+template<typename T>
+struct AffineTransform
+{
+public:
+    using Type = T;
+    constexpr static int32_t Size        = 3 * 4;
+    constexpr static int32_t SizeInBytes = sizeof(T) * Size;
+    constexpr static int32_t NumColumns  = 4;
+    constexpr static int32_t NumRows     = 3;
+
+    //! Constructors
+    constexpr AffineTransform();
+    constexpr AffineTransform(T m11, T m21, T m31, T m12, T m22, T m32, 
+        T m13, T m23, T m33, T m14, T m24, T m34);
+    constexpr explicit AffineTransform(const Matrix4<T>& m);
+
+    //! Operators
+    constexpr T*               operator[](std::size_t index);
+    constexpr const T*         operator[](std::size_t index) const;
+    constexpr AffineTransform  operator*(const AffineTransform& other) const;
+    constexpr AffineTransform& operator*=(const AffineTransform& other);
+    constexpr bool             operator==(const AffineTransform& other) const;
+    constexpr bool             operator!=(const AffineTransform& other) const;
+
+    //! Operations
+    constexpr T                      Determinant() const;
+    constexpr AffineTransform        GetInverse() const;
+    constexpr AffineTransform        GetOrthonormalInverse() const;
+    constexpr Vector3<T>             GetTranslation() const;
+    constexpr Vector3<T>             TransformPoint(const Vector3<T>& p) const;
+    constexpr Vector3<T>             TransformDirection(const Vector3<T>& d) const;
+    constexpr Matrix4<T>             ToMatrix4() const;
+    constexpr static AffineTransform CreateScale(const Vector3<T>& scale);
+    constexpr static AffineTransform CreateTranslation(const Vector3<T>& translation);
+    constexpr static AffineTransform CreateTransform(const Vector3<T>& scale, 
+        const Quaternion<T>& rotation, const Vector3<T>& translation);
+
+public:
+    T arr[Size];
+};
+
+template struct AffineTransform<float>;
+template struct AffineTransform<double>;
+
+using Affine  = AffineTransform<float>;
+using Affined = AffineTransform<double>;
+
+} //namespace math
+
+#include "AffineTransform.inl"
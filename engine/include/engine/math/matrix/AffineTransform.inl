@@ -0,0 +1,230 @@
+#include "Matrix4.hpp"
+#include "../quat/Quaternion.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr AffineTransform<T>::AffineTransform() : 
+    arr{1, 0, 0,
+        0, 1, 0,
+        0, 0, 1,
+        0, 0, 0} { }
+
+template<typename T>
+constexpr AffineTransform<T>::AffineTransform(T m11, T m21, T m31, T m12, T m22, T m32, 
+        T m13, T m23, T m33, T m14, T m24, T m34) : 
+    arr{m11, m21, m31,
+        m12, m22, m32,
+        m13, m23, m33,
+        m14, m24, m34} { }
+
+template<typename T>
+constexpr AffineTransform<T>::AffineTransform(const Matrix4<T>& m) : 
+    arr{m.arr[0],  m.arr[1],  m.arr[2],
+        m.arr[4],  m.arr[5],  m.arr[6],
+        m.arr[8],  m.arr[9],  m.arr[10],
+        m.arr[12], m.arr[13], m.arr[14]} { }
+
+//! Operators
+template<typename T>
+constexpr T* AffineTransform<T>::operator[](std::size_t index)
+{
+    return &arr[index * NumRows];
+}
+
+template<typename T>
+constexpr const T* AffineTransform<T>::operator[](std::size_t index) const
+{
+    return &arr[index * NumRows];
+}
+
+//36 multiplications instead of the 64 of a full 4x4 product
+template<typename T>
+constexpr AffineTransform<T> AffineTransform<T>::operator*(const AffineTransform<T>& other) const
+{
+    const T* o = other.arr;
+
+    return AffineTransform(
+        arr[0] * o[0]  + arr[3] * o[1]  + arr[6] * o[2],
+        arr[1] * o[0]  + arr[4] * o[1]  + arr[7] * o[2],
+        arr[2] * o[0]  + arr[5] * o[1]  + arr[8] * o[2],
+        arr[0] * o[3]  + arr[3] * o[4]  + arr[6] * o[5],
+        arr[1] * o[3]  + arr[4] * o[4]  + arr[7] * o[5],
+        arr[2] * o[3]  + arr[5] * o[4]  + arr[8] * o[5],
+        arr[0] * o[6]  + arr[3] * o[7]  + arr[6] * o[8],
+        arr[1] * o[6]  + arr[4] * o[7]  + arr[7] * o[8],
+        arr[2] * o[6]  + arr[5] * o[7]  + arr[8] * o[8],
+        arr[0] * o[9]  + arr[3] * o[10] + arr[6] * o[11] + arr[9],
+        arr[1] * o[9]  + arr[4] * o[10] + arr[7] * o[11] + arr[10],
+        arr[2] * o[9]  + arr[5] * o[10] + arr[8] * o[11] + arr[11]
+    );
+}
+
+template<typename T>
+constexpr AffineTransform<T>& AffineTransform<T>::operator*=(const AffineTransform<T>& other)
+{
+    *this = *this * other;
+
+    return *this;
+}
+
+template<typename T>
+constexpr bool AffineTransform<T>::operator==(const AffineTransform<T>& other) const
+{
+    for(int32_t i = 0; i < Size; ++i)
+    {
+        if(arr[i] != other.arr[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+constexpr bool AffineTransform<T>::operator!=(const AffineTransform<T>& other) const
+{
+    return !(*this == other);
+}
+
+//! Operations
+template<typename T>
+constexpr T AffineTransform<T>::Determinant() const
+{
+    return arr[0] * (arr[4] * arr[8] - arr[5] * arr[7]) -
+           arr[3] * (arr[1] * arr[8] - arr[2] * arr[7]) +
+           arr[6] * (arr[1] * arr[5] - arr[2] * arr[4]);
+}
+
+//Inverse of the linear part from the cross products of its columns, then
+//the translation is transformed back by it
+template<typename T>
+constexpr AffineTransform<T> AffineTransform<T>::GetInverse() const
+{
+    //Rows of the inverse before the division by the determinant
+    T r00 = arr[4] * arr[8] - arr[5] * arr[7];
+    T r01 = arr[5] * arr[6] - arr[3] * arr[8];
+    T r02 = arr[3] * arr[7] - arr[4] * arr[6];
+    T r10 = arr[7] * arr[2] - arr[8] * arr[1];
+    T r11 = arr[8] * arr[0] - arr[6] * arr[2];
+    T r12 = arr[6] * arr[1] - arr[7] * arr[0];
+    T r20 = arr[1] * arr[5] - arr[2] * arr[4];
+    T r21 = arr[2] * arr[3] - arr[0] * arr[5];
+    T r22 = arr[0] * arr[4] - arr[1] * arr[3];
+
+    T invDet = 1 / (arr[0] * r00 + arr[1] * r01 + arr[2] * r02);
+
+    return AffineTransform(
+        r00 * invDet, r10 * invDet, r20 * invDet,
+        r01 * invDet, r11 * invDet, r21 * invDet,
+        r02 * invDet, r12 * invDet, r22 * invDet,
+        -(r00 * arr[9] + r01 * arr[10] + r02 * arr[11]) * invDet,
+        -(r10 * arr[9] + r11 * arr[10] + r12 * arr[11]) * invDet,
+        -(r20 * arr[9] + r21 * arr[10] + r22 * arr[11]) * invDet
+    );
+}
+
+//Only valid for rotation plus translation (no scale or shear)
+template<typename T>
+constexpr AffineTransform<T> AffineTransform<T>::GetOrthonormalInverse() const
+{
+    return AffineTransform(
+        arr[0], arr[3], arr[6],
+        arr[1], arr[4], arr[7],
+        arr[2], arr[5], arr[8],
+        -(arr[0] * arr[9] + arr[1] * arr[10] + arr[2] * arr[11]),
+        -(arr[3] * arr[9] + arr[4] * arr[10] + arr[5] * arr[11]),
+        -(arr[6] * arr[9] + arr[7] * arr[10] + arr[8] * arr[11])
+    );
+}
+
+template<typename T>
+constexpr Vector3<T> AffineTransform<T>::GetTranslation() const
+{
+    return Vector3<T>(arr[9], arr[10], arr[11]);
+}
+
+template<typename T>
+constexpr Vector3<T> AffineTransform<T>::TransformPoint(const Vector3<T>& p) const
+{
+    return Vector3<T>(
+        arr[0] * p.x + arr[3] * p.y + arr[6] * p.z + arr[9],
+        arr[1] * p.x + arr[4] * p.y + arr[7] * p.z + arr[10],
+        arr[2] * p.x + arr[5] * p.y + arr[8] * p.z + arr[11]
+    );
+}
+
+template<typename T>
+constexpr Vector3<T> AffineTransform<T>::TransformDirection(const Vector3<T>& d) const
+{
+    return Vector3<T>(
+        arr[0] * d.x + arr[3] * d.y + arr[6] * d.z,
+        arr[1] * d.x + arr[4] * d.y + arr[7] * d.z,
+        arr[2] * d.x + arr[5] * d.y + arr[8] * d.z
+    );
+}
+
+template<typename T>
+constexpr Matrix4<T> AffineTransform<T>::ToMatrix4() const
+{
+    return Matrix4<T>(
+        arr[0], arr[1],  arr[2],  0,
+        arr[3], arr[4],  arr[5],  0,
+        arr[6], arr[7],  arr[8],  0,
+        arr[9], arr[10], arr[11], 1
+    );
+}
+
+template<typename T>
+constexpr AffineTransform<T> AffineTransform<T>::CreateScale(const Vector3<T>& scale)
+{
+    return AffineTransform(
+        scale.x, 0, 0,
+        0, scale.y, 0,
+        0, 0, scale.z,
+        0, 0, 0
+    );
+}
+
+template<typename T>
+constexpr AffineTransform<T> AffineTransform<T>::CreateTranslation(const Vector3<T>& translation)
+{
+    return AffineTransform(
+        1, 0, 0,
+        0, 1, 0,
+        0, 0, 1,
+        translation.x, translation.y, translation.z
+    );
+}
+
+template<typename T>
+constexpr AffineTransform<T> AffineTransform<T>::CreateTransform(const Vector3<T>& scale, 
+    const Quaternion<T>& rotation, const Vector3<T>& translation)
+{
+    const Quaternion<T>& q = rotation;
+    T ww = q.w * q.w;
+    T xy = q.x * q.y;
+    T xz = q.x * q.z;
+    T xw = q.x * q.w;
+    T yz = q.y * q.z;
+    T yw = q.y * q.w;
+    T zw = q.z * q.w;
+
+    return AffineTransform(
+        (2 * (ww + q.x * q.x) - 1) * scale.x,
+        2 * (xy + zw) * scale.x,
+        2 * (xz - yw) * scale.x,
+        2 * (xy - zw) * scale.y,
+        (2 * (ww + q.y * q.y) - 1) * scale.y,
+        2 * (yz + xw) * scale.y,
+        2 * (xz + yw) * scale.z,
+        2 * (yz - xw) * scale.z,
+        (2 * (ww + q.z * q.z) - 1) * scale.z,
+        translation.x, translation.y, translation.z
+    );
+}
+
+} //namespace math
@@ -1,4 +1,5 @@
 #include <cmath>
+#include "../Functions.hpp"
 
 namespace math
 {
@@ -212,8 +213,8 @@ constexpr Matrix2<T> Matrix2<T>::GetScaled(const Vector2<T> scale) const
 template<typename T>
 constexpr Matrix2<T> Matrix2<T>::GetRotated(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix2(
          arr[0] * cos + arr[2] * sin,
@@ -235,8 +236,8 @@ constexpr Matrix2<T> Matrix2<T>::CreateScale(const Vector2<T> scale)
 template<typename T>
 constexpr Matrix2<T> Matrix2<T>::CreateRotation(T radians)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix2(
          cos, sin,
@@ -1,4 +1,5 @@
 #include <cmath>
+#include "../Functions.hpp"
 
 namespace math
 {
@@ -320,8 +321,8 @@ constexpr Matrix3<T> Matrix3<T>::GetScaled2D(const Vector2<T> scale) const
 template<typename T>
 constexpr Matrix3<T> Matrix3<T>::GetRotatedX(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix3(
         arr[0],
@@ -339,8 +340,8 @@ constexpr Matrix3<T> Matrix3<T>::GetRotatedX(T radians) const
 template<typename T>
 constexpr Matrix3<T> Matrix3<T>::GetRotatedY(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix3(
         arr[0] * cos - arr[6] * sin,
@@ -358,8 +359,8 @@ constexpr Matrix3<T> Matrix3<T>::GetRotatedY(T radians) const
 template<typename T>
 constexpr Matrix3<T> Matrix3<T>::GetRotatedZ(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix3(
         arr[0] *  cos + arr[3] * sin,
@@ -413,8 +414,8 @@ constexpr Matrix3<T> Matrix3<T>::CreateScale2D(const Vector2<T> scale)
 template<typename T>
 constexpr Matrix3<T> Matrix3<T>::CreateRotationX(T radians)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix3(
         1,  0, 0,
@@ -426,8 +427,8 @@ constexpr Matrix3<T> Matrix3<T>::CreateRotationX(T radians)
 template<typename T>
 constexpr Matrix3<T> Matrix3<T>::CreateRotationY(T radians)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix3(
         cos, 0, -sin,
@@ -439,8 +440,8 @@ constexpr Matrix3<T> Matrix3<T>::CreateRotationY(T radians)
 template<typename T>
 constexpr Matrix3<T> Matrix3<T>::CreateRotationZ(T radians)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix3(
         cos,  sin, 0,
@@ -463,8 +464,8 @@ template<typename T>
 constexpr Matrix3<T> Matrix3<T>::CreateTransform2D(const Vector2<T> scale, 
     T radians, const Vector2<T> translation)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix3(
         cos * scale.x, sin * scale.x, 0,
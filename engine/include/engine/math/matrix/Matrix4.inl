@@ -1,7 +1,10 @@
 #include <cmath>
+#include <type_traits>
+#include "../Functions.hpp"
+#include "../simd/Matrix4Simd.hpp"
 #include "../vector/Vector3.hpp"
 #include "../vector/Vector4.hpp"
-#include "../quat/quaternion.hpp"
+#include "../quat/Quaternion.hpp"
 
 namespace math
 {
@@ -166,6 +169,18 @@ constexpr Vector4<T> Matrix4<T>::operator*(const Vector4<T>& v) const
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::operator*(const Matrix4<T>& other) const
 {
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if !consteval
+        {
+            Matrix4 m;
+            simd::Matrix4Multiply(arr, other.arr, m.arr);
+            return m;
+        }
+    }
+#endif
+
     return Matrix4(
         arr[0] * other.arr[0]  + arr[4] * other.arr[1]  + arr[8]  * other.arr[2]  + arr[12] * other.arr[3],
         arr[1] * other.arr[0]  + arr[5] * other.arr[1]  + arr[9]  * other.arr[2]  + arr[13] * other.arr[3],
@@ -189,6 +204,17 @@ constexpr Matrix4<T> Matrix4<T>::operator*(const Matrix4<T>& other) const
 template<typename T>
 constexpr Matrix4<T>& Matrix4<T>::operator*=(const Matrix4<T>& other)
 {
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if !consteval
+        {
+            simd::Matrix4Multiply(arr, other.arr, arr);
+            return *this;
+        }
+    }
+#endif
+
     //Row 1
     T val1 = arr[0] * other.arr[0]  + arr[4] * other.arr[1]  + arr[8] * other.arr[2]  + arr[12] * other.arr[3];
     T val2 = arr[0] * other.arr[4]  + arr[4] * other.arr[5]  + arr[8] * other.arr[6]  + arr[12] * other.arr[7];
@@ -342,6 +368,18 @@ constexpr T Matrix4<T>::Determinant() const
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::GetInverse() const
 {
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if !consteval
+        {
+            Matrix4 m;
+            simd::Matrix4Inverse(arr, m.arr);
+            return m;
+        }
+    }
+#endif
+
     T b12 = arr[0] * arr[5]  - arr[1] * arr[4];
     T b13 = arr[0] * arr[9]  - arr[1] * arr[8];
     T b14 = arr[0] * arr[13] - arr[1] * arr[12];
@@ -429,8 +467,8 @@ constexpr Matrix4<T> Matrix4<T>::GetScaled(const Vector3<T>& scale) const
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::GetRotatedX(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix4(
         arr[0],
@@ -439,8 +477,8 @@ constexpr Matrix4<T> Matrix4<T>::GetRotatedX(T radians) const
         arr[3],
         arr[4] *  cos + arr[8]  * sin,
         arr[5] *  cos + arr[9]  * sin,
-        arr[6] *  cos + arr[10] * cos,
-        arr[7] *  cos + arr[11] * cos,
+        arr[6] *  cos + arr[10] * sin,
+        arr[7] *  cos + arr[11] * sin,
         arr[4] * -sin + arr[8]  * cos,
         arr[5] * -sin + arr[9]  * cos,
         arr[6] * -sin + arr[10] * cos,
@@ -455,8 +493,8 @@ constexpr Matrix4<T> Matrix4<T>::GetRotatedX(T radians) const
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::GetRotatedY(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix4(
         arr[0] * cos - arr[8]  * sin,
@@ -481,8 +519,8 @@ constexpr Matrix4<T> Matrix4<T>::GetRotatedY(T radians) const
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::GetRotatedZ(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix4(
         arr[0] *  cos + arr[4] * sin,
@@ -541,8 +579,8 @@ constexpr Matrix4<T> Matrix4<T>::CreateScale(const Vector3<T>& scale)
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::CreateRotationX(T radians)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix4(
         1,  0, 0, 0,
@@ -555,8 +593,8 @@ constexpr Matrix4<T> Matrix4<T>::CreateRotationX(T radians)
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::CreateRotationY(T radians)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix4(
         cos, 0, -sin, 0,
@@ -569,8 +607,8 @@ constexpr Matrix4<T> Matrix4<T>::CreateRotationY(T radians)
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::CreateRotationZ(T radians)
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
     return Matrix4(
         cos,  sin, 0, 0,
@@ -615,7 +653,7 @@ constexpr Matrix4<T> Matrix4<T>::CreateLookAt(const Vector3<T>& center,
 template<typename T>
 constexpr Matrix4<T> Matrix4<T>::CreatePerspective(T near, T far, T fov, T aspect)
 {
-    T a   = 1 / std::tan(fov * 0.5);
+    T a   = 1 / Tan(fov * 0.5);
     T div = 1 / (near - far);
     T c   = far * div;
     T d   = (far * near) * div;
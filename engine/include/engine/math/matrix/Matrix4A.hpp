@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "Matrix4.hpp"
+#include "../vector/Vector4A.hpp"
+#include "../simd/Simd.hpp"
+
+#if MATH_SIMD_SSE
+
+namespace math
+{
+
+struct QuaternionA;
+
+//32 byte aligned column based float 4x4 matrix held in 4 SSE registers
+struct alignas(32) Matrix4A
+{
+public:
+    using Type = float;
+    constexpr static int32_t Size        = 4 * 4;
+    constexpr static int32_t SizeInBytes = sizeof(float) * Size;
+    constexpr static int32_t NumColumns  = 4;
+
+    //! Constructors
+    Matrix4A();
+    Matrix4A(float value);
+    Matrix4A(float m11, float m22, float m33, float m44);
+    Matrix4A(float m11, float m21, float m31, float m41, float m12, float m22, float m32, float m42, 
+        float m13, float m23, float m33, float m43, float m14, float m24, float m34, float m44);
+    Matrix4A(__m128 c0, __m128 c1, __m128 c2, __m128 c3);
+    Matrix4A(const Matrix4<float>& m);
+
+    //! Operators
+    float*       operator[](std::size_t index);
+    const float* operator[](std::size_t index) const;
+    Matrix4A     operator+(const Matrix4A& other) const;
+    Matrix4A&    operator+=(const Matrix4A& other);
+    Matrix4A     operator-(const Matrix4A& other) const;
+    Matrix4A&    operator-=(const Matrix4A& other);
+    Matrix4A     operator*(const float value) const;
+    Matrix4A&    operator*=(const float value);
+    Matrix4A     operator*(const Matrix4A& other) const;
+    Matrix4A&    operator*=(const Matrix4A& other);
+    Vector4A     operator*(const Vector4A v) const;
+    Matrix4A     operator/(const float value) const;
+    Matrix4A&    operator/=(const float value);
+    bool         operator==(const Matrix4A& other) const;
+    bool         operator!=(const Matrix4A& other) const;
+
+    //! Operations
+    float           Determinant() const;
+    Matrix4A        GetInverse() const;
+    Matrix4A        GetTranspose() const;
+    Matrix4A        GetScaled(const Vector3<float>& scale) const;
+    Matrix4A        GetRotatedX(float radians) const;
+    Matrix4A        GetRotatedY(float radians) const;
+    Matrix4A        GetRotatedZ(float radians) const;
+    Matrix4A        GetTranslated(const Vector3<float>& translation) const;
+    Matrix4<float>  ToMatrix4() const;
+    static Matrix4A CreateScale(const Vector3<float>& scale);
+    static Matrix4A CreateRotationX(float radians);
+    static Matrix4A CreateRotationY(float radians);
+    static Matrix4A CreateRotationZ(float radians);
+    static Matrix4A CreateTranslation(const Vector3<float>& v);
+    static Matrix4A CreateLookAt(const Vector3<float>& center, const Vector3<float>& target, 
+        const Vector3<float>& up);
+    static Matrix4A CreatePerspective(float near, float far, float fov, float aspect);
+    static Matrix4A CreateTransform(const Vector3<float>& scale, const QuaternionA& rotation, 
+        const Vector3<float>& translation);
+
+public:
+    __m128 cols[NumColumns];
+};
+
+using Mat4A = Matrix4A;
+
+} //namespace math
+
+#include "Matrix4A.inl"
+
+#endif
@@ -0,0 +1,294 @@
+#include <cmath>
+#include "../simd/Matrix4Simd.hpp"
+#include "../quat/QuaternionA.hpp"
+
+namespace math
+{
+
+//! Constructors
+inline Matrix4A::Matrix4A() : Matrix4A(1.0f) { }
+
+inline Matrix4A::Matrix4A(float value) : Matrix4A(value, value, value, value) { }
+
+inline Matrix4A::Matrix4A(float m11, float m22, float m33, float m44) : 
+    cols{_mm_setr_ps(m11, 0, 0, 0),
+         _mm_setr_ps(0, m22, 0, 0),
+         _mm_setr_ps(0, 0, m33, 0),
+         _mm_setr_ps(0, 0, 0, m44)} { }
+
+inline Matrix4A::Matrix4A(float m11, float m21, float m31, float m41, float m12, float m22, float m32, float m42, 
+        float m13, float m23, float m33, float m43, float m14, float m24, float m34, float m44) : 
+    cols{_mm_setr_ps(m11, m21, m31, m41),
+         _mm_setr_ps(m12, m22, m32, m42),
+         _mm_setr_ps(m13, m23, m33, m43),
+         _mm_setr_ps(m14, m24, m34, m44)} { }
+
+inline Matrix4A::Matrix4A(__m128 c0, __m128 c1, __m128 c2, __m128 c3) : cols{c0, c1, c2, c3} { }
+
+inline Matrix4A::Matrix4A(const Matrix4<float>& m) : 
+    cols{_mm_loadu_ps(m.arr),
+         _mm_loadu_ps(m.arr + 4),
+         _mm_loadu_ps(m.arr + 8),
+         _mm_loadu_ps(m.arr + 12)} { }
+
+//! Operators
+inline float* Matrix4A::operator[](std::size_t index)
+{
+    return reinterpret_cast<float*>(&cols[index]);
+}
+
+inline const float* Matrix4A::operator[](std::size_t index) const
+{
+    return reinterpret_cast<const float*>(&cols[index]);
+}
+
+inline Matrix4A Matrix4A::operator+(const Matrix4A& other) const
+{
+    return Matrix4A(
+        _mm_add_ps(cols[0], other.cols[0]),
+        _mm_add_ps(cols[1], other.cols[1]),
+        _mm_add_ps(cols[2], other.cols[2]),
+        _mm_add_ps(cols[3], other.cols[3])
+    );
+}
+
+inline Matrix4A& Matrix4A::operator+=(const Matrix4A& other)
+{
+    cols[0] = _mm_add_ps(cols[0], other.cols[0]);
+    cols[1] = _mm_add_ps(cols[1], other.cols[1]);
+    cols[2] = _mm_add_ps(cols[2], other.cols[2]);
+    cols[3] = _mm_add_ps(cols[3], other.cols[3]);
+
+    return *this;
+}
+
+inline Matrix4A Matrix4A::operator-(const Matrix4A& other) const
+{
+    return Matrix4A(
+        _mm_sub_ps(cols[0], other.cols[0]),
+        _mm_sub_ps(cols[1], other.cols[1]),
+        _mm_sub_ps(cols[2], other.cols[2]),
+        _mm_sub_ps(cols[3], other.cols[3])
+    );
+}
+
+inline Matrix4A& Matrix4A::operator-=(const Matrix4A& other)
+{
+    cols[0] = _mm_sub_ps(cols[0], other.cols[0]);
+    cols[1] = _mm_sub_ps(cols[1], other.cols[1]);
+    cols[2] = _mm_sub_ps(cols[2], other.cols[2]);
+    cols[3] = _mm_sub_ps(cols[3], other.cols[3]);
+
+    return *this;
+}
+
+inline Matrix4A Matrix4A::operator*(const float value) const
+{
+    __m128 s = _mm_set1_ps(value);
+
+    return Matrix4A(
+        _mm_mul_ps(cols[0], s),
+        _mm_mul_ps(cols[1], s),
+        _mm_mul_ps(cols[2], s),
+        _mm_mul_ps(cols[3], s)
+    );
+}
+
+inline Matrix4A& Matrix4A::operator*=(const float value)
+{
+    __m128 s = _mm_set1_ps(value);
+
+    cols[0] = _mm_mul_ps(cols[0], s);
+    cols[1] = _mm_mul_ps(cols[1], s);
+    cols[2] = _mm_mul_ps(cols[2], s);
+    cols[3] = _mm_mul_ps(cols[3], s);
+
+    return *this;
+}
+
+inline Matrix4A Matrix4A::operator*(const Matrix4A& other) const
+{
+    Matrix4A m;
+    simd::Matrix4Multiply((*this)[0], other[0], m[0]);
+
+    return m;
+}
+
+inline Matrix4A& Matrix4A::operator*=(const Matrix4A& other)
+{
+    simd::Matrix4Multiply((*this)[0], other[0], (*this)[0]);
+
+    return *this;
+}
+
+inline Vector4A Matrix4A::operator*(const Vector4A v) const
+{
+    __m128 r = _mm_mul_ps(cols[0], simd::Splat<0>(v.v));
+    r = simd::MulAdd(cols[1], simd::Splat<1>(v.v), r);
+    r = simd::MulAdd(cols[2], simd::Splat<2>(v.v), r);
+    r = simd::MulAdd(cols[3], simd::Splat<3>(v.v), r);
+
+    return r;
+}
+
+inline Matrix4A Matrix4A::operator/(const float value) const
+{
+    return *this * (1 / value);
+}
+
+inline Matrix4A& Matrix4A::operator/=(const float value)
+{
+    return *this *= (1 / value);
+}
+
+inline bool Matrix4A::operator==(const Matrix4A& other) const
+{
+    __m128 eq = _mm_and_ps(
+        _mm_and_ps(_mm_cmpeq_ps(cols[0], other.cols[0]), _mm_cmpeq_ps(cols[1], other.cols[1])),
+        _mm_and_ps(_mm_cmpeq_ps(cols[2], other.cols[2]), _mm_cmpeq_ps(cols[3], other.cols[3])));
+
+    return _mm_movemask_ps(eq) == 0xF;
+}
+
+inline bool Matrix4A::operator!=(const Matrix4A& other) const
+{
+    return !(*this == other);
+}
+
+//! Operations
+inline float Matrix4A::Determinant() const
+{
+    return ToMatrix4().Determinant();
+}
+
+inline Matrix4A Matrix4A::GetInverse() const
+{
+    Matrix4A m;
+    simd::Matrix4Inverse((*this)[0], m[0]);
+
+    return m;
+}
+
+inline Matrix4A Matrix4A::GetTranspose() const
+{
+    Matrix4A m(*this);
+    _MM_TRANSPOSE4_PS(m.cols[0], m.cols[1], m.cols[2], m.cols[3]);
+
+    return m;
+}
+
+inline Matrix4A Matrix4A::GetScaled(const Vector3<float>& scale) const
+{
+    return Matrix4A(
+        _mm_mul_ps(cols[0], _mm_set1_ps(scale.x)),
+        _mm_mul_ps(cols[1], _mm_set1_ps(scale.y)),
+        _mm_mul_ps(cols[2], _mm_set1_ps(scale.z)),
+        cols[3]
+    );
+}
+
+inline Matrix4A Matrix4A::GetRotatedX(float radians) const
+{
+    __m128 cos = _mm_set1_ps(std::cos(radians));
+    __m128 sin = _mm_set1_ps(std::sin(radians));
+
+    return Matrix4A(
+        cols[0],
+        simd::MulAdd(cols[2], sin, _mm_mul_ps(cols[1], cos)),
+        _mm_sub_ps(_mm_mul_ps(cols[2], cos), _mm_mul_ps(cols[1], sin)),
+        cols[3]
+    );
+}
+
+inline Matrix4A Matrix4A::GetRotatedY(float radians) const
+{
+    __m128 cos = _mm_set1_ps(std::cos(radians));
+    __m128 sin = _mm_set1_ps(std::sin(radians));
+
+    return Matrix4A(
+        _mm_sub_ps(_mm_mul_ps(cols[0], cos), _mm_mul_ps(cols[2], sin)),
+        cols[1],
+        simd::MulAdd(cols[0], sin, _mm_mul_ps(cols[2], cos)),
+        cols[3]
+    );
+}
+
+inline Matrix4A Matrix4A::GetRotatedZ(float radians) const
+{
+    __m128 cos = _mm_set1_ps(std::cos(radians));
+    __m128 sin = _mm_set1_ps(std::sin(radians));
+
+    return Matrix4A(
+        simd::MulAdd(cols[1], sin, _mm_mul_ps(cols[0], cos)),
+        _mm_sub_ps(_mm_mul_ps(cols[1], cos), _mm_mul_ps(cols[0], sin)),
+        cols[2],
+        cols[3]
+    );
+}
+
+inline Matrix4A Matrix4A::GetTranslated(const Vector3<float>& translation) const
+{
+    __m128 c3 = simd::MulAdd(cols[0], _mm_set1_ps(translation.x), cols[3]);
+    c3 = simd::MulAdd(cols[1], _mm_set1_ps(translation.y), c3);
+    c3 = simd::MulAdd(cols[2], _mm_set1_ps(translation.z), c3);
+
+    return Matrix4A(cols[0], cols[1], cols[2], c3);
+}
+
+inline Matrix4<float> Matrix4A::ToMatrix4() const
+{
+    Matrix4<float> m;
+    _mm_storeu_ps(m.arr,      cols[0]);
+    _mm_storeu_ps(m.arr + 4,  cols[1]);
+    _mm_storeu_ps(m.arr + 8,  cols[2]);
+    _mm_storeu_ps(m.arr + 12, cols[3]);
+
+    return m;
+}
+
+inline Matrix4A Matrix4A::CreateScale(const Vector3<float>& scale)
+{
+    return Matrix4A(scale.x, scale.y, scale.z, 1.0f);
+}
+
+inline Matrix4A Matrix4A::CreateRotationX(float radians)
+{
+    return Matrix4<float>::CreateRotationX(radians);
+}
+
+inline Matrix4A Matrix4A::CreateRotationY(float radians)
+{
+    return Matrix4<float>::CreateRotationY(radians);
+}
+
+inline Matrix4A Matrix4A::CreateRotationZ(float radians)
+{
+    return Matrix4<float>::CreateRotationZ(radians);
+}
+
+inline Matrix4A Matrix4A::CreateTranslation(const Vector3<float>& v)
+{
+    return Matrix4<float>::CreateTranslation(v);
+}
+
+inline Matrix4A Matrix4A::CreateLookAt(const Vector3<float>& center, const Vector3<float>& target, 
+    const Vector3<float>& up)
+{
+    return Matrix4<float>::CreateLookAt(center, target, up);
+}
+
+inline Matrix4A Matrix4A::CreatePerspective(float near, float far, float fov, float aspect)
+{
+    return Matrix4<float>::CreatePerspective(near, far, fov, aspect);
+}
+
+inline Matrix4A Matrix4A::CreateTransform(const Vector3<float>& scale, const QuaternionA& rotation, 
+    const Vector3<float>& translation)
+{
+    Matrix4A m = rotation.ToMatrix4().GetScaled(scale);
+    m.cols[3]  = _mm_setr_ps(translation.x, translation.y, translation.z, 1.0f);
+
+    return m;
+}
+
+} //namespace math
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "../vector/Vector4.hpp"
+
+namespace math
+{
+
+enum class NoiseType
+{
+    //Perlin noise, interpolated gradients of the 2^Dim corners of a cube cell
+    Gradient,
+    //Sum of the Dim + 1 corners of a simplex cell, cheaper in 3D and 4D and
+    //without the axis aligned artifacts
+    Simplex
+};
+
+enum class FractalType
+{
+    //A single octave
+    None,
+    //Fractional Brownian motion, octaves summed as they are
+    Fbm,
+    //Octaves folded to (1 - |n|)^2, sharp crests for mountains and veins
+    Ridged
+};
+
+//Noise sampled by the batched functions. Octave o is taken at frequency *
+//lacunarity^o with seed + o and weighted by gain^o, the sum is divided by
+//the total weight so every combination stays around [-1, 1]
+struct NoiseSettings
+{
+    NoiseType   type       = NoiseType::Simplex;
+    FractalType fractal    = FractalType::Fbm;
+    int32_t     seed       = 0;
+    int32_t     octaves    = 4;
+    float       frequency  = 1;
+    float       lacunarity = 2;
+    float       gain       = 0.5f;
+};
+
+//! Single octave
+//Lattice noise in about [-1, 1], 0 on every integer position for gradient
+//noise. Positions must stay within +-2^31
+float GradientNoise(const Vector2<float>& position, int32_t seed = 0);
+float GradientNoise(const Vector3<float>& position, int32_t seed = 0);
+float GradientNoise(const Vector4<float>& position, int32_t seed = 0);
+float SimplexNoise(const Vector2<float>& position, int32_t seed = 0);
+float SimplexNoise(const Vector3<float>& position, int32_t seed = 0);
+float SimplexNoise(const Vector4<float>& position, int32_t seed = 0);
+
+//! Fractal
+float SampleNoise(const NoiseSettings& settings, const Vector2<float>& position);
+float SampleNoise(const NoiseSettings& settings, const Vector3<float>& position);
+float SampleNoise(const NoiseSettings& settings, const Vector4<float>& position);
+
+//! Batched sampling
+//4 (SSE) or 8 (AVX2) positions at a time. The output span must be at least
+//as big as the input span
+void SampleNoise(const NoiseSettings& settings, std::span<const Vector2<float>> positions, std::span<float> output);
+void SampleNoise(const NoiseSettings& settings, std::span<const Vector3<float>> positions, std::span<float> output);
+void SampleNoise(const NoiseSettings& settings, std::span<const Vector4<float>> positions, std::span<float> output);
+
+//Heightfields and density maps, output[y * width + x] is the noise at
+//origin + (x, y) * spacing. Rows are split over threadCount threads including
+//the calling one, 0 uses every hardware thread
+void FillNoiseGrid(const NoiseSettings& settings, std::span<float> output, uint32_t width, uint32_t height,
+    const Vector2<float>& origin, const Vector2<float>& spacing, uint32_t threadCount = 1);
+//Volumes, output[(z * height + y) * width + x] is the noise at origin +
+//(x, y, z) * spacing
+void FillNoiseGrid(const NoiseSettings& settings, std::span<float> output, uint32_t width, uint32_t height,
+    uint32_t depth, const Vector3<float>& origin, const Vector3<float>& spacing, uint32_t threadCount = 1);
+
+} //namespace math
+
+#include "Noise.inl"
@@ -0,0 +1,414 @@
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include "../Parallel.hpp"
+#include "../simd/NoiseSimd.hpp"
+
+namespace math
+{
+
+namespace detail
+{
+
+//! Scalar noise, the same operations as simd/NoiseSimd.hpp. The hash bits are
+//random so everything they pick is indexed or masked instead of branched on
+inline void Floor(float x, float& floor, int32_t& floorInt)
+{
+    floorInt = static_cast<int32_t>(x);
+    floor    = static_cast<float>(floorInt);
+
+    int32_t below = x < floor;
+    floorInt     -= below;
+    floor        -= static_cast<float>(below);
+}
+
+inline uint32_t FinishNoiseHash(uint32_t hash)
+{
+    hash *= simd::NoiseHashMultiplier;
+    return hash ^ (hash >> 15);
+}
+
+inline float FlipSign(float value, uint32_t hash, int32_t bit)
+{
+    return std::bit_cast<float>(std::bit_cast<uint32_t>(value) ^ (((hash >> bit) & 1) << 31));
+}
+
+template<int32_t Dim>
+float NoiseGradient(uint32_t hash, const float (&offset)[Dim])
+{
+    if constexpr (Dim == 2)
+    {
+        float u = offset[hash & 1];
+        float v = offset[~hash & 1];
+
+        return FlipSign(u, hash, 1) + FlipSign(v + v, hash, 2);
+    }
+    else if constexpr (Dim == 3)
+    {
+        //u is x below 8 and y above, v is y below 4, x for 12 and 14, z otherwise
+        constexpr uint8_t U[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1 };
+        constexpr uint8_t V[16] = { 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2 };
+
+        return FlipSign(offset[U[hash & 15]], hash, 0) + FlipSign(offset[V[hash & 15]], hash, 1);
+    }
+    else
+    {
+        //Bits 3 and 4 pick the axis the gradient is 0 on
+        constexpr uint8_t A[4] = { 1, 0, 0, 0 };
+        constexpr uint8_t B[4] = { 2, 2, 1, 1 };
+        constexpr uint8_t C[4] = { 3, 3, 3, 2 };
+
+        uint32_t axis = (hash >> 3) & 3;
+        return FlipSign(offset[A[axis]], hash, 0) + FlipSign(offset[B[axis]], hash, 1) +
+            FlipSign(offset[C[axis]], hash, 2);
+    }
+}
+
+template<int32_t Dim>
+float GradientNoise(const float (&position)[Dim], uint32_t seed)
+{
+    constexpr int32_t Corners = 1 << Dim;
+
+    float offset[Dim], fade[Dim];
+    uint32_t primed[Dim];
+
+    for(int32_t axis = 0; axis < Dim; ++axis)
+    {
+        float floor;
+        int32_t floorInt;
+        Floor(position[axis], floor, floorInt);
+
+        float t      = position[axis] - floor;
+        offset[axis] = t;
+        fade[axis]   = t * t * t * (t * (t * 6 - 15) + 10);
+        primed[axis] = static_cast<uint32_t>(floorInt) * simd::NoisePrimes[axis];
+    }
+
+    float values[Corners];
+    for(int32_t corner = 0; corner < Corners; ++corner)
+    {
+        uint32_t hash = seed;
+        float d[Dim];
+
+        for(int32_t axis = 0; axis < Dim; ++axis)
+        {
+            bool step = (corner >> axis) & 1;
+            hash     ^= step ? primed[axis] + simd::NoisePrimes[axis] : primed[axis];
+            d[axis]   = step ? offset[axis] - 1 : offset[axis];
+        }
+
+        values[corner] = NoiseGradient<Dim>(FinishNoiseHash(hash), d);
+    }
+
+    for(int32_t axis = 0, count = Corners / 2; axis < Dim; ++axis, count /= 2)
+    {
+        for(int32_t i = 0; i < count; ++i)
+        {
+            values[i] = (values[i * 2 + 1] - values[i * 2]) * fade[axis] + values[i * 2];
+        }
+    }
+
+    return values[0] * simd::GradientNoiseScale[Dim];
+}
+
+template<int32_t Dim>
+float SimplexNoise(const float (&position)[Dim], uint32_t seed)
+{
+    float sum = position[0];
+    for(int32_t axis = 1; axis < Dim; ++axis)
+    {
+        sum += position[axis];
+    }
+
+    float skew    = sum * simd::SimplexSkew[Dim];
+    float cellSum = 0;
+    float cell[Dim], offset[Dim];
+    uint32_t primed[Dim];
+
+    for(int32_t axis = 0; axis < Dim; ++axis)
+    {
+        int32_t floorInt;
+        Floor(position[axis] + skew, cell[axis], floorInt);
+
+        cellSum     += cell[axis];
+        primed[axis] = static_cast<uint32_t>(floorInt) * simd::NoisePrimes[axis];
+    }
+
+    float t = cellSum * simd::SimplexUnskew[Dim];
+    for(int32_t axis = 0; axis < Dim; ++axis)
+    {
+        offset[axis] = position[axis] - cell[axis] + t;
+    }
+
+    int32_t rank[Dim] {};
+    for(int32_t a = 0; a < Dim; ++a)
+    {
+        for(int32_t b = a + 1; b < Dim; ++b)
+        {
+            int32_t greater = offset[b] < offset[a];
+            rank[a]        += greater;
+            rank[b]        += 1 - greater;
+        }
+    }
+
+    float result = 0;
+    for(int32_t corner = 0; corner <= Dim; ++corner)
+    {
+        uint32_t hash    = seed;
+        float distance   = 0.5f;
+        float correction = corner * simd::SimplexUnskew[Dim];
+        float d[Dim];
+
+        for(int32_t axis = 0; axis < Dim; ++axis)
+        {
+            bool step = rank[axis] >= Dim - corner;
+
+            hash     ^= primed[axis] + (step ? simd::NoisePrimes[axis] : 0);
+            d[axis]   = offset[axis] - (step ? 1 : 0) + correction;
+            distance -= d[axis] * d[axis];
+        }
+
+        float falloff = std::max(distance, 0.0f);
+        falloff      *= falloff;
+        falloff      *= falloff;
+        result       += falloff * NoiseGradient<Dim>(FinishNoiseHash(hash), d);
+    }
+
+    return result * simd::SimplexNoiseScale[Dim];
+}
+
+template<int32_t Dim, bool Simplex, bool Ridged>
+float FractalNoise(const float (&position)[Dim], int32_t seed, int32_t octaves, float frequency, float lacunarity,
+    float gain)
+{
+    float sum    = 0;
+    float weight = 1;
+    float total  = 0;
+
+    for(int32_t octave = 0; octave < octaves; ++octave)
+    {
+        float p[Dim];
+        for(int32_t axis = 0; axis < Dim; ++axis)
+        {
+            p[axis] = position[axis] * frequency;
+        }
+
+        uint32_t octaveSeed = static_cast<uint32_t>(seed) + octave;
+        float value         = Simplex ? SimplexNoise<Dim>(p, octaveSeed) : GradientNoise<Dim>(p, octaveSeed);
+
+        if constexpr (Ridged)
+        {
+            value = 1 - std::abs(value);
+            value = value * value * 2 - 1;
+        }
+
+        sum       += value * weight;
+        total     += weight;
+        weight    *= gain;
+        frequency *= lacunarity;
+    }
+
+    return sum * (1 / total);
+}
+
+//! Settings
+inline int32_t GetOctaveCount(const NoiseSettings& settings)
+{
+    return settings.fractal == FractalType::None ? 1 : std::max(settings.octaves, 1);
+}
+
+//Calls func(simplex, ridged) with the settings as std::bool_constant so the
+//kernels are picked once per call
+template<typename Func>
+void DispatchNoise(const NoiseSettings& settings, const Func& func)
+{
+    bool simplex = settings.type == NoiseType::Simplex;
+    bool ridged  = settings.fractal == FractalType::Ridged;
+
+    if(simplex)
+    {
+        ridged ? func(std::true_type{}, std::true_type{}) : func(std::true_type{}, std::false_type{});
+    }
+    else
+    {
+        ridged ? func(std::false_type{}, std::true_type{}) : func(std::false_type{}, std::false_type{});
+    }
+}
+
+template<int32_t Dim>
+float SampleNoise(const NoiseSettings& settings, const float (&position)[Dim])
+{
+    float result = 0;
+
+    DispatchNoise(settings, [&](auto simplex, auto ridged)
+    {
+        result = FractalNoise<Dim, decltype(simplex)::value, decltype(ridged)::value>(position, settings.seed,
+            GetOctaveCount(settings), settings.frequency, settings.lacunarity, settings.gain);
+    });
+
+    return result;
+}
+
+template<int32_t Dim, typename V>
+void SampleNoise(const NoiseSettings& settings, std::span<const V> positions, std::span<float> output)
+{
+    assert(output.size() >= positions.size());
+
+    DispatchNoise(settings, [&](auto simplex, auto ridged)
+    {
+        constexpr bool Simplex = decltype(simplex)::value;
+        constexpr bool Ridged  = decltype(ridged)::value;
+
+        int32_t octaves = GetOctaveCount(settings);
+        std::size_t i   = 0;
+#if MATH_SIMD_SSE
+        i = simd::SampleNoise<Dim, Simplex, Ridged>(reinterpret_cast<const float*>(positions.data()), output.data(),
+            positions.size(), settings.seed, octaves, settings.frequency, settings.lacunarity, settings.gain);
+#endif
+
+        for(; i < positions.size(); ++i)
+        {
+            float p[Dim];
+            for(int32_t axis = 0; axis < Dim; ++axis)
+            {
+                p[axis] = positions[i][axis];
+            }
+
+            output[i] = FractalNoise<Dim, Simplex, Ridged>(p, settings.seed, octaves, settings.frequency,
+                settings.lacunarity, settings.gain);
+        }
+    });
+}
+
+//Grid rows along x, row r has the other Dim - 1 coordinates of rowPosition(r)
+template<int32_t Dim, typename RowPosition>
+void FillNoiseRows(const NoiseSettings& settings, float* output, std::size_t width, std::size_t rows, float start,
+    float spacing, uint32_t threadCount, const RowPosition& rowPosition)
+{
+    DispatchNoise(settings, [&](auto simplex, auto ridged)
+    {
+        constexpr bool Simplex = decltype(simplex)::value;
+        constexpr bool Ridged  = decltype(ridged)::value;
+
+        int32_t octaves = GetOctaveCount(settings);
+
+        //No more threads than rows, so none is started without work
+        uint32_t workers = static_cast<uint32_t>(std::clamp<std::size_t>(rows, 1, ResolveThreadCount(threadCount)));
+        ParallelFor(workers, rows, [&](uint32_t, std::size_t begin, std::size_t end)
+        {
+            for(std::size_t row = begin; row < end; ++row)
+            {
+                float p[Dim];
+                rowPosition(row, p);
+
+                float* values = output + row * width;
+                std::size_t i = 0;
+#if MATH_SIMD_SSE
+                i = simd::SampleNoiseRow<Dim, Simplex, Ridged>(values, width, start, spacing, p + 1, settings.seed,
+                    octaves, settings.frequency, settings.lacunarity, settings.gain);
+#endif
+
+                for(; i < width; ++i)
+                {
+                    p[0]      = static_cast<float>(i) * spacing + start;
+                    values[i] = FractalNoise<Dim, Simplex, Ridged>(p, settings.seed, octaves, settings.frequency,
+                        settings.lacunarity, settings.gain);
+                }
+            }
+        });
+    });
+}
+
+} //namespace detail
+
+//! Single octave
+inline float GradientNoise(const Vector2<float>& position, int32_t seed)
+{
+    return detail::GradientNoise<2>({ position.x, position.y }, static_cast<uint32_t>(seed));
+}
+
+inline float GradientNoise(const Vector3<float>& position, int32_t seed)
+{
+    return detail::GradientNoise<3>({ position.x, position.y, position.z }, static_cast<uint32_t>(seed));
+}
+
+inline float GradientNoise(const Vector4<float>& position, int32_t seed)
+{
+    return detail::GradientNoise<4>({ position.x, position.y, position.z, position.w }, static_cast<uint32_t>(seed));
+}
+
+inline float SimplexNoise(const Vector2<float>& position, int32_t seed)
+{
+    return detail::SimplexNoise<2>({ position.x, position.y }, static_cast<uint32_t>(seed));
+}
+
+inline float SimplexNoise(const Vector3<float>& position, int32_t seed)
+{
+    return detail::SimplexNoise<3>({ position.x, position.y, position.z }, static_cast<uint32_t>(seed));
+}
+
+inline float SimplexNoise(const Vector4<float>& position, int32_t seed)
+{
+    return detail::SimplexNoise<4>({ position.x, position.y, position.z, position.w }, static_cast<uint32_t>(seed));
+}
+
+//! Fractal
+inline float SampleNoise(const NoiseSettings& settings, const Vector2<float>& position)
+{
+    return detail::SampleNoise<2>(settings, { position.x, position.y });
+}
+
+inline float SampleNoise(const NoiseSettings& settings, const Vector3<float>& position)
+{
+    return detail::SampleNoise<3>(settings, { position.x, position.y, position.z });
+}
+
+inline float SampleNoise(const NoiseSettings& settings, const Vector4<float>& position)
+{
+    return detail::SampleNoise<4>(settings, { position.x, position.y, position.z, position.w });
+}
+
+//! Batched sampling
+inline void SampleNoise(const NoiseSettings& settings, std::span<const Vector2<float>> positions, std::span<float> output)
+{
+    detail::SampleNoise<2>(settings, positions, output);
+}
+
+inline void SampleNoise(const NoiseSettings& settings, std::span<const Vector3<float>> positions, std::span<float> output)
+{
+    detail::SampleNoise<3>(settings, positions, output);
+}
+
+inline void SampleNoise(const NoiseSettings& settings, std::span<const Vector4<float>> positions, std::span<float> output)
+{
+    detail::SampleNoise<4>(settings, positions, output);
+}
+
+inline void FillNoiseGrid(const NoiseSettings& settings, std::span<float> output, uint32_t width, uint32_t height,
+    const Vector2<float>& origin, const Vector2<float>& spacing, uint32_t threadCount)
+{
+    assert(output.size() >= std::size_t{width} * height);
+
+    detail::FillNoiseRows<2>(settings, output.data(), width, height, origin.x, spacing.x, threadCount,
+        [&](std::size_t row, float (&position)[2])
+    {
+        position[1] = static_cast<float>(row) * spacing.y + origin.y;
+    });
+}
+
+inline void FillNoiseGrid(const NoiseSettings& settings, std::span<float> output, uint32_t width, uint32_t height,
+    uint32_t depth, const Vector3<float>& origin, const Vector3<float>& spacing, uint32_t threadCount)
+{
+    assert(output.size() >= std::size_t{width} * height * depth);
+
+    detail::FillNoiseRows<3>(settings, output.data(), width, std::size_t{height} * depth, origin.x, spacing.x,
+        threadCount, [&](std::size_t row, float (&position)[3])
+    {
+        position[1] = static_cast<float>(row % height) * spacing.y + origin.y;
+        position[2] = static_cast<float>(row / height) * spacing.z + origin.z;
+    });
+}
+
+} //namespace math
@@ -1,4 +1,8 @@
 #pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
 #include "vector/Vector2.hpp"
 #include "vector/Vector3.hpp"
 #include "vector/Vector4.hpp"
@@ -6,19 +10,209 @@
 #include "matrix/Matrix3.hpp"
 #include "matrix/Matrix4.hpp"
 #include "quat/Quaternion.hpp"
+#include "quat/DualQuaternion.hpp"
+#include "geometry/AABB.hpp"
+#include "geometry/Ray.hpp"
+#include "geometry/Triangle.hpp"
+#include "packed/Half.hpp"
+#include "packed/Normalized.hpp"
+#include "packed/Octahedral.hpp"
+#include "packed/SmallestThree.hpp"
 
 namespace math
 {
 
+//Interpolation used by BlendRotations
+enum class RotationBlend
+{
+    Nlerp,
+    Slerp,
+    FastSlerp
+};
+
+//Angular difference between two sets of rotations, in radians
+struct RotationError
+{
+    float maxAngle  = 0;
+    float meanAngle = 0;
+};
+
+//Accuracy of the batched transcendentals. Fast trades a few extra bits of error
+//(~1e-6 absolute for sin/cos, ~6e-6 relative for exp) for shorter polynomials
+enum class Precision
+{
+    Accurate,
+    Fast
+};
+
 template<typename T>
 Vector2<T> operator*(const Matrix2<T>& m, const Vector2<T> v);
 template<typename T>
-Vector2<T> operator*(const Matrix3<T>& m, const Vector3<T> v);
+Vector3<T> operator*(const Matrix3<T>& m, const Vector3<T> v);
 template<typename T>
-Vector2<T> operator*(const Matrix4<T>& m, const Vector4<T> v);
+Vector4<T> operator*(const Matrix4<T>& m, const Vector4<T> v);
 template<typename T>
 Vector3<T> operator*(const Quaternion<T>& q, const Vector3<T> v);
 
+//! Batched transforms
+//The output span must be at least as big as the input span. Input and output
+//may be the same buffer
+
+//Transforms points (w = 1). The resulting w component is discarded
+template<typename T>
+void TransformPoints(const Matrix4<T>& m, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output);
+//Transforms directions (w = 0)
+template<typename T>
+void TransformDirections(const Matrix4<T>& m, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output);
+template<typename T>
+void TransformVec4(const Matrix4<T>& m, std::span<const Vector4<std::type_identity_t<T>>> input, 
+    std::span<Vector4<std::type_identity_t<T>>> output);
+//Rotates every vector by the same quaternion
+template<typename T>
+void RotateVectors(const Quaternion<T>& q, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output);
+//Rotates input[i] by rotations[i]
+template<typename T>
+void RotateVectors(std::span<const Quaternion<T>> rotations, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output);
+
+//! Batched rotation blending
+//output[i] = blend(a[i], b[i], weights[i])
+template<typename T>
+void BlendRotations(std::span<const Quaternion<T>> a, std::span<const Quaternion<std::type_identity_t<T>>> b, 
+    std::span<const std::type_identity_t<T>> weights, std::span<Quaternion<std::type_identity_t<T>>> output, RotationBlend mode);
+//accumulator[i] += rotations[i] * weights[i] on the hemisphere of accumulator[i]. Blends
+//any number of poses when called once per pose on a zeroed accumulator followed by
+//NormalizeRotations
+template<typename T>
+void AccumulateRotations(std::span<Quaternion<T>> accumulator, std::span<const Quaternion<std::type_identity_t<T>>> rotations, 
+    std::span<const std::type_identity_t<T>> weights);
+template<typename T>
+void NormalizeRotations(std::span<Quaternion<T>> rotations);
+
+//! Batched fast normalisation
+//In place GetFastNormalized on every element. Max relative error ~5e-7 for float,
+//exact for double. Zero length inputs give NaN like GetNormalized
+template<typename T>
+void FastNormalizeVectors(std::span<Vector2<T>> vectors);
+template<typename T>
+void FastNormalizeVectors(std::span<Vector3<T>> vectors);
+template<typename T>
+void FastNormalizeVectors(std::span<Vector4<T>> vectors);
+template<typename T>
+void FastNormalizeRotations(std::span<Quaternion<T>> rotations);
+
+//! Batched skinning
+//Vertex i blends bones[boneIndices[i][k]] with weight boneWeights[i][k] for k
+//in [0, 4). Unused slots need a weight of 0 and the weights of a vertex should
+//sum to 1. normals and outNormals may be empty, outputs may alias the inputs
+
+//Linear blend skinning. Normals use the blended linear part, which is only
+//exact for rotations and uniform scale
+template<typename T>
+void SkinLinear(std::span<const Matrix4<T>> bones, std::span<const std::array<uint16_t, 4>> boneIndices, 
+    std::span<const Vector4<std::type_identity_t<T>>> boneWeights, std::span<const Vector3<std::type_identity_t<T>>> positions, 
+    std::span<const Vector3<std::type_identity_t<T>>> normals, std::span<Vector3<std::type_identity_t<T>>> outPositions, 
+    std::span<Vector3<std::type_identity_t<T>>> outNormals);
+//Dual quaternion skinning, bones are normalised rigid transforms
+template<typename T>
+void SkinDualQuaternion(std::span<const DualQuaternion<T>> bones, std::span<const std::array<uint16_t, 4>> boneIndices, 
+    std::span<const Vector4<std::type_identity_t<T>>> boneWeights, std::span<const Vector3<std::type_identity_t<T>>> positions, 
+    std::span<const Vector3<std::type_identity_t<T>>> normals, std::span<Vector3<std::type_identity_t<T>>> outPositions, 
+    std::span<Vector3<std::type_identity_t<T>>> outNormals);
+
+//! Batched transcendentals
+//Float runs polynomial approximations 4 (SSE) or 8 (AVX2) lanes at a time, see
+//simd/TranscendentalSimd.hpp for the error bounds and valid ranges. Double and
+//the tail use <cmath>. The output span must be at least as big as the input
+//span and may be the same buffer
+template<typename T>
+void Sin(std::span<const T> input, std::span<std::type_identity_t<T>> output, Precision precision = Precision::Accurate);
+template<typename T>
+void Cos(std::span<const T> input, std::span<std::type_identity_t<T>> output, Precision precision = Precision::Accurate);
+template<typename T>
+void SinCos(std::span<const T> input, std::span<std::type_identity_t<T>> sin, std::span<std::type_identity_t<T>> cos, 
+    Precision precision = Precision::Accurate);
+template<typename T>
+void Exp(std::span<const T> input, std::span<std::type_identity_t<T>> output, Precision precision = Precision::Accurate);
+template<typename T>
+void Log(std::span<const T> input, std::span<std::type_identity_t<T>> output, Precision precision = Precision::Accurate);
+template<typename T>
+void Atan2(std::span<const T> y, std::span<const std::type_identity_t<T>> x, std::span<std::type_identity_t<T>> output, 
+    Precision precision = Precision::Accurate);
+//Negative bases give NaN
+template<typename T>
+void Pow(std::span<const T> base, std::span<const std::type_identity_t<T>> exponent, std::span<std::type_identity_t<T>> output, 
+    Precision precision = Precision::Accurate);
+
+//! Batched packing
+//Converts every component of float vectors (Vector2/3/4, Quaternion) to and
+//from the packed storage types. The output span must be at least as big as
+//the input span. Half needs F16C for the SIMD path
+template<template<typename> typename V>
+void PackHalf(std::span<const V<float>> input, std::span<V<Half>> output);
+template<template<typename> typename V>
+void UnpackHalf(std::span<const V<Half>> input, std::span<V<float>> output);
+template<template<typename> typename V, typename I>
+void PackSnorm(std::span<const V<float>> input, std::span<V<Snorm<I>>> output);
+template<template<typename> typename V, typename I>
+void UnpackSnorm(std::span<const V<Snorm<I>>> input, std::span<V<float>> output);
+template<template<typename> typename V, typename I>
+void PackUnorm(std::span<const V<float>> input, std::span<V<Unorm<I>>> output);
+template<template<typename> typename V, typename I>
+void UnpackUnorm(std::span<const V<Unorm<I>>> input, std::span<V<float>> output);
+//Unit normals to octahedral Snorm pairs (OctNormal16 / OctNormal32) and back
+template<typename I>
+void PackOctahedral(std::span<const Vector3<float>> normals, std::span<Vector2<Snorm<I>>> output);
+template<typename I>
+void UnpackOctahedral(std::span<const Vector2<Snorm<I>>> input, std::span<Vector3<float>> normals);
+
+//! Batched quaternion compression
+//Smallest three encoding of normalised rotations (Quat32, Quat48). The output
+//span must be at least as big as the input span
+template<int32_t ComponentBits>
+void CompressRotations(std::span<const Quaternion<float>> rotations, std::span<SmallestThree<ComponentBits>> output);
+template<int32_t ComponentBits>
+void DecompressRotations(std::span<const SmallestThree<ComponentBits>> input, std::span<Quaternion<float>> rotations);
+//Rotation angle between a[i] and b[i] (q and -q are equal), accumulated in
+//double so the error of a round trip can be measured down to ~1e-7
+RotationError MeasureRotationError(std::span<const Quaternion<float>> a, std::span<const Quaternion<float>> b);
+
+//! Batched intersection tests
+//Packets of 4 (SSE) or 8 (AVX2) tests at a time for float. distances[i] is the
+//hit distance of Ray::IntersectsAABB / Ray::IntersectsTriangle or +inf on a
+//miss. The output span must be at least as big as the input span
+template<typename T>
+void IntersectRayAABBs(const Ray<T>& ray, std::span<const AABB<std::type_identity_t<T>>> boxes, 
+    std::span<std::type_identity_t<T>> distances);
+template<typename T>
+void IntersectRaysAABB(std::span<const Ray<T>> rays, const AABB<std::type_identity_t<T>>& box, 
+    std::span<std::type_identity_t<T>> distances);
+template<typename T>
+void IntersectRayTriangles(const Ray<T>& ray, std::span<const Triangle<std::type_identity_t<T>>> triangles, 
+    std::span<std::type_identity_t<T>> distances);
+template<typename T>
+void IntersectRaysTriangle(std::span<const Ray<T>> rays, const Triangle<std::type_identity_t<T>>& triangle, 
+    std::span<std::type_identity_t<T>> distances);
+
+//! Camera relative rebasing
+//Double precision world data moved into the space of a camera sitting at
+//origin and narrowed to float, so float transforms keep full precision near
+//the camera at any distance from the world origin. The output span must be at
+//least as big as the input span
+void RebasePositions(std::span<const Vector3<double>> positions, const Vector3<double>& origin, 
+    std::span<Vector3<float>> output);
+//Premultiplies by a translation of -origin, affine transforms only have their
+//translation changed
+void RebaseTransforms(std::span<const Matrix4<double>> transforms, const Vector3<double>& origin, 
+    std::span<Matrix4<float>> output);
+//Matrix4::CreateLookAt for a camera at eye moved to the origin, to be used
+//with data rebased on eye. The basis is built in double
+Matrix4<float> CreateRelativeLookAt(const Vector3<double>& eye, const Vector3<double>& target, 
+    const Vector3<double>& up);
+
 } //namespace math
 
 #include "operations.inl"
\ No newline at end of file
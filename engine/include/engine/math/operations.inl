@@ -1,3 +1,17 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include "simd/IntersectionSimd.hpp"
+#include "simd/NormalizeSimd.hpp"
+#include "simd/PackingSimd.hpp"
+#include "simd/QuaternionSimd.hpp"
+#include "simd/RebaseSimd.hpp"
+#include "simd/SmallestThreeSimd.hpp"
+#include "simd/SkinningSimd.hpp"
+#include "simd/TranscendentalSimd.hpp"
+#include "simd/TransformSimd.hpp"
+
 namespace math
 {
 
@@ -34,35 +48,937 @@ Vector4<T> operator*(const Matrix4<T>& m, const Vector4<T> v)
     };
 }
 
+//v' = v + w * t + cross(q.xyz, t) where t = 2 * cross(q.xyz, v)
 template<typename T>
-Quaternion<T> operator*(const Quaternion<T>& q, const Vector3<T> v)
+Vector3<T> operator*(const Quaternion<T>& q, const Vector3<T> v)
 {
-    T dot            = q.x * v.x + q.y * v.y + q.z * v.z;
-    Vector3<T> cross = Vector3( 
-        q.y * v.z - q.z * v.y, 
-        q.z * v.x - q.x * v.z,
-        q.x * v.y - q.y * v.x 
-    );
+    T tx = 2 * (q.y * v.z - q.z * v.y);
+    T ty = 2 * (q.z * v.x - q.x * v.z);
+    T tz = 2 * (q.x * v.y - q.y * v.x);
 
-    Quaternion<T> other = Quaternion(
-        q.w * v.x + cross.x,
-        q.w * v.y + cross.y,
-        q.w * v.z + cross.z,
-        -dot
-    );
-    Quaternion<T> conj = q.GetConjugated();
-
-    cross = Vector3( 
-        other.y * conj.z - other.z * conj.y, 
-        other.z * conj.x - other.x * conj.z,
-        other.x * conj.y - other.y * conj.x 
-    );
-    
     return Vector3<T>(
-        other.w * conj.x + conj.w * other.x + cross.x,
-        other.w * conj.y + conj.w * other.y + cross.y,
-        other.w * conj.z + conj.w * other.z + cross.z
+        v.x + q.w * tx + q.y * tz - q.z * ty,
+        v.y + q.w * ty + q.z * tx - q.x * tz,
+        v.z + q.w * tz + q.x * ty - q.y * tx
     );
 }
 
+//! Batched transforms
+template<typename T>
+void TransformPoints(const Matrix4<T>& m, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::TransformVec3<true>(m.arr, reinterpret_cast<const T*>(input.data()), 
+            reinterpret_cast<T*>(output.data()), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        Vector3<T> v = input[i];
+        output[i] = Vector3<T>(
+            m.arr[0] * v.x + m.arr[4] * v.y + m.arr[8]  * v.z + m.arr[12],
+            m.arr[1] * v.x + m.arr[5] * v.y + m.arr[9]  * v.z + m.arr[13],
+            m.arr[2] * v.x + m.arr[6] * v.y + m.arr[10] * v.z + m.arr[14]
+        );
+    }
+}
+
+template<typename T>
+void TransformDirections(const Matrix4<T>& m, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::TransformVec3<false>(m.arr, reinterpret_cast<const T*>(input.data()), 
+            reinterpret_cast<T*>(output.data()), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        Vector3<T> v = input[i];
+        output[i] = Vector3<T>(
+            m.arr[0] * v.x + m.arr[4] * v.y + m.arr[8]  * v.z,
+            m.arr[1] * v.x + m.arr[5] * v.y + m.arr[9]  * v.z,
+            m.arr[2] * v.x + m.arr[6] * v.y + m.arr[10] * v.z
+        );
+    }
+}
+
+template<typename T>
+void TransformVec4(const Matrix4<T>& m, std::span<const Vector4<std::type_identity_t<T>>> input, 
+    std::span<Vector4<std::type_identity_t<T>>> output)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::TransformVec4(m.arr, reinterpret_cast<const T*>(input.data()), 
+            reinterpret_cast<T*>(output.data()), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        output[i] = m * input[i];
+    }
+}
+
+template<typename T>
+void RotateVectors(const Quaternion<T>& q, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::RotateVec3(&q.x, reinterpret_cast<const T*>(input.data()), 
+            reinterpret_cast<T*>(output.data()), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        output[i] = q * input[i];
+    }
+}
+
+template<typename T>
+void RotateVectors(std::span<const Quaternion<T>> rotations, std::span<const Vector3<std::type_identity_t<T>>> input, 
+    std::span<Vector3<std::type_identity_t<T>>> output)
+{
+    assert(rotations.size() >= input.size() && output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::RotateVec3PerElement(reinterpret_cast<const T*>(rotations.data()), 
+            reinterpret_cast<const T*>(input.data()), reinterpret_cast<T*>(output.data()), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        output[i] = rotations[i] * input[i];
+    }
+}
+
+//! Batched rotation blending
+template<typename T>
+void BlendRotations(std::span<const Quaternion<T>> a, std::span<const Quaternion<std::type_identity_t<T>>> b, 
+    std::span<const std::type_identity_t<T>> weights, std::span<Quaternion<std::type_identity_t<T>>> output, RotationBlend mode)
+{
+    assert(b.size() >= a.size() && weights.size() >= a.size() && output.size() >= a.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    //Exact slerp needs acos and sin so it stays scalar
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if(mode != RotationBlend::Slerp)
+        {
+            i = simd::BlendQuat(reinterpret_cast<const T*>(a.data()), reinterpret_cast<const T*>(b.data()), 
+                weights.data(), reinterpret_cast<T*>(output.data()), a.size(), mode == RotationBlend::FastSlerp);
+        }
+    }
+#endif
+
+    for(; i < a.size(); ++i)
+    {
+        switch (mode)
+        {
+            case RotationBlend::Nlerp:     output[i] = Quaternion<T>::Nlerp(a[i], b[i], weights[i]);     break;
+            case RotationBlend::Slerp:     output[i] = Quaternion<T>::Slerp(a[i], b[i], weights[i]);     break;
+            case RotationBlend::FastSlerp: output[i] = Quaternion<T>::FastSlerp(a[i], b[i], weights[i]); break;
+        }
+    }
+}
+
+template<typename T>
+void AccumulateRotations(std::span<Quaternion<T>> accumulator, std::span<const Quaternion<std::type_identity_t<T>>> rotations, 
+    std::span<const std::type_identity_t<T>> weights)
+{
+    assert(rotations.size() >= accumulator.size() && weights.size() >= accumulator.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::AccumulateQuat(reinterpret_cast<T*>(accumulator.data()), 
+            reinterpret_cast<const T*>(rotations.data()), weights.data(), accumulator.size());
+    }
+#endif
+
+    for(; i < accumulator.size(); ++i)
+    {
+        T weight = accumulator[i].Dot(rotations[i]) < 0 ? -weights[i] : weights[i];
+        accumulator[i] += rotations[i] * weight;
+    }
+}
+
+template<typename T>
+void NormalizeRotations(std::span<Quaternion<T>> rotations)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::NormalizeQuat(reinterpret_cast<T*>(rotations.data()), rotations.size());
+    }
+#endif
+
+    for(; i < rotations.size(); ++i)
+    {
+        rotations[i] = rotations[i].GetNormalized();
+    }
+}
+
+template<typename T>
+void FastNormalizeVectors(std::span<Vector2<T>> vectors)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::FastNormalize2(reinterpret_cast<T*>(vectors.data()), vectors.size());
+    }
+#endif
+
+    for(; i < vectors.size(); ++i)
+    {
+        vectors[i] = vectors[i].GetFastNormalized();
+    }
+}
+
+template<typename T>
+void FastNormalizeVectors(std::span<Vector3<T>> vectors)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::FastNormalize3(reinterpret_cast<T*>(vectors.data()), vectors.size());
+    }
+#endif
+
+    for(; i < vectors.size(); ++i)
+    {
+        vectors[i] = vectors[i].GetFastNormalized();
+    }
+}
+
+template<typename T>
+void FastNormalizeVectors(std::span<Vector4<T>> vectors)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::FastNormalize4(reinterpret_cast<T*>(vectors.data()), vectors.size());
+    }
+#endif
+
+    for(; i < vectors.size(); ++i)
+    {
+        vectors[i] = vectors[i].GetFastNormalized();
+    }
+}
+
+template<typename T>
+void FastNormalizeRotations(std::span<Quaternion<T>> rotations)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::FastNormalize4(reinterpret_cast<T*>(rotations.data()), rotations.size());
+    }
+#endif
+
+    for(; i < rotations.size(); ++i)
+    {
+        rotations[i] = rotations[i].GetFastNormalized();
+    }
+}
+
+template<typename T>
+void SkinLinear(std::span<const Matrix4<T>> bones, std::span<const std::array<uint16_t, 4>> boneIndices, 
+    std::span<const Vector4<std::type_identity_t<T>>> boneWeights, std::span<const Vector3<std::type_identity_t<T>>> positions, 
+    std::span<const Vector3<std::type_identity_t<T>>> normals, std::span<Vector3<std::type_identity_t<T>>> outPositions, 
+    std::span<Vector3<std::type_identity_t<T>>> outNormals)
+{
+    assert(boneIndices.size() >= positions.size() && boneWeights.size() >= positions.size());
+    assert(outPositions.size() >= positions.size());
+    assert(normals.empty() || (normals.size() >= positions.size() && outNormals.size() >= positions.size()));
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::SkinLinear(reinterpret_cast<const T*>(bones.data()), reinterpret_cast<const uint16_t*>(boneIndices.data()), 
+            reinterpret_cast<const T*>(boneWeights.data()), reinterpret_cast<const T*>(positions.data()), 
+            normals.empty() ? nullptr : reinterpret_cast<const T*>(normals.data()), 
+            reinterpret_cast<T*>(outPositions.data()), reinterpret_cast<T*>(outNormals.data()), positions.size());
+    }
+#endif
+
+    for(; i < positions.size(); ++i)
+    {
+        const Vector4<T>& w = boneWeights[i];
+        Matrix4<T> m = bones[boneIndices[i][0]] * w.x + bones[boneIndices[i][1]] * w.y + 
+            bones[boneIndices[i][2]] * w.z + bones[boneIndices[i][3]] * w.w;
+
+        Vector4<T> p = m * Vector4<T>(positions[i].x, positions[i].y, positions[i].z, 1);
+        outPositions[i] = Vector3<T>(p.x, p.y, p.z);
+
+        if(!normals.empty())
+        {
+            Vector4<T> n = m * Vector4<T>(normals[i].x, normals[i].y, normals[i].z, 0);
+            outNormals[i] = Vector3<T>(n.x, n.y, n.z);
+        }
+    }
+}
+
+template<typename T>
+void SkinDualQuaternion(std::span<const DualQuaternion<T>> bones, std::span<const std::array<uint16_t, 4>> boneIndices, 
+    std::span<const Vector4<std::type_identity_t<T>>> boneWeights, std::span<const Vector3<std::type_identity_t<T>>> positions, 
+    std::span<const Vector3<std::type_identity_t<T>>> normals, std::span<Vector3<std::type_identity_t<T>>> outPositions, 
+    std::span<Vector3<std::type_identity_t<T>>> outNormals)
+{
+    assert(boneIndices.size() >= positions.size() && boneWeights.size() >= positions.size());
+    assert(outPositions.size() >= positions.size());
+    assert(normals.empty() || (normals.size() >= positions.size() && outNormals.size() >= positions.size()));
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::SkinDualQuaternion(reinterpret_cast<const T*>(bones.data()), reinterpret_cast<const uint16_t*>(boneIndices.data()), 
+            reinterpret_cast<const T*>(boneWeights.data()), reinterpret_cast<const T*>(positions.data()), 
+            normals.empty() ? nullptr : reinterpret_cast<const T*>(normals.data()), 
+            reinterpret_cast<T*>(outPositions.data()), reinterpret_cast<T*>(outNormals.data()), positions.size());
+    }
+#endif
+
+    for(; i < positions.size(); ++i)
+    {
+        const DualQuaternion<T>& first = bones[boneIndices[i][0]];
+        DualQuaternion<T> blend = first * boneWeights[i][0];
+
+        for(std::size_t k = 1; k < 4; ++k)
+        {
+            const DualQuaternion<T>& bone = bones[boneIndices[i][k]];
+            T weight = bone.Dot(first) < 0 ? -boneWeights[i][k] : boneWeights[i][k];
+            blend += bone * weight;
+        }
+
+        blend = blend.GetNormalized();
+        outPositions[i] = blend.TransformPoint(positions[i]);
+
+        if(!normals.empty())
+        {
+            outNormals[i] = blend.TransformDirection(normals[i]);
+        }
+    }
+}
+
+//! Batched transcendentals
+template<typename T>
+void Sin(std::span<const T> input, std::span<std::type_identity_t<T>> output, [[maybe_unused]] Precision precision)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = precision == Precision::Fast ? simd::Sin<true>(input.data(), output.data(), input.size()) : 
+                                           simd::Sin<false>(input.data(), output.data(), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        output[i] = std::sin(input[i]);
+    }
+}
+
+template<typename T>
+void Cos(std::span<const T> input, std::span<std::type_identity_t<T>> output, [[maybe_unused]] Precision precision)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = precision == Precision::Fast ? simd::Cos<true>(input.data(), output.data(), input.size()) : 
+                                           simd::Cos<false>(input.data(), output.data(), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        output[i] = std::cos(input[i]);
+    }
+}
+
+template<typename T>
+void SinCos(std::span<const T> input, std::span<std::type_identity_t<T>> sin, std::span<std::type_identity_t<T>> cos, 
+    [[maybe_unused]] Precision precision)
+{
+    assert(sin.size() >= input.size() && cos.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = precision == Precision::Fast ? simd::SinCos<true>(input.data(), sin.data(), cos.data(), input.size()) : 
+                                           simd::SinCos<false>(input.data(), sin.data(), cos.data(), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        T value = input[i];
+        sin[i]  = std::sin(value);
+        cos[i]  = std::cos(value);
+    }
+}
+
+template<typename T>
+void Exp(std::span<const T> input, std::span<std::type_identity_t<T>> output, [[maybe_unused]] Precision precision)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = precision == Precision::Fast ? simd::Exp<true>(input.data(), output.data(), input.size()) : 
+                                           simd::Exp<false>(input.data(), output.data(), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        output[i] = std::exp(input[i]);
+    }
+}
+
+template<typename T>
+void Log(std::span<const T> input, std::span<std::type_identity_t<T>> output, [[maybe_unused]] Precision precision)
+{
+    assert(output.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = precision == Precision::Fast ? simd::Log<true>(input.data(), output.data(), input.size()) : 
+                                           simd::Log<false>(input.data(), output.data(), input.size());
+    }
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        output[i] = std::log(input[i]);
+    }
+}
+
+template<typename T>
+void Atan2(std::span<const T> y, std::span<const std::type_identity_t<T>> x, std::span<std::type_identity_t<T>> output, 
+    [[maybe_unused]] Precision precision)
+{
+    assert(x.size() >= y.size() && output.size() >= y.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = precision == Precision::Fast ? simd::Atan2<true>(y.data(), x.data(), output.data(), y.size()) : 
+                                           simd::Atan2<false>(y.data(), x.data(), output.data(), y.size());
+    }
+#endif
+
+    for(; i < y.size(); ++i)
+    {
+        output[i] = std::atan2(y[i], x[i]);
+    }
+}
+
+template<typename T>
+void Pow(std::span<const T> base, std::span<const std::type_identity_t<T>> exponent, std::span<std::type_identity_t<T>> output, 
+    [[maybe_unused]] Precision precision)
+{
+    assert(exponent.size() >= base.size() && output.size() >= base.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = precision == Precision::Fast ? simd::Pow<true>(base.data(), exponent.data(), output.data(), base.size()) : 
+                                           simd::Pow<false>(base.data(), exponent.data(), output.data(), base.size());
+    }
+#endif
+
+    //Matches the SIMD path, std::pow accepts negative bases with integral exponents
+    for(; i < base.size(); ++i)
+    {
+        output[i] = base[i] < 0 && exponent[i] != 0 ? std::numeric_limits<T>::quiet_NaN() : std::pow(base[i], exponent[i]);
+    }
+}
+
+//! Batched packing
+namespace detail
+{
+
+template<typename I>
+void PackSnormArray(const float* input, Snorm<I>* output, std::size_t count)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (sizeof(I) == 1)
+    {
+        i = simd::FloatToSnorm8(input, reinterpret_cast<int8_t*>(output), count);
+    }
+    else if constexpr (sizeof(I) == 2)
+    {
+        i = simd::FloatToSnorm16(input, reinterpret_cast<int16_t*>(output), count);
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        output[i] = Snorm<I>(input[i]);
+    }
+}
+
+template<typename I>
+void UnpackSnormArray(const Snorm<I>* input, float* output, std::size_t count)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (sizeof(I) == 1)
+    {
+        i = simd::Snorm8ToFloat(reinterpret_cast<const int8_t*>(input), output, count);
+    }
+    else if constexpr (sizeof(I) == 2)
+    {
+        i = simd::Snorm16ToFloat(reinterpret_cast<const int16_t*>(input), output, count);
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        output[i] = input[i];
+    }
+}
+
+template<typename I>
+void PackUnormArray(const float* input, Unorm<I>* output, std::size_t count)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (sizeof(I) == 1)
+    {
+        i = simd::FloatToUnorm8(input, reinterpret_cast<uint8_t*>(output), count);
+    }
+    else if constexpr (sizeof(I) == 2)
+    {
+        i = simd::FloatToUnorm16(input, reinterpret_cast<uint16_t*>(output), count);
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        output[i] = Unorm<I>(input[i]);
+    }
+}
+
+template<typename I>
+void UnpackUnormArray(const Unorm<I>* input, float* output, std::size_t count)
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (sizeof(I) == 1)
+    {
+        i = simd::Unorm8ToFloat(reinterpret_cast<const uint8_t*>(input), output, count);
+    }
+    else if constexpr (sizeof(I) == 2)
+    {
+        i = simd::Unorm16ToFloat(reinterpret_cast<const uint16_t*>(input), output, count);
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        output[i] = input[i];
+    }
+}
+
+} //namespace detail
+
+template<template<typename> typename V>
+void PackHalf(std::span<const V<float>> input, std::span<V<Half>> output)
+{
+    assert(output.size() >= input.size());
+
+    const float* in    = reinterpret_cast<const float*>(input.data());
+    Half* out          = reinterpret_cast<Half*>(output.data());
+    std::size_t count  = input.size() * V<float>::Size;
+    std::size_t i      = 0;
+#if MATH_SIMD_F16C
+    i = simd::FloatToHalf(in, reinterpret_cast<uint16_t*>(out), count);
+#endif
+
+    for(; i < count; ++i)
+    {
+        out[i] = Half(in[i]);
+    }
+}
+
+template<template<typename> typename V>
+void UnpackHalf(std::span<const V<Half>> input, std::span<V<float>> output)
+{
+    assert(output.size() >= input.size());
+
+    const Half* in     = reinterpret_cast<const Half*>(input.data());
+    float* out         = reinterpret_cast<float*>(output.data());
+    std::size_t count  = input.size() * V<float>::Size;
+    std::size_t i      = 0;
+#if MATH_SIMD_F16C
+    i = simd::HalfToFloat(reinterpret_cast<const uint16_t*>(in), out, count);
+#endif
+
+    for(; i < count; ++i)
+    {
+        out[i] = in[i];
+    }
+}
+
+template<template<typename> typename V, typename I>
+void PackSnorm(std::span<const V<float>> input, std::span<V<Snorm<I>>> output)
+{
+    assert(output.size() >= input.size());
+
+    detail::PackSnormArray(reinterpret_cast<const float*>(input.data()), reinterpret_cast<Snorm<I>*>(output.data()), 
+        input.size() * V<float>::Size);
+}
+
+template<template<typename> typename V, typename I>
+void UnpackSnorm(std::span<const V<Snorm<I>>> input, std::span<V<float>> output)
+{
+    assert(output.size() >= input.size());
+
+    detail::UnpackSnormArray(reinterpret_cast<const Snorm<I>*>(input.data()), reinterpret_cast<float*>(output.data()), 
+        input.size() * V<float>::Size);
+}
+
+template<template<typename> typename V, typename I>
+void PackUnorm(std::span<const V<float>> input, std::span<V<Unorm<I>>> output)
+{
+    assert(output.size() >= input.size());
+
+    detail::PackUnormArray(reinterpret_cast<const float*>(input.data()), reinterpret_cast<Unorm<I>*>(output.data()), 
+        input.size() * V<float>::Size);
+}
+
+template<template<typename> typename V, typename I>
+void UnpackUnorm(std::span<const V<Unorm<I>>> input, std::span<V<float>> output)
+{
+    assert(output.size() >= input.size());
+
+    detail::UnpackUnormArray(reinterpret_cast<const Unorm<I>*>(input.data()), reinterpret_cast<float*>(output.data()), 
+        input.size() * V<float>::Size);
+}
+
+//The float encoding goes through a small stack buffer so it stays in L1
+//before being quantised
+template<typename I>
+void PackOctahedral(std::span<const Vector3<float>> normals, std::span<Vector2<Snorm<I>>> output)
+{
+    assert(output.size() >= normals.size());
+
+    constexpr std::size_t chunkSize = 256;
+    float encoded[chunkSize * 2];
+
+    for(std::size_t start = 0; start < normals.size(); start += chunkSize)
+    {
+        std::size_t count = std::min(chunkSize, normals.size() - start);
+        std::size_t i     = 0;
+#if MATH_SIMD_SSE
+        i = simd::EncodeOctahedral(reinterpret_cast<const float*>(normals.data() + start), 
+            encoded, count);
+#endif
+
+        for(; i < count; ++i)
+        {
+            Vector2<float> e   = EncodeOctahedral(normals[start + i]);
+            encoded[i * 2]     = e.x;
+            encoded[i * 2 + 1] = e.y;
+        }
+
+        detail::PackSnormArray(encoded, reinterpret_cast<Snorm<I>*>(output.data() + start), 
+            count * 2);
+    }
+}
+
+template<typename I>
+void UnpackOctahedral(std::span<const Vector2<Snorm<I>>> input, std::span<Vector3<float>> normals)
+{
+    assert(normals.size() >= input.size());
+
+    constexpr std::size_t chunkSize = 256;
+    float encoded[chunkSize * 2];
+
+    for(std::size_t start = 0; start < input.size(); start += chunkSize)
+    {
+        std::size_t count = std::min(chunkSize, input.size() - start);
+        std::size_t i     = 0;
+
+        detail::UnpackSnormArray(reinterpret_cast<const Snorm<I>*>(input.data() + start), encoded, count * 2);
+#if MATH_SIMD_SSE
+        i = simd::DecodeOctahedral(encoded, reinterpret_cast<float*>(normals.data() + start), count);
+#endif
+
+        for(; i < count; ++i)
+        {
+            normals[start + i] = DecodeOctahedral(Vector2<float>(encoded[i * 2], encoded[i * 2 + 1]));
+        }
+    }
+}
+
+//! Batched quaternion compression
+template<int32_t ComponentBits>
+void CompressRotations(std::span<const Quaternion<float>> rotations, std::span<SmallestThree<ComponentBits>> output)
+{
+    assert(output.size() >= rotations.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    i = simd::EncodeSmallestThree<ComponentBits>(reinterpret_cast<const float*>(rotations.data()), 
+        reinterpret_cast<uint16_t*>(output.data()), rotations.size());
+#endif
+
+    for(; i < rotations.size(); ++i)
+    {
+        output[i] = SmallestThree<ComponentBits>(rotations[i]);
+    }
+}
+
+template<int32_t ComponentBits>
+void DecompressRotations(std::span<const SmallestThree<ComponentBits>> input, std::span<Quaternion<float>> rotations)
+{
+    assert(rotations.size() >= input.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    i = simd::DecodeSmallestThree<ComponentBits>(reinterpret_cast<const uint16_t*>(input.data()), 
+        reinterpret_cast<float*>(rotations.data()), input.size());
+#endif
+
+    for(; i < input.size(); ++i)
+    {
+        rotations[i] = input[i].ToQuaternion();
+    }
+}
+
+inline RotationError MeasureRotationError(std::span<const Quaternion<float>> a, std::span<const Quaternion<float>> b)
+{
+    assert(b.size() >= a.size());
+
+    RotationError error;
+    double sum = 0;
+
+    for(std::size_t i = 0; i < a.size(); ++i)
+    {
+        Quatd qa(a[i].x, a[i].y, a[i].z, a[i].w);
+        Quatd qb(b[i].x, b[i].y, b[i].z, b[i].w);
+        if(qa.Dot(qb) < 0)
+        {
+            qb = qb * -1.0;
+        }
+
+        //4 * atan2(|a - b|, |a + b|) stays accurate for tiny angles where
+        //2 * acos(dot) loses everything to rounding
+        double angle   = 4 * std::atan2((qa - qb).Length(), (qa + qb).Length());
+        error.maxAngle = std::max(error.maxAngle, static_cast<float>(angle));
+        sum           += angle;
+    }
+
+    error.meanAngle = a.empty() ? 0 : static_cast<float>(sum / a.size());
+    return error;
+}
+
+template<typename T>
+void IntersectRayAABBs(const Ray<T>& ray, std::span<const AABB<std::type_identity_t<T>>> boxes, 
+    std::span<std::type_identity_t<T>> distances)
+{
+    assert(distances.size() >= boxes.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::IntersectRayAABBs(&ray.origin.x, reinterpret_cast<const float*>(boxes.data()), distances.data(), boxes.size());
+    }
+#endif
+
+    for(; i < boxes.size(); ++i)
+    {
+        if(!ray.IntersectsAABB(boxes[i], distances[i]))
+        {
+            distances[i] = std::numeric_limits<T>::infinity();
+        }
+    }
+}
+
+template<typename T>
+void IntersectRaysAABB(std::span<const Ray<T>> rays, const AABB<std::type_identity_t<T>>& box, 
+    std::span<std::type_identity_t<T>> distances)
+{
+    assert(distances.size() >= rays.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::IntersectRaysAABB(reinterpret_cast<const float*>(rays.data()), &box.min.x, distances.data(), rays.size());
+    }
+#endif
+
+    for(; i < rays.size(); ++i)
+    {
+        if(!rays[i].IntersectsAABB(box, distances[i]))
+        {
+            distances[i] = std::numeric_limits<T>::infinity();
+        }
+    }
+}
+
+template<typename T>
+void IntersectRayTriangles(const Ray<T>& ray, std::span<const Triangle<std::type_identity_t<T>>> triangles, 
+    std::span<std::type_identity_t<T>> distances)
+{
+    assert(distances.size() >= triangles.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::IntersectRayTriangles(&ray.origin.x, reinterpret_cast<const float*>(triangles.data()), distances.data(), triangles.size());
+    }
+#endif
+
+    for(; i < triangles.size(); ++i)
+    {
+        if(!ray.IntersectsTriangle(triangles[i], distances[i]))
+        {
+            distances[i] = std::numeric_limits<T>::infinity();
+        }
+    }
+}
+
+template<typename T>
+void IntersectRaysTriangle(std::span<const Ray<T>> rays, const Triangle<std::type_identity_t<T>>& triangle, 
+    std::span<std::type_identity_t<T>> distances)
+{
+    assert(distances.size() >= rays.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::IntersectRaysTriangle(reinterpret_cast<const float*>(rays.data()), &triangle.v0.x, distances.data(), rays.size());
+    }
+#endif
+
+    for(; i < rays.size(); ++i)
+    {
+        if(!rays[i].IntersectsTriangle(triangle, distances[i]))
+        {
+            distances[i] = std::numeric_limits<T>::infinity();
+        }
+    }
+}
+
+inline void RebasePositions(std::span<const Vector3<double>> positions, const Vector3<double>& origin, 
+    std::span<Vector3<float>> output)
+{
+    assert(output.size() >= positions.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    const double originArr[3] = { origin.x, origin.y, origin.z };
+    i = simd::RebasePositions(reinterpret_cast<const double*>(positions.data()), originArr, 
+        reinterpret_cast<float*>(output.data()), positions.size());
+#endif
+
+    for(; i < positions.size(); ++i)
+    {
+        output[i] = Vector3<float>(static_cast<float>(positions[i].x - origin.x), 
+                                   static_cast<float>(positions[i].y - origin.y), 
+                                   static_cast<float>(positions[i].z - origin.z));
+    }
+}
+
+inline void RebaseTransforms(std::span<const Matrix4<double>> transforms, const Vector3<double>& origin, 
+    std::span<Matrix4<float>> output)
+{
+    assert(output.size() >= transforms.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    const double originArr[3] = { origin.x, origin.y, origin.z };
+    i = simd::RebaseTransforms(reinterpret_cast<const double*>(transforms.data()), originArr, 
+        reinterpret_cast<float*>(output.data()), transforms.size());
+#endif
+
+    for(; i < transforms.size(); ++i)
+    {
+        const double* src = transforms[i].arr;
+        float* dst        = output[i].arr;
+
+        for(int32_t c = 0; c < 16; c += 4)
+        {
+            double w   = src[c + 3];
+            dst[c]     = static_cast<float>(src[c] - origin.x * w);
+            dst[c + 1] = static_cast<float>(src[c + 1] - origin.y * w);
+            dst[c + 2] = static_cast<float>(src[c + 2] - origin.z * w);
+            dst[c + 3] = static_cast<float>(w);
+        }
+    }
+}
+
+inline Matrix4<float> CreateRelativeLookAt(const Vector3<double>& eye, const Vector3<double>& target, 
+    const Vector3<double>& up)
+{
+    Matrix4<double> view = Matrix4<double>::CreateLookAt(Vector3<double>(), target - eye, up);
+    Matrix4<float> result;
+
+    for(int32_t i = 0; i < Matrix4<float>::Size; ++i)
+    {
+        result.arr[i] = static_cast<float>(view.arr[i]);
+    }
+
+    return result;
+}
+
 } //namespace math
\ No newline at end of file
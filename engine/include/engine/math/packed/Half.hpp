@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "../vector/Vector4.hpp"
+
+namespace math
+{
+
+//IEEE 754 binary16 storage type. Converts implicitly to and from float with
+//round to nearest even, so arithmetic on it happens in float. Finite range is
+//+-65504 with ~3 significant decimal digits, meant for vertex attributes and
+//network state rather than computation
+struct Half
+{
+public:
+    //! Constructors
+    constexpr Half();
+    constexpr Half(float value);
+
+    constexpr static Half FromBits(uint16_t bits);
+
+    //! Operators
+    //Comparisons go through float, so -0 == 0 and NaN != NaN
+    constexpr operator float() const;
+
+public:
+    uint16_t bits;
+};
+
+using Vec2h = Vector2<Half>;
+using Vec3h = Vector3<Half>;
+using Vec4h = Vector4<Half>;
+
+} //namespace math
+
+#include "Half.inl"
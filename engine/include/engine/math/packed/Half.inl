@@ -0,0 +1,84 @@
+#include <bit>
+#include "../simd/Simd.hpp"
+
+namespace math
+{
+
+//! Constructors
+constexpr Half::Half() : bits{0} { }
+
+constexpr Half::Half(float value) : bits{0}
+{
+#if MATH_SIMD_F16C
+    if !consteval
+    {
+        bits = static_cast<uint16_t>(_mm_cvtsi128_si32(_mm_cvtps_ph(_mm_set_ss(value), _MM_FROUND_TO_NEAREST_INT)));
+        return;
+    }
+#endif
+
+    uint32_t f    = std::bit_cast<uint32_t>(value);
+    uint32_t sign = (f >> 16) & 0x8000;
+    f            &= 0x7FFFFFFF;
+
+    if(f >= 0x47800000)
+    {
+        //65536 and above, inf and NaN. NaN stays quiet
+        bits = static_cast<uint16_t>(sign | (f > 0x7F800000 ? 0x7E00 : 0x7C00));
+    }
+    else if(f < 0x38800000)
+    {
+        //Below the smallest normal half, adding 0.5 lines the mantissa up with
+        //the denormal half bits and lets the FPU do the rounding
+        float denormal = std::bit_cast<float>(f) + 0.5f;
+        bits           = static_cast<uint16_t>(sign | (std::bit_cast<uint32_t>(denormal) - 0x3F000000));
+    }
+    else
+    {
+        //Rebias the exponent and round the 13 dropped mantissa bits to even,
+        //values from 65520 carry into the exponent and become inf
+        uint32_t odd = (f >> 13) & 1;
+        f           += 0xC8000FFF + odd;
+        bits         = static_cast<uint16_t>(sign | (f >> 13));
+    }
+}
+
+constexpr Half Half::FromBits(uint16_t bits)
+{
+    Half result;
+    result.bits = bits;
+    return result;
+}
+
+//! Operators
+constexpr Half::operator float() const
+{
+#if MATH_SIMD_F16C
+    if !consteval
+    {
+        return _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(bits)));
+    }
+#endif
+
+    constexpr uint32_t shiftedExponent = 0x7C00 << 13;
+
+    uint32_t f        = static_cast<uint32_t>(bits & 0x7FFF) << 13;
+    uint32_t exponent = f & shiftedExponent;
+    f                += (127 - 15) << 23;
+
+    if(exponent == shiftedExponent)
+    {
+        //Inf and NaN keep an all ones exponent
+        f += (128 - 16) << 23;
+    }
+    else if(exponent == 0)
+    {
+        //Zero and denormals, renormalised through a float subtraction
+        f += 1 << 23;
+        f  = std::bit_cast<uint32_t>(std::bit_cast<float>(f) - std::bit_cast<float>(113u << 23));
+    }
+
+    return std::bit_cast<float>(f | (static_cast<uint32_t>(bits & 0x8000) << 16));
+}
+
+} //namespace math
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "../vector/Vector4.hpp"
+
+namespace math
+{
+
+//Signed normalised integer, value / max() in [-1, 1] following the D3D/Vulkan
+//snorm rules: floats are clamped and rounded to nearest, min() decodes to -1
+//and NaN is stored as 0
+template<typename I>
+struct Snorm
+{
+    static_assert(std::is_integral_v<I> && std::is_signed_v<I>);
+
+public:
+    using Type = I;
+    constexpr static float Scale = static_cast<float>(std::numeric_limits<I>::max());
+
+    //! Constructors
+    constexpr Snorm();
+    constexpr Snorm(float value);
+
+    constexpr static Snorm FromBits(I bits);
+
+    //! Operators
+    constexpr operator float() const;
+
+public:
+    I bits;
+};
+
+//Unsigned normalised integer, value / max() in [0, 1]. Floats are clamped and
+//rounded to nearest, NaN is stored as 0
+template<typename I>
+struct Unorm
+{
+    static_assert(std::is_integral_v<I> && std::is_unsigned_v<I>);
+
+public:
+    using Type = I;
+    constexpr static float Scale = static_cast<float>(std::numeric_limits<I>::max());
+
+    //! Constructors
+    constexpr Unorm();
+    constexpr Unorm(float value);
+
+    constexpr static Unorm FromBits(I bits);
+
+    //! Operators
+    constexpr operator float() const;
+
+public:
+    I bits;
+};
+
+//Instantiate common templates
+template struct Snorm<int8_t>;
+template struct Snorm<int16_t>;
+template struct Unorm<uint8_t>;
+template struct Unorm<uint16_t>;
+
+using Snorm8  = Snorm<int8_t>;
+using Snorm16 = Snorm<int16_t>;
+using Unorm8  = Unorm<uint8_t>;
+using Unorm16 = Unorm<uint16_t>;
+
+using Vec2Snorm8  = Vector2<Snorm8>;
+using Vec3Snorm8  = Vector3<Snorm8>;
+using Vec4Snorm8  = Vector4<Snorm8>;
+using Vec2Snorm16 = Vector2<Snorm16>;
+using Vec3Snorm16 = Vector3<Snorm16>;
+using Vec4Snorm16 = Vector4<Snorm16>;
+using Vec2Unorm8  = Vector2<Unorm8>;
+using Vec3Unorm8  = Vector3<Unorm8>;
+using Vec4Unorm8  = Vector4<Unorm8>;
+using Vec2Unorm16 = Vector2<Unorm16>;
+using Vec3Unorm16 = Vector3<Unorm16>;
+using Vec4Unorm16 = Vector4<Unorm16>;
+
+} //namespace math
+
+#include "Normalized.inl"
@@ -0,0 +1,79 @@
+namespace math
+{
+
+namespace detail
+{
+
+//NaN becomes 0, everything else is clamped to [low, 1]
+constexpr float ClampNormalized(float value, float low)
+{
+    if(value != value)
+    {
+        return 0;
+    }
+
+    return value < low ? low : (value > 1 ? 1 : value);
+}
+
+//Rounds to nearest even like cvtps2dq in the SIMD kernels. Adding 1.5 * 2^23
+//leaves no fraction bits, so the FPU does the rounding (|value| < 2^22). When
+//the compiler fuses the scale into this add (FMA builds) results can differ
+//from the SIMD path by 1 on values that sit right next to a tie
+constexpr float RoundNormalized(float value)
+{
+    constexpr float magic = 12582912.0f;
+    return (value + magic) - magic;
+}
+
+} //namespace detail
+
+//! Constructors
+template<typename I>
+constexpr Snorm<I>::Snorm() : bits{0} { }
+
+template<typename I>
+constexpr Snorm<I>::Snorm(float value) : bits{0}
+{
+    bits = static_cast<I>(detail::RoundNormalized(detail::ClampNormalized(value, -1) * Scale));
+}
+
+template<typename I>
+constexpr Snorm<I> Snorm<I>::FromBits(I bits)
+{
+    Snorm result;
+    result.bits = bits;
+    return result;
+}
+
+template<typename I>
+constexpr Unorm<I>::Unorm() : bits{0} { }
+
+template<typename I>
+constexpr Unorm<I>::Unorm(float value) : bits{0}
+{
+    bits = static_cast<I>(detail::RoundNormalized(detail::ClampNormalized(value, 0) * Scale));
+}
+
+template<typename I>
+constexpr Unorm<I> Unorm<I>::FromBits(I bits)
+{
+    Unorm result;
+    result.bits = bits;
+    return result;
+}
+
+//! Operators
+template<typename I>
+constexpr Snorm<I>::operator float() const
+{
+    float value = bits * (1 / Scale);
+    return value < -1.0f ? -1.0f : value;
+}
+
+template<typename I>
+constexpr Unorm<I>::operator float() const
+{
+    return bits * (1 / Scale);
+}
+
+} //namespace math
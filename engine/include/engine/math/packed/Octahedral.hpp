@@ -0,0 +1,25 @@
+#pragma once
+#include "Normalized.hpp"
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+
+namespace math
+{
+
+//Octahedral normal encoding. A unit vector is projected on the octahedron
+//|x| + |y| + |z| = 1 and the lower half is folded over the diagonals, giving
+//a point in [-1, 1]^2 that quantises evenly over the sphere. Stored as
+//Snorm16 pairs (4 bytes) the max angular error is ~0.004 degrees, as Snorm8
+//pairs (2 bytes) ~1 degree
+template<typename T>
+constexpr Vector2<T> EncodeOctahedral(const Vector3<T>& normal);
+//Returns a normalised vector
+template<typename T>
+constexpr Vector3<T> DecodeOctahedral(const Vector2<T>& encoded);
+
+using OctNormal16 = Vector2<Snorm8>;
+using OctNormal32 = Vector2<Snorm16>;
+
+} //namespace math
+
+#include "Octahedral.inl"
@@ -0,0 +1,43 @@
+namespace math
+{
+
+template<typename T>
+constexpr Vector2<T> EncodeOctahedral(const Vector3<T>& normal)
+{
+    T ax = normal.x < 0 ? -normal.x : normal.x;
+    T ay = normal.y < 0 ? -normal.y : normal.y;
+    T az = normal.z < 0 ? -normal.z : normal.z;
+
+    T invL1 = 1 / (ax + ay + az);
+    T x     = normal.x * invL1;
+    T y     = normal.y * invL1;
+
+    //Fold the lower hemisphere over the diagonals of the square
+    if(normal.z < 0)
+    {
+        T fx = (1 - ay * invL1) * (x >= 0 ? 1 : -1);
+        T fy = (1 - ax * invL1) * (y >= 0 ? 1 : -1);
+
+        x = fx;
+        y = fy;
+    }
+
+    return Vector2<T>(x, y);
+}
+
+template<typename T>
+constexpr Vector3<T> DecodeOctahedral(const Vector2<T>& encoded)
+{
+    T ax = encoded.x < 0 ? -encoded.x : encoded.x;
+    T ay = encoded.y < 0 ? -encoded.y : encoded.y;
+    T z  = 1 - ax - ay;
+
+    //Unfold, t is only non zero on the lower hemisphere
+    T t = z < 0 ? -z : 0;
+    T x = encoded.x >= 0 ? encoded.x - t : encoded.x + t;
+    T y = encoded.y >= 0 ? encoded.y - t : encoded.y + t;
+
+    return Vector3<T>(x, y, z).GetNormalized();
+}
+
+} //namespace math
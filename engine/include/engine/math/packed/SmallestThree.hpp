@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include "../quat/Quaternion.hpp"
+
+namespace math
+{
+
+//Smallest three quaternion compression. q and -q are the same rotation, so the
+//largest component is made positive and dropped, the other three lie in
+//[-1 / sqrt(2), 1 / sqrt(2)] and are quantised to ComponentBits each. The
+//index of the dropped component takes 2 more bits. The top code is unused so
+//0 falls exactly on a step and single axis rotations decode exactly. Rotations
+//are expected to be normalised
+template<int32_t ComponentBits>
+struct SmallestThree
+{
+    static_assert(ComponentBits > 0 && ComponentBits <= 20);
+
+public:
+    constexpr static int32_t  Bits     = 2 + 3 * ComponentBits;
+    constexpr static int32_t  Words    = (Bits + 15) / 16;
+    //Largest quantised value, even so 0 maps to MaxValue / 2
+    constexpr static uint32_t MaxValue = (1u << ComponentBits) - 2;
+    //Largest error on a single decoded component, half a quantisation step
+    constexpr static float    MaxComponentError = 0.70710678f / MaxValue;
+
+    //! Constructors
+    constexpr SmallestThree();
+    constexpr explicit SmallestThree(const Quaternion<float>& rotation);
+
+    //! Operations
+    constexpr Quaternion<float> ToQuaternion() const;
+
+public:
+    //Stored as 16 bit words so the 48 bit variant stays 6 bytes
+    uint16_t words[Words];
+};
+
+//Instantiate common templates
+template struct SmallestThree<10>;
+template struct SmallestThree<15>;
+
+//~0.24 and ~0.008 degrees max rotation error
+using Quat32 = SmallestThree<10>;
+using Quat48 = SmallestThree<15>;
+
+} //namespace math
+
+#include "SmallestThree.inl"
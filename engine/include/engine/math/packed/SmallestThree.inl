@@ -0,0 +1,85 @@
+#include "Normalized.hpp"
+#include "../Functions.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<int32_t ComponentBits>
+constexpr SmallestThree<ComponentBits>::SmallestThree() : words{}
+{
+    //Identity, w is the dropped component and the others sit at the midpoint
+    *this = SmallestThree(Quaternion<float>(0, 0, 0, 1));
+}
+
+template<int32_t ComponentBits>
+constexpr SmallestThree<ComponentBits>::SmallestThree(const Quaternion<float>& rotation) : words{}
+{
+    //The first of equal components wins, like in the SIMD encoder
+    int32_t largest = 0;
+    float maxAbs    = rotation[0] < 0 ? -rotation[0] : rotation[0];
+
+    for(int32_t i = 1; i < 4; ++i)
+    {
+        float a = rotation[i] < 0 ? -rotation[i] : rotation[i];
+
+        if(maxAbs < a)
+        {
+            maxAbs  = a;
+            largest = i;
+        }
+    }
+
+    float sign      = rotation[largest] < 0 ? -1.0f : 1.0f;
+    uint64_t packed = static_cast<uint64_t>(largest);
+
+    for(int32_t i = 0; i < 4; ++i)
+    {
+        if(i != largest)
+        {
+            float q = (rotation[i] * sign * 1.41421356f + 1) * (0.5f * MaxValue);
+            q       = detail::RoundNormalized(q < 0 ? 0 : (q > MaxValue ? MaxValue : q));
+            packed  = (packed << ComponentBits) | static_cast<uint64_t>(q);
+        }
+    }
+
+    for(int32_t i = 0; i < Words; ++i)
+    {
+        words[i] = static_cast<uint16_t>(packed >> (16 * i));
+    }
+}
+
+//! Operations
+template<int32_t ComponentBits>
+constexpr Quaternion<float> SmallestThree<ComponentBits>::ToQuaternion() const
+{
+    //Centred in integers first so the midpoint decodes to exactly 0
+    constexpr float scale    = 2 / (MaxValue * 1.41421356f);
+    constexpr int64_t middle = MaxValue / 2;
+
+    uint64_t packed = 0;
+    for(int32_t i = 0; i < Words; ++i)
+    {
+        packed |= static_cast<uint64_t>(words[i]) << (16 * i);
+    }
+
+    constexpr uint64_t mask = (1u << ComponentBits) - 1;
+
+    int32_t largest = static_cast<int32_t>(packed >> (3 * ComponentBits)) & 3;
+    float a         = (static_cast<int64_t>(packed >> (2 * ComponentBits) & mask) - middle) * scale;
+    float b         = (static_cast<int64_t>(packed >> ComponentBits & mask) - middle) * scale;
+    float c         = (static_cast<int64_t>(packed & mask) - middle) * scale;
+
+    float d2 = 1 - (a * a + b * b + c * c);
+    float d  = d2 > 0 ? Sqrt(d2) : 0;
+
+    switch(largest)
+    {
+        case 0:  return Quaternion<float>(d, a, b, c);
+        case 1:  return Quaternion<float>(a, d, b, c);
+        case 2:  return Quaternion<float>(a, b, d, c);
+        default: return Quaternion<float>(a, b, c, d);
+    }
+}
+
+} //namespace math
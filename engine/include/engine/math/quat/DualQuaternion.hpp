@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "Quaternion.hpp"
+#include "../vector/Vector3.hpp"
+
+namespace math
+{
+
+template<typename T>
+struct Matrix4;
+
+//Rigid transform as real + dual * e where real is the rotation and
+//dual = 0.5 * (translation, 0) * real. Composition follows quaternions,
+//(a * b) applies b first
+template<typename T>
+struct DualQuaternion
+{
+public:
+    using Type = T;
+    constexpr static int32_t Size        = 8;
+    constexpr static int32_t SizeInBytes = sizeof(T) * Size;
+
+    //! Constructors
+    constexpr DualQuaternion();
+    constexpr DualQuaternion(const Quaternion<T>& real, const Quaternion<T>& dual);
+    constexpr DualQuaternion(const Quaternion<T>& rotation, const Vector3<T>& translation);
+
+    //! Operators
+    constexpr DualQuaternion  operator+(const DualQuaternion& other) const;
+    constexpr DualQuaternion& operator+=(const DualQuaternion& other);
+    constexpr DualQuaternion  operator*(const T value) const;
+    constexpr DualQuaternion& operator*=(const T value);
+    constexpr DualQuaternion  operator*(const DualQuaternion& other) const;
+    constexpr DualQuaternion& operator*=(const DualQuaternion& other);
+    constexpr bool            operator==(const DualQuaternion& other) const;
+    constexpr bool            operator!=(const DualQuaternion& other) const;
+
+    //! Operations
+    constexpr T              Dot(const DualQuaternion& other) const;
+    //Divides by the length of the real part. Blended dual quaternions only
+    //need this to be rigid again
+    constexpr DualQuaternion GetNormalized() const;
+    //Inverse of a normalised dual quaternion
+    constexpr DualQuaternion GetConjugated() const;
+    constexpr Quaternion<T>  GetRotation() const;
+    constexpr Vector3<T>     GetTranslation() const;
+    constexpr Vector3<T>     TransformPoint(const Vector3<T>& p) const;
+    constexpr Vector3<T>     TransformDirection(const Vector3<T>& d) const;
+    constexpr Matrix4<T>     ToMatrix4() const;
+
+public:
+    Quaternion<T> real, dual;
+};
+template struct DualQuaternion<float>;
+template struct DualQuaternion<double>;
+
+using DualQuat  = DualQuaternion<float>;
+using DualQuatd = DualQuaternion<double>;
+
+} //namespace math
+
+#include "DualQuaternion.inl"
@@ -0,0 +1,148 @@
+#include <cmath>
+#include "../matrix/Matrix4.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion() : real{0, 0, 0, 1}, dual{0, 0, 0, 0} { }
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion(const Quaternion<T>& real, const Quaternion<T>& dual) : 
+    real{real}, dual{dual} { }
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion(const Quaternion<T>& rotation, const Vector3<T>& translation) : 
+    real{rotation}, dual{Quaternion<T>(translation.x, translation.y, translation.z, 0) * rotation * T(0.5)} { }
+
+//! Operators
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::operator+(const DualQuaternion<T>& other) const
+{
+    return DualQuaternion(real + other.real, dual + other.dual);
+}
+
+template<typename T>
+constexpr DualQuaternion<T>& DualQuaternion<T>::operator+=(const DualQuaternion<T>& other)
+{
+    real += other.real;
+    dual += other.dual;
+
+    return *this;
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::operator*(const T value) const
+{
+    return DualQuaternion(real * value, dual * value);
+}
+
+template<typename T>
+constexpr DualQuaternion<T>& DualQuaternion<T>::operator*=(const T value)
+{
+    real *= value;
+    dual *= value;
+
+    return *this;
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::operator*(const DualQuaternion<T>& other) const
+{
+    return DualQuaternion(real * other.real, real * other.dual + dual * other.real);
+}
+
+template<typename T>
+constexpr DualQuaternion<T>& DualQuaternion<T>::operator*=(const DualQuaternion<T>& other)
+{
+    *this = *this * other;
+
+    return *this;
+}
+
+template<typename T>
+constexpr bool DualQuaternion<T>::operator==(const DualQuaternion<T>& other) const
+{
+    return real == other.real && dual == other.dual;
+}
+
+template<typename T>
+constexpr bool DualQuaternion<T>::operator!=(const DualQuaternion<T>& other) const
+{
+    return !(*this == other);
+}
+
+//! Operations
+template<typename T>
+constexpr T DualQuaternion<T>::Dot(const DualQuaternion<T>& other) const
+{
+    return real.Dot(other.real);
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::GetNormalized() const
+{
+    T invL = 1 / real.Length();
+
+    return DualQuaternion(real * invL, dual * invL);
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::GetConjugated() const
+{
+    return DualQuaternion(real.GetConjugated(), dual.GetConjugated());
+}
+
+template<typename T>
+constexpr Quaternion<T> DualQuaternion<T>::GetRotation() const
+{
+    return real;
+}
+
+//translation = 2 * dual * conjugate(real)
+template<typename T>
+constexpr Vector3<T> DualQuaternion<T>::GetTranslation() const
+{
+    return Vector3<T>(
+        2 * (-dual.w * real.x + dual.x * real.w - dual.y * real.z + dual.z * real.y),
+        2 * (-dual.w * real.y + dual.x * real.z + dual.y * real.w - dual.z * real.x),
+        2 * (-dual.w * real.z - dual.x * real.y + dual.y * real.x + dual.z * real.w)
+    );
+}
+
+template<typename T>
+constexpr Vector3<T> DualQuaternion<T>::TransformPoint(const Vector3<T>& p) const
+{
+    return TransformDirection(p) + GetTranslation();
+}
+
+//v' = v + w * t + cross(q.xyz, t) where t = 2 * cross(q.xyz, v)
+template<typename T>
+constexpr Vector3<T> DualQuaternion<T>::TransformDirection(const Vector3<T>& d) const
+{
+    T tx = 2 * (real.y * d.z - real.z * d.y);
+    T ty = 2 * (real.z * d.x - real.x * d.z);
+    T tz = 2 * (real.x * d.y - real.y * d.x);
+
+    return Vector3<T>(
+        d.x + real.w * tx + real.y * tz - real.z * ty,
+        d.y + real.w * ty + real.z * tx - real.x * tz,
+        d.z + real.w * tz + real.x * ty - real.y * tx
+    );
+}
+
+template<typename T>
+constexpr Matrix4<T> DualQuaternion<T>::ToMatrix4() const
+{
+    Matrix4<T> m = real.ToMatrix4();
+    Vector3<T> t = GetTranslation();
+
+    m.arr[12] = t.x;
+    m.arr[13] = t.y;
+    m.arr[14] = t.z;
+
+    return m;
+}
+
+} //namespace math
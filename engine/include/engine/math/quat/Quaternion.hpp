@@ -43,10 +43,15 @@ public:
     constexpr T                 LengthSquared() const;
     constexpr Quaternion        GetNormalized() const;
     constexpr Quaternion        GetSafeNormalized() const;
+    //Rsqrt based, max relative error ~5e-7 for float
+    constexpr Quaternion        GetFastNormalized() const;
     constexpr Quaternion        GetConjugated() const;
     constexpr Quaternion        GetInverse() const;
     constexpr Matrix4<T>        ToMatrix4() const;
     constexpr static Quaternion FromAxis(const Vector3<T>& axis, T radians);
+    constexpr static Quaternion Nlerp(const Quaternion& a, const Quaternion& b, T t);
+    constexpr static Quaternion Slerp(const Quaternion& a, const Quaternion& b, T t);
+    constexpr static Quaternion FastSlerp(const Quaternion& a, const Quaternion& b, T t);
 
 public:
     T x, y, z, w;
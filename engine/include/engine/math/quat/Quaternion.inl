@@ -1,4 +1,5 @@
 #include <cmath>
+#include "../Functions.hpp"
 #include "../matrix/Matrix4.hpp"
 
 namespace math
@@ -174,7 +175,7 @@ constexpr T Quaternion<T>::Dot(const Quaternion& other) const
 template<typename T>
 constexpr T Quaternion<T>::Length() const
 {
-    return std::sqrt(x * x + y * y + z * z + w * w);
+    return Sqrt(x * x + y * y + z * z + w * w);
 }
 
 template<typename T>
@@ -186,7 +187,15 @@ constexpr T Quaternion<T>::LengthSquared() const
 template<typename T>
 constexpr Quaternion<T> Quaternion<T>::GetNormalized() const
 {
-    T invL = 1 / std::sqrt(x * x + y * y + z * z + w * w);
+    T invL = 1 / Sqrt(x * x + y * y + z * z + w * w);
+
+    return Quaternion(x * invL, y * invL, z * invL, w * invL);
+}
+
+template<typename T>
+constexpr Quaternion<T> Quaternion<T>::GetFastNormalized() const
+{
+    T invL = FastInvSqrt(x * x + y * y + z * z + w * w);
 
     return Quaternion(x * invL, y * invL, z * invL, w * invL);
 }
@@ -194,7 +203,7 @@ constexpr Quaternion<T> Quaternion<T>::GetNormalized() const
 template<typename T>
 constexpr Quaternion<T> Quaternion<T>::GetSafeNormalized() const
 {
-    T l = std::sqrt(x * x + y * y + z * z + w * w);
+    T l = Sqrt(x * x + y * y + z * z + w * w);
 
     if(l != 0)
     {
@@ -255,10 +264,72 @@ template<typename T>
 constexpr Quaternion<T> Quaternion<T>::FromAxis(const Vector3<T>& axis, T radians)
 {
     T halfAngle = radians * 0.5;
-    T cos       = std::cos(halfAngle);
-    T sin       = std::sin(halfAngle);
+    T cos       = Cos(halfAngle);
+    T sin       = Sin(halfAngle);
 
     return Quaternion(sin * axis.x, sin * axis.y, sin * axis.z, cos);
 }
 
+//Normalized linear interpolation through the shortest path
+template<typename T>
+constexpr Quaternion<T> Quaternion<T>::Nlerp(const Quaternion<T>& a, const Quaternion<T>& b, T t)
+{
+    T tb = a.Dot(b) < 0 ? -t : t;
+    T ta = 1 - t;
+
+    return Quaternion(
+        a.x * ta + b.x * tb,
+        a.y * ta + b.y * tb,
+        a.z * ta + b.z * tb,
+        a.w * ta + b.w * tb
+    ).GetNormalized();
+}
+
+//Spherical linear interpolation through the shortest path
+template<typename T>
+constexpr Quaternion<T> Quaternion<T>::Slerp(const Quaternion<T>& a, const Quaternion<T>& b, T t)
+{
+    T cos  = a.Dot(b);
+    T sign = 1;
+
+    if(cos < 0)
+    {
+        cos  = -cos;
+        sign = -1;
+    }
+
+    //Fall back to nlerp when the angle is too small to divide by its sine
+    if(cos > static_cast<T>(0.9995))
+    {
+        return Nlerp(a, b, t);
+    }
+
+    T angle  = Acos(cos);
+    T invSin = 1 / Sin(angle);
+    T ta     = Sin((1 - t) * angle) * invSin;
+    T tb     = Sin(t * angle) * invSin * sign;
+
+    return Quaternion(
+        a.x * ta + b.x * tb,
+        a.y * ta + b.y * tb,
+        a.z * ta + b.z * tb,
+        a.w * ta + b.w * tb
+    );
+}
+
+//Nlerp with a corrected t that stays close to slerp without needing acos or sin
+//(https://zeux.io/2015/07/23/approximating-slerp/)
+template<typename T>
+constexpr Quaternion<T> Quaternion<T>::FastSlerp(const Quaternion<T>& a, const Quaternion<T>& b, T t)
+{
+    T d  = a.Dot(b);
+    d    = d < 0 ? -d : d;
+    T ka = static_cast<T>(1.0904) + d * (static_cast<T>(-3.2452) + 
+        d * (static_cast<T>(3.55645) - d * static_cast<T>(1.43519)));
+    T kb = static_cast<T>(0.848013) + d * (static_cast<T>(-1.06021) + d * static_cast<T>(0.215638));
+    T k  = ka * (t - static_cast<T>(0.5)) * (t - static_cast<T>(0.5)) + kb;
+
+    return Nlerp(a, b, t + t * (t - static_cast<T>(0.5)) * (t - 1) * k);
+}
+
 } //namespace math
\ No newline at end of file
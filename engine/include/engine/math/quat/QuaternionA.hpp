@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "Quaternion.hpp"
+#include "../vector/Vector4A.hpp"
+#include "../simd/Simd.hpp"
+
+#if MATH_SIMD_SSE
+
+namespace math
+{
+
+struct Matrix4A;
+
+//16 byte aligned float Quaternion held in a SSE register as (x, y, z, w)
+struct alignas(16) QuaternionA
+{
+public:
+    using Type = float;
+    constexpr static int32_t Size        = 4;
+    constexpr static int32_t SizeInBytes = sizeof(float) * Size;
+
+    //! Constructors
+    QuaternionA();
+    QuaternionA(float x, float y, float z, float w);
+    QuaternionA(__m128 v);
+    QuaternionA(const Quaternion<float>& q);
+
+    //! Operators
+    float&       operator[](std::size_t index);
+    const float& operator[](std::size_t index) const;
+    QuaternionA  operator+(const QuaternionA other) const;
+    QuaternionA& operator+=(const QuaternionA other);
+    QuaternionA  operator-(const QuaternionA other) const;
+    QuaternionA& operator-=(const QuaternionA other);
+    QuaternionA  operator*(const float value) const;
+    QuaternionA& operator*=(const float value);
+    QuaternionA  operator*(const QuaternionA other) const;
+    QuaternionA& operator*=(const QuaternionA other);
+    Vector4A     operator*(const Vector4A v) const;
+    QuaternionA  operator/(const float value) const;
+    QuaternionA& operator/=(const float value);
+    bool         operator==(const QuaternionA other) const;
+    bool         operator!=(const QuaternionA other) const;
+
+    //! Operations
+    float               Dot(const QuaternionA other) const;
+    float               Length() const;
+    float               LengthSquared() const;
+    QuaternionA         GetNormalized() const;
+    QuaternionA         GetSafeNormalized() const;
+    QuaternionA         GetConjugated() const;
+    QuaternionA         GetInverse() const;
+    Matrix4A            ToMatrix4() const;
+    Quaternion<float>   ToQuaternion() const;
+    static QuaternionA  FromAxis(const Vector3<float>& axis, float radians);
+    static QuaternionA  Nlerp(const QuaternionA a, const QuaternionA b, float t);
+    static QuaternionA  Slerp(const QuaternionA a, const QuaternionA b, float t);
+    static QuaternionA  FastSlerp(const QuaternionA a, const QuaternionA b, float t);
+
+public:
+    __m128 v;
+};
+
+using QuatA = QuaternionA;
+
+} //namespace math
+
+#include "QuaternionA.inl"
+
+#endif
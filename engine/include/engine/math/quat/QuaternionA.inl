@@ -0,0 +1,209 @@
+#include "../matrix/Matrix4A.hpp"
+
+namespace math
+{
+
+//! Constructors
+inline QuaternionA::QuaternionA() : v{_mm_setzero_ps()} { }
+
+inline QuaternionA::QuaternionA(float x, float y, float z, float w) : v{_mm_setr_ps(x, y, z, w)} { }
+
+inline QuaternionA::QuaternionA(__m128 v) : v{v} { }
+
+inline QuaternionA::QuaternionA(const Quaternion<float>& q) : v{_mm_loadu_ps(&q.x)} { }
+
+//! Operators
+inline float& QuaternionA::operator[](std::size_t index)
+{
+    return reinterpret_cast<float*>(&v)[index];
+}
+
+inline const float& QuaternionA::operator[](std::size_t index) const
+{
+    return reinterpret_cast<const float*>(&v)[index];
+}
+
+inline QuaternionA QuaternionA::operator+(const QuaternionA other) const
+{
+    return _mm_add_ps(v, other.v);
+}
+
+inline QuaternionA& QuaternionA::operator+=(const QuaternionA other)
+{
+    v = _mm_add_ps(v, other.v);
+
+    return *this;
+}
+
+inline QuaternionA QuaternionA::operator-(const QuaternionA other) const
+{
+    return _mm_sub_ps(v, other.v);
+}
+
+inline QuaternionA& QuaternionA::operator-=(const QuaternionA other)
+{
+    v = _mm_sub_ps(v, other.v);
+
+    return *this;
+}
+
+inline QuaternionA QuaternionA::operator*(const float value) const
+{
+    return _mm_mul_ps(v, _mm_set1_ps(value));
+}
+
+inline QuaternionA& QuaternionA::operator*=(const float value)
+{
+    v = _mm_mul_ps(v, _mm_set1_ps(value));
+
+    return *this;
+}
+
+inline QuaternionA QuaternionA::operator*(const QuaternionA other) const
+{
+    __m128 a = _mm_mul_ps(simd::Splat<3>(v), other.v);
+    __m128 b = _mm_mul_ps(simd::Splat<0>(v), simd::Swizzle<3, 2, 1, 0>(other.v));
+    __m128 c = _mm_mul_ps(simd::Splat<1>(v), simd::Swizzle<2, 3, 0, 1>(other.v));
+    __m128 d = _mm_mul_ps(simd::Splat<2>(v), simd::Swizzle<1, 0, 3, 2>(other.v));
+
+    b = _mm_xor_ps(b, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+    c = _mm_xor_ps(c, _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+    d = _mm_xor_ps(d, _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+    return _mm_add_ps(_mm_add_ps(a, b), _mm_add_ps(c, d));
+}
+
+inline QuaternionA& QuaternionA::operator*=(const QuaternionA other)
+{
+    *this = *this * other;
+
+    return *this;
+}
+
+//Rotates the xyz components of the vector, w is left untouched
+inline Vector4A QuaternionA::operator*(const Vector4A other) const
+{
+    //cross(a, b) = a.yzx * b.zxy - a.zxy * b.yzx. The w lane ends up as 0
+    auto cross = [](__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(simd::Swizzle<1, 2, 0, 3>(a), simd::Swizzle<2, 0, 1, 3>(b)),
+            _mm_mul_ps(simd::Swizzle<2, 0, 1, 3>(a), simd::Swizzle<1, 2, 0, 3>(b)));
+    };
+
+    __m128 t = cross(v, other.v);
+    t = _mm_add_ps(t, t);
+
+    return _mm_add_ps(simd::MulAdd(simd::Splat<3>(v), t, other.v), cross(v, t));
+}
+
+inline QuaternionA QuaternionA::operator/(const float value) const
+{
+    return _mm_mul_ps(v, _mm_set1_ps(1 / value));
+}
+
+inline QuaternionA& QuaternionA::operator/=(const float value)
+{
+    v = _mm_mul_ps(v, _mm_set1_ps(1 / value));
+
+    return *this;
+}
+
+inline bool QuaternionA::operator==(const QuaternionA other) const
+{
+    return _mm_movemask_ps(_mm_cmpeq_ps(v, other.v)) == 0xF;
+}
+
+inline bool QuaternionA::operator!=(const QuaternionA other) const
+{
+    return _mm_movemask_ps(_mm_cmpeq_ps(v, other.v)) != 0xF;
+}
+
+//! Operations
+inline float QuaternionA::Dot(const QuaternionA other) const
+{
+    return _mm_cvtss_f32(simd::HorizontalSum(_mm_mul_ps(v, other.v)));
+}
+
+inline float QuaternionA::Length() const
+{
+    return _mm_cvtss_f32(_mm_sqrt_ss(simd::HorizontalSum(_mm_mul_ps(v, v))));
+}
+
+inline float QuaternionA::LengthSquared() const
+{
+    return _mm_cvtss_f32(simd::HorizontalSum(_mm_mul_ps(v, v)));
+}
+
+inline QuaternionA QuaternionA::GetNormalized() const
+{
+    return _mm_div_ps(v, _mm_sqrt_ps(simd::HorizontalSum(_mm_mul_ps(v, v))));
+}
+
+inline QuaternionA QuaternionA::GetSafeNormalized() const
+{
+    __m128 l = _mm_sqrt_ps(simd::HorizontalSum(_mm_mul_ps(v, v)));
+
+    if(_mm_cvtss_f32(l) != 0)
+    {
+        return _mm_div_ps(v, l);
+    }
+
+    return v;
+}
+
+inline QuaternionA QuaternionA::GetConjugated() const
+{
+    return _mm_xor_ps(v, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+}
+
+inline QuaternionA QuaternionA::GetInverse() const
+{
+    return _mm_div_ps(GetConjugated().v, simd::HorizontalSum(_mm_mul_ps(v, v)));
+}
+
+inline Matrix4A QuaternionA::ToMatrix4() const
+{
+    return Matrix4A(ToQuaternion().ToMatrix4());
+}
+
+inline Quaternion<float> QuaternionA::ToQuaternion() const
+{
+    Quaternion<float> q;
+    _mm_storeu_ps(&q.x, v);
+
+    return q;
+}
+
+inline QuaternionA QuaternionA::FromAxis(const Vector3<float>& axis, float radians)
+{
+    return QuaternionA(Quaternion<float>::FromAxis(axis, radians));
+}
+
+inline QuaternionA QuaternionA::Nlerp(const QuaternionA a, const QuaternionA b, float t)
+{
+    __m128 sign = _mm_and_ps(simd::HorizontalSum(_mm_mul_ps(a.v, b.v)), _mm_set1_ps(-0.0f));
+    __m128 tb   = _mm_xor_ps(_mm_set1_ps(t), sign);
+    __m128 r    = simd::MulAdd(b.v, tb, _mm_mul_ps(a.v, _mm_set1_ps(1 - t)));
+
+    return QuaternionA(r).GetNormalized();
+}
+
+inline QuaternionA QuaternionA::Slerp(const QuaternionA a, const QuaternionA b, float t)
+{
+    return Quaternion<float>::Slerp(a.ToQuaternion(), b.ToQuaternion(), t);
+}
+
+//See Quaternion::FastSlerp
+inline QuaternionA QuaternionA::FastSlerp(const QuaternionA a, const QuaternionA b, float t)
+{
+    float d  = a.Dot(b);
+    d        = d < 0 ? -d : d;
+    float ka = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+    float kb = 0.848013f + d * (-1.06021f + d * 0.215638f);
+    float k  = ka * (t - 0.5f) * (t - 0.5f) + kb;
+
+    return Nlerp(a, b, t + t * (t - 0.5f) * (t - 1) * k);
+}
+
+} //namespace math
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "../quat/Quaternion.hpp"
+
+namespace math
+{
+
+//Lanes independent xoshiro128** streams seeded through SplitMix64. The Fill
+//functions sample a whole step of every lane at once, 4 (SSE) or 8 (AVX2)
+//lanes per register, and the single value functions take the values of one
+//step in turn. The same seed and call sequence give the same raw bits with
+//or without SIMD, float outputs can differ in the last bits where FMA or the
+//SIMD transcendentals are used. Fill calls consume whole steps so a span
+//whose size is not a multiple of the block size discards the rest of the
+//last block. Not suitable for cryptography
+struct Random
+{
+public:
+    constexpr static std::size_t Lanes = 8;
+
+    //! Constructors
+    constexpr Random();
+    //Jobs running in parallel should share the seed and use their own stream
+    //index so the results do not depend on scheduling
+    constexpr explicit Random(uint64_t seed, uint64_t stream = 0);
+
+    //! Single values
+    constexpr uint32_t NextBits();
+    //[0, 1)
+    constexpr float    NextFloat();
+    //[min, max)
+    constexpr float    NextFloat(float min, float max);
+    //[min, max]
+    constexpr int32_t  NextInt(int32_t min, int32_t max);
+
+    //! Batched sampling
+    void FillBits(std::span<uint32_t> output);
+    //[min, max)
+    void FillUniform(std::span<float> output, float min = 0, float max = 1);
+    //[min, max], the bias of the multiply and shift mapping is below (max - min + 1) / 2^32
+    void FillUniform(std::span<int32_t> output, int32_t min, int32_t max);
+    //Normal distribution, blocks of 2 * Lanes values
+    void FillGaussian(std::span<float> output, float mean = 0, float deviation = 1);
+    //Unit vectors
+    void FillOnUnitSphere(std::span<Vector3<float>> output);
+    //Points inside the unit ball
+    void FillInUnitSphere(std::span<Vector3<float>> output);
+    //Points inside the unit disk
+    void FillInUnitDisk(std::span<Vector2<float>> output);
+    //Normalised rotations, uniform over SO(3)
+    void FillRotations(std::span<Quaternion<float>> output);
+
+private:
+    constexpr void Step(uint32_t* output);
+
+    //Fills the part of output past start through a full block
+    template<std::size_t BlockSize, typename T, typename Func>
+    static void FillTail(std::span<T> output, std::size_t start, const Func& fill);
+
+private:
+    //s0..., s1..., s2..., s3..., the layout of simd/RandomSimd.hpp
+    alignas(32) uint32_t m_state[4 * Lanes];
+    uint32_t m_values[Lanes];
+    std::size_t m_next;
+};
+
+} //namespace math
+
+#include "Random.inl"
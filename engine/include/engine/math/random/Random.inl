@@ -0,0 +1,334 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "../simd/RandomSimd.hpp"
+
+namespace math
+{
+
+static_assert(Random::Lanes == simd::RandomLanes);
+
+namespace detail
+{
+
+constexpr uint64_t SplitMix64(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr uint32_t RotateLeft(uint32_t value, int32_t shift)
+{
+    return (value << shift) | (value >> (32 - shift));
+}
+
+//Top 24 bits to [0, 1), like simd::ToUniform
+constexpr float BitsToUniform(uint32_t bits)
+{
+    return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+//[-pi, pi)
+constexpr float BitsToAngle(uint32_t bits)
+{
+    return BitsToUniform(bits) * 6.28318530717958648f - 3.14159265358979324f;
+}
+
+inline Vector3<float> BitsToDirection(uint32_t heightBits, uint32_t angleBits)
+{
+    float z      = BitsToUniform(heightBits) * 2 - 1;
+    float radius = std::sqrt(std::max(0.0f, 1 - z * z));
+    float angle  = BitsToAngle(angleBits);
+
+    return Vector3<float>(radius * std::cos(angle), radius * std::sin(angle), z);
+}
+
+} //namespace detail
+
+//! Constructors
+constexpr Random::Random() : Random(0) { }
+
+constexpr Random::Random(uint64_t seed, uint64_t stream) : m_state{}, m_values{}, m_next{Lanes}
+{
+    //The stream goes through one round on its own so consecutive streams of
+    //consecutive seeds do not start on the same sequence
+    uint64_t sequence = stream;
+    sequence          = seed ^ detail::SplitMix64(sequence);
+
+    for(std::size_t lane = 0; lane < Lanes; ++lane)
+    {
+        uint64_t a = detail::SplitMix64(sequence);
+        uint64_t b = detail::SplitMix64(sequence);
+
+        m_state[lane]             = static_cast<uint32_t>(a);
+        m_state[Lanes + lane]     = static_cast<uint32_t>(a >> 32);
+        m_state[Lanes * 2 + lane] = static_cast<uint32_t>(b);
+        m_state[Lanes * 3 + lane] = static_cast<uint32_t>(b >> 32);
+    }
+}
+
+//! Single values
+constexpr uint32_t Random::NextBits()
+{
+    if(m_next == Lanes)
+    {
+        Step(m_values);
+        m_next = 0;
+    }
+
+    return m_values[m_next++];
+}
+
+constexpr float Random::NextFloat()
+{
+    return detail::BitsToUniform(NextBits());
+}
+
+constexpr float Random::NextFloat(float min, float max)
+{
+    return NextFloat() * (max - min) + min;
+}
+
+constexpr int32_t Random::NextInt(int32_t min, int32_t max)
+{
+    uint32_t range  = static_cast<uint32_t>(max) - static_cast<uint32_t>(min) + 1;
+    uint32_t bits   = NextBits();
+    uint32_t offset = range == 0 ? bits : static_cast<uint32_t>((static_cast<uint64_t>(bits) * range) >> 32);
+
+    return static_cast<int32_t>(static_cast<uint32_t>(min) + offset);
+}
+
+//! Batched sampling
+inline void Random::FillBits(std::span<uint32_t> output)
+{
+    std::size_t count = output.size() / Lanes;
+#if MATH_SIMD_SSE
+    simd::RandomBits(m_state, output.data(), count);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        Step(output.data() + i * Lanes);
+    }
+#endif
+
+    FillTail<Lanes>(output, count * Lanes, [this](std::span<uint32_t> block) { FillBits(block); });
+}
+
+inline void Random::FillUniform(std::span<float> output, float min, float max)
+{
+    std::size_t count = output.size() / Lanes;
+#if MATH_SIMD_SSE
+    simd::RandomUniform(m_state, output.data(), count, min, max);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits[Lanes];
+        Step(bits);
+
+        for(std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            output[i * Lanes + lane] = detail::BitsToUniform(bits[lane]) * (max - min) + min;
+        }
+    }
+#endif
+
+    FillTail<Lanes>(output, count * Lanes, [&](std::span<float> block) { FillUniform(block, min, max); });
+}
+
+inline void Random::FillUniform(std::span<int32_t> output, int32_t min, int32_t max)
+{
+    assert(min <= max);
+
+    uint32_t range    = static_cast<uint32_t>(max) - static_cast<uint32_t>(min) + 1;
+    std::size_t count = output.size() / Lanes;
+#if MATH_SIMD_SSE
+    simd::RandomUniformInt(m_state, output.data(), count, min, range);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits[Lanes];
+        Step(bits);
+
+        for(std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            uint32_t offset = range == 0 ? bits[lane] :
+                static_cast<uint32_t>((static_cast<uint64_t>(bits[lane]) * range) >> 32);
+            output[i * Lanes + lane] = static_cast<int32_t>(static_cast<uint32_t>(min) + offset);
+        }
+    }
+#endif
+
+    FillTail<Lanes>(output, count * Lanes, [&](std::span<int32_t> block) { FillUniform(block, min, max); });
+}
+
+inline void Random::FillGaussian(std::span<float> output, float mean, float deviation)
+{
+    constexpr std::size_t BlockSize = Lanes * 2;
+
+    std::size_t count = output.size() / BlockSize;
+#if MATH_SIMD_SSE
+    simd::RandomGaussian(m_state, output.data(), count, mean, deviation);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        uint32_t radii[Lanes], angles[Lanes];
+        Step(radii);
+        Step(angles);
+
+        for(std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            float radius = std::sqrt(-2 * std::log(1 - detail::BitsToUniform(radii[lane])));
+            float angle  = detail::BitsToAngle(angles[lane]);
+
+            output[i * BlockSize + lane]         = radius * std::cos(angle) * deviation + mean;
+            output[i * BlockSize + Lanes + lane] = radius * std::sin(angle) * deviation + mean;
+        }
+    }
+#endif
+
+    FillTail<BlockSize>(output, count * BlockSize, [&](std::span<float> block) { FillGaussian(block, mean, deviation); });
+}
+
+inline void Random::FillOnUnitSphere(std::span<Vector3<float>> output)
+{
+    std::size_t count = output.size() / Lanes;
+#if MATH_SIMD_SSE
+    simd::RandomOnUnitSphere(m_state, reinterpret_cast<float*>(output.data()), count);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        uint32_t heights[Lanes], angles[Lanes];
+        Step(heights);
+        Step(angles);
+
+        for(std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            output[i * Lanes + lane] = detail::BitsToDirection(heights[lane], angles[lane]);
+        }
+    }
+#endif
+
+    FillTail<Lanes>(output, count * Lanes, [this](std::span<Vector3<float>> block) { FillOnUnitSphere(block); });
+}
+
+inline void Random::FillInUnitSphere(std::span<Vector3<float>> output)
+{
+    std::size_t count = output.size() / Lanes;
+#if MATH_SIMD_SSE
+    simd::RandomInUnitSphere(m_state, reinterpret_cast<float*>(output.data()), count);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        uint32_t heights[Lanes], angles[Lanes], radii[Lanes];
+        Step(heights);
+        Step(angles);
+        Step(radii);
+
+        for(std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            output[i * Lanes + lane] = detail::BitsToDirection(heights[lane], angles[lane]) *
+                std::cbrt(detail::BitsToUniform(radii[lane]));
+        }
+    }
+#endif
+
+    FillTail<Lanes>(output, count * Lanes, [this](std::span<Vector3<float>> block) { FillInUnitSphere(block); });
+}
+
+inline void Random::FillInUnitDisk(std::span<Vector2<float>> output)
+{
+    std::size_t count = output.size() / Lanes;
+#if MATH_SIMD_SSE
+    simd::RandomInUnitDisk(m_state, reinterpret_cast<float*>(output.data()), count);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        uint32_t radii[Lanes], angles[Lanes];
+        Step(radii);
+        Step(angles);
+
+        for(std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            float radius = std::sqrt(detail::BitsToUniform(radii[lane]));
+            float angle  = detail::BitsToAngle(angles[lane]);
+
+            output[i * Lanes + lane] = Vector2<float>(radius * std::cos(angle), radius * std::sin(angle));
+        }
+    }
+#endif
+
+    FillTail<Lanes>(output, count * Lanes, [this](std::span<Vector2<float>> block) { FillInUnitDisk(block); });
+}
+
+inline void Random::FillRotations(std::span<Quaternion<float>> output)
+{
+    std::size_t count = output.size() / Lanes;
+#if MATH_SIMD_SSE
+    simd::RandomRotations(m_state, reinterpret_cast<float*>(output.data()), count);
+#else
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        uint32_t weights[Lanes], angles0[Lanes], angles1[Lanes];
+        Step(weights);
+        Step(angles0);
+        Step(angles1);
+
+        for(std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            float u      = detail::BitsToUniform(weights[lane]);
+            float a      = std::sqrt(1 - u);
+            float b      = std::sqrt(u);
+            float angle0 = detail::BitsToAngle(angles0[lane]);
+            float angle1 = detail::BitsToAngle(angles1[lane]);
+
+            output[i * Lanes + lane] = Quaternion<float>(a * std::sin(angle0), a * std::cos(angle0),
+                b * std::sin(angle1), b * std::cos(angle1));
+        }
+    }
+#endif
+
+    FillTail<Lanes>(output, count * Lanes, [this](std::span<Quaternion<float>> block) { FillRotations(block); });
+}
+
+//! Private
+constexpr void Random::Step(uint32_t* output)
+{
+    for(std::size_t lane = 0; lane < Lanes; ++lane)
+    {
+        uint32_t s0 = m_state[lane];
+        uint32_t s1 = m_state[Lanes + lane];
+        uint32_t s2 = m_state[Lanes * 2 + lane];
+        uint32_t s3 = m_state[Lanes * 3 + lane];
+
+        output[lane] = detail::RotateLeft(s1 * 5, 7) * 9;
+
+        uint32_t t = s1 << 9;
+        s2        ^= s0;
+        s3        ^= s1;
+        s1        ^= s2;
+        s0        ^= s3;
+        s2        ^= t;
+        s3         = detail::RotateLeft(s3, 11);
+
+        m_state[lane]             = s0;
+        m_state[Lanes + lane]     = s1;
+        m_state[Lanes * 2 + lane] = s2;
+        m_state[Lanes * 3 + lane] = s3;
+    }
+}
+
+template<std::size_t BlockSize, typename T, typename Func>
+void Random::FillTail(std::span<T> output, std::size_t start, const Func& fill)
+{
+    if(start < output.size())
+    {
+        T block[BlockSize];
+        fill(std::span<T>(block, BlockSize));
+
+        std::copy_n(block, output.size() - start, output.begin() + start);
+    }
+}
+
+} //namespace math
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace math::simd
+{
+
+//Allocation alignment that is valid for every SIMD register type in use
+constexpr std::size_t DefaultAlignment = 32;
+
+//Allocates size bytes aligned to alignment. Release with AlignedFree
+inline void* AlignedAlloc(std::size_t size, std::size_t alignment = DefaultAlignment)
+{
+    return ::operator new(size, std::align_val_t{alignment});
+}
+
+inline void AlignedFree(void* ptr, std::size_t alignment = DefaultAlignment) noexcept
+{
+    ::operator delete(ptr, std::align_val_t{alignment});
+}
+
+//Standard allocator that aligns its storage to Alignment bytes
+template<typename T, std::size_t Alignment = DefaultAlignment>
+struct AlignedAllocator
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    constexpr AlignedAllocator() noexcept = default;
+    template<typename U>
+    constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept { }
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* ptr, std::size_t /*count*/) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t{Alignment});
+    }
+
+    template<typename U>
+    constexpr bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+};
+
+//Vector whose storage is aligned for SIMD loads, or to alignof(T) if bigger
+template<typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T, 
+    (alignof(T) > DefaultAlignment ? alignof(T) : DefaultAlignment)>>;
+
+} //namespace math::simd
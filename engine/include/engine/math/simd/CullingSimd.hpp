@@ -0,0 +1,142 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+
+//SIMD frustum culling kernels over structure of arrays bounds. planes holds 6
+//normalised (nx, ny, nz, d) planes facing the inside of the frustum. Indices
+//of the visible objects are appended to visible[visibleCount...], which must
+//have room for count indices. They return the number of elements processed
+//so the caller can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+#if MATH_SIMD_AVX2
+//Byte k of entry mask is the lane of the k-th set bit of mask
+inline constexpr std::array<uint64_t, 256> CompactTable = []()
+{
+    std::array<uint64_t, 256> table {};
+    for(uint32_t mask = 0; mask < 256; ++mask)
+    {
+        uint32_t k = 0;
+        for(uint32_t lane = 0; lane < 8; ++lane)
+        {
+            if(mask & (1u << lane))
+            {
+                table[mask] |= static_cast<uint64_t>(lane) << (8 * k++);
+            }
+        }
+    }
+    return table;
+}();
+
+//Appends the indices of the set lanes of mask. Always stores 8 indices, the
+//ones past the new count are overwritten by the next call
+inline void CompactIndices(int mask, std::size_t first, uint32_t* visible, std::size_t& visibleCount)
+{
+    __m256i lanes   = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(CompactTable[mask])));
+    __m256i indices = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(first)), lanes);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(visible + visibleCount), indices);
+    visibleCount += std::popcount(static_cast<uint32_t>(mask));
+}
+#else
+//Appends the indices of the set lanes of mask without branching
+inline void CompactIndices(int mask, std::size_t first, uint32_t* visible, std::size_t& visibleCount)
+{
+    for(std::size_t j = 0; j < PackWidth; ++j)
+    {
+        visible[visibleCount] = static_cast<uint32_t>(first + j);
+        visibleCount += (mask >> j) & 1;
+    }
+}
+#endif
+
+//Visible when the signed distance to every plane is >= -radius
+inline std::size_t CullSpheres(const float* planes, const float* x, const float* y, const float* z, 
+    const float* radius, std::size_t count, uint32_t* visible, std::size_t& visibleCount)
+{
+    std::size_t i = 0;
+    Pack nx[6], ny[6], nz[6], d[6];
+
+    for(int32_t p = 0; p < 6; ++p)
+    {
+        nx[p] = SetPack(planes[p * 4]);
+        ny[p] = SetPack(planes[p * 4 + 1]);
+        nz[p] = SetPack(planes[p * 4 + 2]);
+        d[p]  = SetPack(planes[p * 4 + 3]);
+    }
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack cx     = LoadPackUnaligned(x + i);
+        Pack cy     = LoadPackUnaligned(y + i);
+        Pack cz     = LoadPackUnaligned(z + i);
+        Pack negR   = Sub(ZeroPack(), LoadPackUnaligned(radius + i));
+        Pack inside = GreaterEqual(MulAdd(nz[0], cz, MulAdd(ny[0], cy, MulAdd(nx[0], cx, d[0]))), negR);
+
+        for(int32_t p = 1; p < 6; ++p)
+        {
+            Pack distance = MulAdd(nz[p], cz, MulAdd(ny[p], cy, MulAdd(nx[p], cx, d[p])));
+            inside = And(inside, GreaterEqual(distance, negR));
+        }
+
+        CompactIndices(MoveMask(inside), i, visible, visibleCount);
+    }
+
+    return i;
+}
+
+//Boxes given as center and half extents. Visible when the signed distance of
+//the center to every plane is >= -dot(abs(n), extents)
+inline std::size_t CullAABBs(const float* planes, const float* x, const float* y, const float* z, 
+    const float* ex, const float* ey, const float* ez, std::size_t count, uint32_t* visible, 
+    std::size_t& visibleCount)
+{
+    std::size_t i = 0;
+    Pack nx[6], ny[6], nz[6], ax[6], ay[6], az[6], d[6];
+
+    for(int32_t p = 0; p < 6; ++p)
+    {
+        nx[p] = SetPack(planes[p * 4]);
+        ny[p] = SetPack(planes[p * 4 + 1]);
+        nz[p] = SetPack(planes[p * 4 + 2]);
+        d[p]  = SetPack(planes[p * 4 + 3]);
+        ax[p] = SetPack(planes[p * 4] < 0 ? -planes[p * 4] : planes[p * 4]);
+        ay[p] = SetPack(planes[p * 4 + 1] < 0 ? -planes[p * 4 + 1] : planes[p * 4 + 1]);
+        az[p] = SetPack(planes[p * 4 + 2] < 0 ? -planes[p * 4 + 2] : planes[p * 4 + 2]);
+    }
+
+    Pack zero = ZeroPack();
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack cx     = LoadPackUnaligned(x + i);
+        Pack cy     = LoadPackUnaligned(y + i);
+        Pack cz     = LoadPackUnaligned(z + i);
+        Pack hx     = LoadPackUnaligned(ex + i);
+        Pack hy     = LoadPackUnaligned(ey + i);
+        Pack hz     = LoadPackUnaligned(ez + i);
+        Pack inside = GreaterEqual(Add(MulAdd(nz[0], cz, MulAdd(ny[0], cy, MulAdd(nx[0], cx, d[0]))), 
+            MulAdd(az[0], hz, MulAdd(ay[0], hy, Mul(ax[0], hx)))), zero);
+
+        for(int32_t p = 1; p < 6; ++p)
+        {
+            Pack distance = MulAdd(nz[p], cz, MulAdd(ny[p], cy, MulAdd(nx[p], cx, d[p])));
+            Pack reach    = MulAdd(az[p], hz, MulAdd(ay[p], hy, Mul(ax[p], hx)));
+            inside = And(inside, GreaterEqual(Add(distance, reach), zero));
+        }
+
+        CompactIndices(MoveMask(inside), i, visible, visibleCount);
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
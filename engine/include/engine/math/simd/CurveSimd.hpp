@@ -0,0 +1,156 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+
+//SIMD evaluation of piecewise cubic curves. Segment s stores its power basis
+//coefficients as 4 aligned float4 (a, b, c, d) at coefficients + s * 16 so
+//p(t) = ((a * t + b) * t + c) * t + d, unused components are 0. Parameters u
+//in [0, 1] cover every segment and are clamped. Outputs are packed
+//float2/float3/float4 by Size. They return the number of values processed so
+//the caller can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//Segment of every lane and the parameter within it
+inline void LocateSegments(Pack u, uint32_t segmentCount, PackInt& segment, Pack& t)
+{
+    Pack count  = ConvertToFloat(SetPackInt(static_cast<int32_t>(segmentCount)));
+    Pack scaled = Mul(Min(Max(u, ZeroPack()), SetPack(1.0f)), count);
+
+    //u = 1 ends on the last segment at t = 1
+    segment = TruncateToInt(Min(scaled, Sub(count, SetPack(1.0f))));
+    t       = Sub(scaled, ConvertToFloat(segment));
+}
+
+//Writes the xy, xyz or xyzw lanes of v
+template<int32_t Size>
+inline void StoreCurveValue(float* ptr, __m128 v)
+{
+    if constexpr (Size == 4)
+    {
+        _mm_storeu_ps(ptr, v);
+    }
+    else
+    {
+        _mm_storel_pi(reinterpret_cast<__m64*>(ptr), v);
+        if constexpr (Size == 3)
+        {
+            _mm_store_ss(ptr + 2, _mm_movehl_ps(v, v));
+        }
+    }
+}
+
+//Value (Derivative false) or derivative with respect to u of every lane of u,
+//written to output + lane * Size. Segments and parameters are found a pack at
+//a time, then every value is one float4 per coefficient row as it is stored,
+//which is cheaper than transposing the rows of PackWidth segments
+template<int32_t Size, bool Derivative, bool Normalize>
+inline void EvaluateSegments(const float* coefficients, uint32_t segmentCount, Pack u, float* output)
+{
+    PackInt segment;
+    Pack t;
+    LocateSegments(u, segmentCount, segment, t);
+
+    alignas(32) int32_t offsets[PackWidth];
+    alignas(32) float parameters[PackWidth];
+    StorePack(reinterpret_cast<float*>(offsets), CastToFloat(ShiftLeftInt<4>(segment)));
+    StorePack(parameters, t);
+
+    const __m128 count = _mm_set1_ps(static_cast<float>(segmentCount));
+    const __m128 three = _mm_set1_ps(3.0f);
+
+    for(std::size_t j = 0; j < PackWidth; ++j)
+    {
+        const float* terms = coefficients + offsets[j];
+        __m128 a           = _mm_load_ps(terms);
+        __m128 b           = _mm_load_ps(terms + 4);
+        __m128 c           = _mm_load_ps(terms + 8);
+        __m128 x           = _mm_set1_ps(parameters[j]);
+        __m128 value;
+
+        if constexpr (Derivative)
+        {
+            //dp/du = segmentCount * ((3a * t + 2b) * t + c)
+            value = Mul(MulAdd(MulAdd(Mul(a, three), x, Add(b, b)), x, c), count);
+        }
+        else
+        {
+            value = MulAdd(MulAdd(MulAdd(a, x, b), x, c), x, _mm_load_ps(terms + 12));
+        }
+
+        if constexpr (Normalize)
+        {
+            value = Div(value, Sqrt(HorizontalSum(Mul(value, value))));
+        }
+
+        StoreCurveValue<Size>(output + j * Size, value);
+    }
+}
+
+//Float4 values are normalised when Normalize is set (rotation curves)
+template<int32_t Size, bool Derivative, bool Normalize>
+inline std::size_t EvaluateCurve(const float* coefficients, uint32_t segmentCount, const float* parameters,
+    float* output, std::size_t count)
+{
+    static_assert(!Normalize || Size == 4);
+
+    std::size_t i = 0;
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        EvaluateSegments<Size, Derivative, Normalize>(coefficients, segmentCount, LoadPackUnaligned(parameters + i),
+            output + i * Size);
+    }
+
+    return i;
+}
+
+//Arc length parameterised evaluation. table holds intervals + 1 pairs of a
+//parameter and its derivative by distance times the interval length, sampled
+//at uniform distances over [0, length] and interpolated as a cubic Hermite.
+//Distances are clamped to [0, length]
+template<int32_t Size>
+inline std::size_t EvaluateCurveAtDistances(const float* coefficients, uint32_t segmentCount, const float* table,
+    uint32_t intervals, float length, const float* distances, float* output, std::size_t count)
+{
+    Pack maxDistance = SetPack(length);
+    Pack scale       = SetPack(length > 0 ? static_cast<float>(intervals) / length : 0.0f);
+    Pack lastIndex   = ConvertToFloat(SetPackInt(static_cast<int32_t>(intervals - 1)));
+    Pack two         = SetPack(2.0f);
+    Pack three       = SetPack(3.0f);
+
+    std::size_t i = 0;
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x        = Mul(Min(Max(LoadPackUnaligned(distances + i), ZeroPack()), maxDistance), scale);
+        PackInt index = TruncateToInt(Min(x, lastIndex));
+        Pack f        = Sub(x, ConvertToFloat(index));
+
+        alignas(32) int32_t indices[PackWidth];
+        StorePack(reinterpret_cast<float*>(indices), CastToFloat(index));
+
+        const float* ptrs[PackWidth];
+        for(std::size_t j = 0; j < PackWidth; ++j)
+        {
+            ptrs[j] = table + indices[j] * 2;
+        }
+
+        Pack u0, m0, u1, m1;
+        GatherTransposed4(ptrs, u0, m0, u1, m1);
+
+        Pack delta = Sub(u1, u0);
+        Pack c3    = Sub(Add(m0, m1), Mul(delta, two));
+        Pack c2    = Sub(Sub(Mul(delta, three), Add(m0, m0)), m1);
+        Pack u     = MulAdd(MulAdd(MulAdd(c3, f, c2), f, m0), f, u0);
+
+        EvaluateSegments<Size, false, false>(coefficients, segmentCount, u, output + i * Size);
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
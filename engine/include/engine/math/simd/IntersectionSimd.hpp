@@ -0,0 +1,191 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include "Simd.hpp"
+
+//SIMD ray intersection tests on packets of PackWidth rays or primitives (4 with
+//SSE, 8 with AVX2). Rays and boxes are read as two packed float3 (origin and
+//direction, min and max) and triangles as three. Misses give +inf. The array
+//kernels return the number of elements processed so the caller can finish
+//the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//PackWidth float3 in structure of arrays registers
+struct Pack3
+{
+    Pack x, y, z;
+};
+
+inline Pack3 SetPack3(const float* v)
+{
+    return Pack3{ SetPack(v[0]), SetPack(v[1]), SetPack(v[2]) };
+}
+
+inline Pack3 Sub(const Pack3& a, const Pack3& b)
+{
+    return Pack3{ Sub(a.x, b.x), Sub(a.y, b.y), Sub(a.z, b.z) };
+}
+
+inline Pack Dot(const Pack3& a, const Pack3& b)
+{
+    return MulAdd(a.z, b.z, MulAdd(a.y, b.y, Mul(a.x, b.x)));
+}
+
+inline Pack3 Cross(const Pack3& a, const Pack3& b)
+{
+    return Pack3{ Sub(Mul(a.y, b.z), Mul(a.z, b.y)),
+                  Sub(Mul(a.z, b.x), Mul(a.x, b.z)),
+                  Sub(Mul(a.x, b.y), Mul(a.y, b.x)) };
+}
+
+//Two packed float3 per element, 6 floats apart
+inline void LoadPairs3(const float* ptr, Pack3& a, Pack3& b)
+{
+    Pack unused0, unused1;
+    LoadStridedTransposed4(ptr, 6, a.x, a.y, a.z, b.x);
+    LoadStridedTransposed4(ptr + 2, 6, unused0, unused1, b.y, b.z);
+}
+
+//Three packed float3 per element, 9 floats apart
+inline void LoadTriples3(const float* ptr, Pack3& a, Pack3& b, Pack3& c)
+{
+    Pack unused0, unused1, unused2;
+    LoadStridedTransposed4(ptr, 9, a.x, a.y, a.z, b.x);
+    LoadStridedTransposed4(ptr + 4, 9, b.y, b.z, c.x, c.y);
+    LoadStridedTransposed4(ptr + 5, 9, unused0, unused1, unused2, c.z);
+}
+
+//! Packet tests
+inline void IntersectSlab(Pack origin, Pack invDirection, Pack min, Pack max, Pack& tMin, Pack& tMax)
+{
+    Pack t1 = Mul(Sub(min, origin), invDirection);
+    Pack t2 = Mul(Sub(max, origin), invDirection);
+
+    //minps / maxps return the second operand on NaN, like detail::IntersectSlabs
+    tMin = Max(Min(t1, t2), tMin);
+    tMax = Min(Max(t1, t2), tMax);
+}
+
+//Entry distance of each ray into its box, 0 when the origin is inside
+inline Pack IntersectSlabs(const Pack3& origin, const Pack3& invDirection, const Pack3& min, const Pack3& max)
+{
+    const Pack infinity = SetPack(std::numeric_limits<float>::infinity());
+    Pack tMin           = ZeroPack();
+    Pack tMax           = infinity;
+
+    IntersectSlab(origin.x, invDirection.x, min.x, max.x, tMin, tMax);
+    IntersectSlab(origin.y, invDirection.y, min.y, max.y, tMin, tMax);
+    IntersectSlab(origin.z, invDirection.z, min.z, max.z, tMin, tMax);
+
+    return Select(GreaterEqual(tMax, tMin), tMin, infinity);
+}
+
+//Moller-Trumbore, double sided. A null determinant gives NaN which fails
+//every comparison
+inline Pack IntersectTriangles(const Pack3& origin, const Pack3& direction, const Pack3& v0, const Pack3& v1,
+    const Pack3& v2)
+{
+    const Pack one      = SetPack(1.0f);
+    const Pack infinity = SetPack(std::numeric_limits<float>::infinity());
+
+    Pack3 edge1         = Sub(v1, v0);
+    Pack3 edge2         = Sub(v2, v0);
+    Pack3 p             = Cross(direction, edge2);
+    Pack invDeterminant = Div(one, Dot(edge1, p));
+
+    Pack3 s = Sub(origin, v0);
+    Pack3 q = Cross(s, edge1);
+    Pack u  = Mul(Dot(s, p), invDeterminant);
+    Pack v  = Mul(Dot(direction, q), invDeterminant);
+    Pack t  = Mul(Dot(edge2, q), invDeterminant);
+
+    Pack hit = And(And(GreaterEqual(u, ZeroPack()), GreaterEqual(v, ZeroPack())),
+                   And(GreaterEqual(one, Add(u, v)), GreaterEqual(t, ZeroPack())));
+
+    return Select(hit, t, infinity);
+}
+
+//! Array kernels
+//One ray (origin, direction) against packed boxes (min, max)
+inline std::size_t IntersectRayAABBs(const float* ray, const float* boxes, float* distances, std::size_t count)
+{
+    const Pack3 origin       = SetPack3(ray);
+    const Pack3 invDirection = { SetPack(1 / ray[3]), SetPack(1 / ray[4]), SetPack(1 / ray[5]) };
+    std::size_t i            = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack3 min, max;
+        LoadPairs3(boxes + i * 6, min, max);
+
+        StorePackUnaligned(distances + i, IntersectSlabs(origin, invDirection, min, max));
+    }
+
+    return i;
+}
+
+//Packed rays against one box
+inline std::size_t IntersectRaysAABB(const float* rays, const float* box, float* distances, std::size_t count)
+{
+    const Pack one  = SetPack(1.0f);
+    const Pack3 min = SetPack3(box);
+    const Pack3 max = SetPack3(box + 3);
+    std::size_t i   = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack3 origin, direction;
+        LoadPairs3(rays + i * 6, origin, direction);
+
+        Pack3 invDirection = { Div(one, direction.x), Div(one, direction.y), Div(one, direction.z) };
+        StorePackUnaligned(distances + i, IntersectSlabs(origin, invDirection, min, max));
+    }
+
+    return i;
+}
+
+//One ray against packed triangles (v0, v1, v2)
+inline std::size_t IntersectRayTriangles(const float* ray, const float* triangles, float* distances,
+    std::size_t count)
+{
+    const Pack3 origin    = SetPack3(ray);
+    const Pack3 direction = SetPack3(ray + 3);
+    std::size_t i         = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack3 v0, v1, v2;
+        LoadTriples3(triangles + i * 9, v0, v1, v2);
+
+        StorePackUnaligned(distances + i, IntersectTriangles(origin, direction, v0, v1, v2));
+    }
+
+    return i;
+}
+
+//Packed rays against one triangle
+inline std::size_t IntersectRaysTriangle(const float* rays, const float* triangle, float* distances,
+    std::size_t count)
+{
+    const Pack3 v0 = SetPack3(triangle);
+    const Pack3 v1 = SetPack3(triangle + 3);
+    const Pack3 v2 = SetPack3(triangle + 6);
+    std::size_t i  = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack3 origin, direction;
+        LoadPairs3(rays + i * 6, origin, direction);
+
+        StorePackUnaligned(distances + i, IntersectTriangles(origin, direction, v0, v1, v2));
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,189 @@
+#pragma once
+#include <cstdint>
+#include "Simd.hpp"
+
+//SIMD kernels for column based 4x4 float matrices stored as float[16]
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//out = a * b. out may alias a or b
+inline void Matrix4Multiply(const float* a, const float* b, float* out)
+{
+#if MATH_SIMD_AVX2
+    //Each 256 bit register holds two columns of the result
+    __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a));
+    __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+    __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+    __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+    __m256 b01 = _mm256_loadu_ps(b);
+    __m256 b23 = _mm256_loadu_ps(b + 8);
+
+    __m256 r01 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b01, b01, MATH_SHUFFLE_MASK(0, 0, 0, 0)));
+    r01 = MulAdd(a1, _mm256_shuffle_ps(b01, b01, MATH_SHUFFLE_MASK(1, 1, 1, 1)), r01);
+    r01 = MulAdd(a2, _mm256_shuffle_ps(b01, b01, MATH_SHUFFLE_MASK(2, 2, 2, 2)), r01);
+    r01 = MulAdd(a3, _mm256_shuffle_ps(b01, b01, MATH_SHUFFLE_MASK(3, 3, 3, 3)), r01);
+
+    __m256 r23 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b23, b23, MATH_SHUFFLE_MASK(0, 0, 0, 0)));
+    r23 = MulAdd(a1, _mm256_shuffle_ps(b23, b23, MATH_SHUFFLE_MASK(1, 1, 1, 1)), r23);
+    r23 = MulAdd(a2, _mm256_shuffle_ps(b23, b23, MATH_SHUFFLE_MASK(2, 2, 2, 2)), r23);
+    r23 = MulAdd(a3, _mm256_shuffle_ps(b23, b23, MATH_SHUFFLE_MASK(3, 3, 3, 3)), r23);
+
+    _mm256_storeu_ps(out, r01);
+    _mm256_storeu_ps(out + 8, r23);
+#else
+    __m128 a0 = _mm_loadu_ps(a);
+    __m128 a1 = _mm_loadu_ps(a + 4);
+    __m128 a2 = _mm_loadu_ps(a + 8);
+    __m128 a3 = _mm_loadu_ps(a + 12);
+    __m128 r[4];
+
+    //Column i of the result is a linear combination of the columns of a
+    for(int32_t i = 0; i < 4; ++i)
+    {
+        __m128 col = _mm_loadu_ps(b + i * 4);
+
+        r[i] = _mm_mul_ps(a0, Splat<0>(col));
+        r[i] = MulAdd(a1, Splat<1>(col), r[i]);
+        r[i] = MulAdd(a2, Splat<2>(col), r[i]);
+        r[i] = MulAdd(a3, Splat<3>(col), r[i]);
+    }
+
+    _mm_storeu_ps(out,      r[0]);
+    _mm_storeu_ps(out + 4,  r[1]);
+    _mm_storeu_ps(out + 8,  r[2]);
+    _mm_storeu_ps(out + 12, r[3]);
+#endif
+}
+
+//out = parent * Matrix4::CreateTransform(scale, rotation, translation) without
+//building the local matrix. rotation is a unit quaternion (x, y, z, w) and
+//out may alias parent
+inline void Matrix4ComposeTransform(const float* parent, const float* scale, const float* rotation, 
+    const float* translation, float* out)
+{
+    float x  = rotation[0];
+    float y  = rotation[1];
+    float z  = rotation[2];
+    float w  = rotation[3];
+    float ww = w * w;
+    float xy = x * y;
+    float xz = x * z;
+    float xw = x * w;
+    float yz = y * z;
+    float yw = y * w;
+    float zw = z * w;
+
+    __m128 p0 = _mm_loadu_ps(parent);
+    __m128 p1 = _mm_loadu_ps(parent + 4);
+    __m128 p2 = _mm_loadu_ps(parent + 8);
+    __m128 p3 = _mm_loadu_ps(parent + 12);
+
+    //Column i of the result is the parent times the scaled rotation column i
+    __m128 c0 = Mul(p0, _mm_set1_ps(2 * (ww + x * x) - 1));
+    c0 = MulAdd(p1, _mm_set1_ps(2 * (xy + zw)), c0);
+    c0 = MulAdd(p2, _mm_set1_ps(2 * (xz - yw)), c0);
+
+    __m128 c1 = Mul(p0, _mm_set1_ps(2 * (xy - zw)));
+    c1 = MulAdd(p1, _mm_set1_ps(2 * (ww + y * y) - 1), c1);
+    c1 = MulAdd(p2, _mm_set1_ps(2 * (yz + xw)), c1);
+
+    __m128 c2 = Mul(p0, _mm_set1_ps(2 * (xz + yw)));
+    c2 = MulAdd(p1, _mm_set1_ps(2 * (yz - xw)), c2);
+    c2 = MulAdd(p2, _mm_set1_ps(2 * (ww + z * z) - 1), c2);
+
+    __m128 c3 = MulAdd(p0, _mm_set1_ps(translation[0]), p3);
+    c3 = MulAdd(p1, _mm_set1_ps(translation[1]), c3);
+    c3 = MulAdd(p2, _mm_set1_ps(translation[2]), c3);
+
+    _mm_storeu_ps(out,      Mul(c0, _mm_set1_ps(scale[0])));
+    _mm_storeu_ps(out + 4,  Mul(c1, _mm_set1_ps(scale[1])));
+    _mm_storeu_ps(out + 8,  Mul(c2, _mm_set1_ps(scale[2])));
+    _mm_storeu_ps(out + 12, c3);
+}
+
+//2x2 sub matrix helpers used by the block inverse. Each register holds
+//a 2x2 matrix as (m00, m01, m10, m11)
+
+//a * b
+inline __m128 Matrix2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                      _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+//adj(a) * b
+inline __m128 Matrix2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                      _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+//a * adj(b)
+inline __m128 Matrix2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                      _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+//out = inverse(m) using the 2x2 block matrix method
+//(https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html).
+//The method is layout agnostic because inverse(transpose(m)) = transpose(inverse(m)).
+//out may alias m
+inline void Matrix4Inverse(const float* m, float* out)
+{
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+
+    //Sub matrices
+    __m128 a = _mm_movelh_ps(c0, c1);
+    __m128 b = _mm_movehl_ps(c1, c0);
+    __m128 c = _mm_movelh_ps(c2, c3);
+    __m128 d = _mm_movehl_ps(c3, c2);
+
+    //Determinants of the sub matrices as (|a|, |b|, |c|, |d|)
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, MATH_SHUFFLE_MASK(0, 2, 0, 2)), 
+                   _mm_shuffle_ps(c1, c3, MATH_SHUFFLE_MASK(1, 3, 1, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, MATH_SHUFFLE_MASK(1, 3, 1, 3)), 
+                   _mm_shuffle_ps(c1, c3, MATH_SHUFFLE_MASK(0, 2, 0, 2))));
+    __m128 detA = Splat<0>(detSub);
+    __m128 detB = Splat<1>(detSub);
+    __m128 detC = Splat<2>(detSub);
+    __m128 detD = Splat<3>(detSub);
+
+    __m128 dc = Matrix2AdjMul(d, c);
+    __m128 ab = Matrix2AdjMul(a, b);
+
+    //Adjugates of the result blocks
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Matrix2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Matrix2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Matrix2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Matrix2MulAdj(a, dc));
+
+    //|m| = |a| * |d| + |b| * |c| - trace(adj(a) * b * adj(d) * c)
+    __m128 tr = _mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc));
+    tr = _mm_add_ps(tr, Swizzle<2, 3, 0, 1>(tr));
+    tr = _mm_add_ps(tr, Swizzle<1, 0, 3, 2>(tr));
+
+    __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+    __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+
+    x = _mm_mul_ps(x, invDet);
+    y = _mm_mul_ps(y, invDet);
+    z = _mm_mul_ps(z, invDet);
+    w = _mm_mul_ps(w, invDet);
+
+    //Apply the adjugate shuffle while storing
+    _mm_storeu_ps(out,      _mm_shuffle_ps(x, y, MATH_SHUFFLE_MASK(3, 1, 3, 1)));
+    _mm_storeu_ps(out + 4,  _mm_shuffle_ps(x, y, MATH_SHUFFLE_MASK(2, 0, 2, 0)));
+    _mm_storeu_ps(out + 8,  _mm_shuffle_ps(z, w, MATH_SHUFFLE_MASK(3, 1, 3, 1)));
+    _mm_storeu_ps(out + 12, _mm_shuffle_ps(z, w, MATH_SHUFFLE_MASK(2, 0, 2, 0)));
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,142 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+
+//SIMD 32 bit Morton keys, 16 bits per axis in 2D and 10 in 3D. Positions are
+//packed float2/float3 quantised with cell = clamp((p - min) * scale, 0,
+//maxCell), decoding gives the cell centers (cell + 0.5) * cellSize + min. They
+//return the number of keys processed so the caller can finish the tail with
+//scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//! Bit interleaving
+//The low 16 bits of every lane moved to the even bits
+inline PackInt SpreadBits2(PackInt v)
+{
+    v = AndInt(v, SetPackInt(0x0000FFFF));
+    v = AndInt(OrInt(v, ShiftLeftInt<8>(v)), SetPackInt(0x00FF00FF));
+    v = AndInt(OrInt(v, ShiftLeftInt<4>(v)), SetPackInt(0x0F0F0F0F));
+    v = AndInt(OrInt(v, ShiftLeftInt<2>(v)), SetPackInt(0x33333333));
+    return AndInt(OrInt(v, ShiftLeftInt<1>(v)), SetPackInt(0x55555555));
+}
+
+//The low 10 bits of every lane moved to every third bit
+inline PackInt SpreadBits3(PackInt v)
+{
+    v = AndInt(v, SetPackInt(0x000003FF));
+    v = AndInt(OrInt(v, ShiftLeftInt<16>(v)), SetPackInt(0x030000FF));
+    v = AndInt(OrInt(v, ShiftLeftInt<8>(v)), SetPackInt(0x0300F00F));
+    v = AndInt(OrInt(v, ShiftLeftInt<4>(v)), SetPackInt(0x030C30C3));
+    return AndInt(OrInt(v, ShiftLeftInt<2>(v)), SetPackInt(0x09249249));
+}
+
+//Inverse of SpreadBits2, the odd bits are ignored
+inline PackInt CompactBits2(PackInt v)
+{
+    v = AndInt(v, SetPackInt(0x55555555));
+    v = AndInt(OrInt(v, ShiftRightInt<1>(v)), SetPackInt(0x33333333));
+    v = AndInt(OrInt(v, ShiftRightInt<2>(v)), SetPackInt(0x0F0F0F0F));
+    v = AndInt(OrInt(v, ShiftRightInt<4>(v)), SetPackInt(0x00FF00FF));
+    return AndInt(OrInt(v, ShiftRightInt<8>(v)), SetPackInt(0x0000FFFF));
+}
+
+//Inverse of SpreadBits3, the other bits are ignored
+inline PackInt CompactBits3(PackInt v)
+{
+    v = AndInt(v, SetPackInt(0x09249249));
+    v = AndInt(OrInt(v, ShiftRightInt<2>(v)), SetPackInt(0x030C30C3));
+    v = AndInt(OrInt(v, ShiftRightInt<4>(v)), SetPackInt(0x0300F00F));
+    v = AndInt(OrInt(v, ShiftRightInt<8>(v)), SetPackInt(0x030000FF));
+    return AndInt(OrInt(v, ShiftRightInt<16>(v)), SetPackInt(0x000003FF));
+}
+
+//! Quantisation
+inline PackInt QuantiseMorton(Pack v, float min, float scale, float maxCell)
+{
+    Pack cell = Mul(Sub(v, SetPack(min)), SetPack(scale));
+    return TruncateToInt(Min(Max(cell, ZeroPack()), SetPack(maxCell)));
+}
+
+inline Pack CellCenter(PackInt cell, float min, float cellSize)
+{
+    return MulAdd(Add(ConvertToFloat(cell), SetPack(0.5f)), SetPack(cellSize), SetPack(min));
+}
+
+//! Kernels
+inline std::size_t EncodeMorton2(const float* positions, uint32_t* keys, std::size_t count, const float* min,
+    const float* scale)
+{
+    constexpr float MaxCell = 65535.0f;
+
+    std::size_t i = 0;
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y;
+        LoadDeinterleaved2(positions + i * 2, x, y);
+
+        PackInt key = OrInt(SpreadBits2(QuantiseMorton(x, min[0], scale[0], MaxCell)),
+            ShiftLeftInt<1>(SpreadBits2(QuantiseMorton(y, min[1], scale[1], MaxCell))));
+        StorePackUnaligned(reinterpret_cast<float*>(keys + i), CastToFloat(key));
+    }
+
+    return i;
+}
+
+inline std::size_t EncodeMorton3(const float* positions, uint32_t* keys, std::size_t count, const float* min,
+    const float* scale)
+{
+    constexpr float MaxCell = 1023.0f;
+
+    std::size_t i = 0;
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y, z;
+        LoadDeinterleaved3(positions + i * 3, x, y, z);
+
+        PackInt key = OrInt(OrInt(SpreadBits3(QuantiseMorton(x, min[0], scale[0], MaxCell)),
+            ShiftLeftInt<1>(SpreadBits3(QuantiseMorton(y, min[1], scale[1], MaxCell)))),
+            ShiftLeftInt<2>(SpreadBits3(QuantiseMorton(z, min[2], scale[2], MaxCell))));
+        StorePackUnaligned(reinterpret_cast<float*>(keys + i), CastToFloat(key));
+    }
+
+    return i;
+}
+
+inline std::size_t DecodeMorton2(const uint32_t* keys, float* positions, std::size_t count, const float* min,
+    const float* cellSize)
+{
+    std::size_t i = 0;
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        PackInt key = CastToInt(LoadPackUnaligned(reinterpret_cast<const float*>(keys + i)));
+
+        StoreInterleaved2(positions + i * 2, CellCenter(CompactBits2(key), min[0], cellSize[0]),
+            CellCenter(CompactBits2(ShiftRightInt<1>(key)), min[1], cellSize[1]));
+    }
+
+    return i;
+}
+
+inline std::size_t DecodeMorton3(const uint32_t* keys, float* positions, std::size_t count, const float* min,
+    const float* cellSize)
+{
+    std::size_t i = 0;
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        PackInt key = CastToInt(LoadPackUnaligned(reinterpret_cast<const float*>(keys + i)));
+
+        StoreInterleaved3(positions + i * 3, CellCenter(CompactBits3(key), min[0], cellSize[0]),
+            CellCenter(CompactBits3(ShiftRightInt<1>(key)), min[1], cellSize[1]),
+            CellCenter(CompactBits3(ShiftRightInt<2>(key)), min[2], cellSize[2]));
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
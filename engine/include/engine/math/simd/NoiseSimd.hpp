@@ -0,0 +1,326 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+
+//Gradient (Perlin) and simplex noise in 2 to 4 dimensions on PackWidth points
+//at a time. Lattice points are hashed from their integer coordinates and the
+//seed, so there is no permutation table to gather from. Positions are Dim
+//registers of coordinates and must stay within +-2^31. The scalar versions in
+//Noise.inl use the same hash, gradients and scales. The array kernels return
+//the number of elements processed so the caller can finish the tail with
+//scalar code
+namespace math::simd
+{
+
+//Multipliers of the lattice coordinates in the hash, one per axis
+constexpr uint32_t NoisePrimes[4]      = { 501125321u, 1136930381u, 1720413743u, 1066037191u };
+constexpr uint32_t NoiseHashMultiplier = 0x27D4EB2Du;
+
+//Skew of the input space onto the simplex grid and back, by dimension
+constexpr float SimplexSkew[5]   = { 0, 0, 0.366025403784f, 0.333333333333f, 0.309016994375f };
+constexpr float SimplexUnskew[5] = { 0, 0, 0.211324865405f, 0.166666666667f, 0.138196601125f };
+
+//Bring the largest measured values to about +-1
+constexpr float GradientNoiseScale[5] = { 0, 0, 0.66f, 1.0f, 0.8f };
+constexpr float SimplexNoiseScale[5]  = { 0, 0, 45.0f, 76.0f, 62.0f };
+
+#if MATH_SIMD_SSE
+
+//floor(x) as float and int
+inline void Floor(Pack x, Pack& floor, PackInt& floorInt)
+{
+    PackInt truncated = TruncateToInt(x);
+    Pack t            = ConvertToFloat(truncated);
+    Pack below        = Less(x, t);
+
+    floor    = Sub(t, And(below, SetPack(1.0f)));
+    floorInt = AddInt(truncated, CastToInt(below));
+}
+
+//The shift brings the high bits of the product, which depend on every input
+//bit, down to the bits the gradients are picked from
+inline PackInt FinishNoiseHash(PackInt hash)
+{
+    hash = MulInt(hash, SetPackInt(static_cast<int32_t>(NoiseHashMultiplier)));
+    return XorInt(hash, ShiftRightInt<15>(hash));
+}
+
+//Lanes where (hash & bits) == value
+inline Pack HashEquals(PackInt hash, int32_t bits, int32_t value)
+{
+    return CastToFloat(EqualInt(AndInt(hash, SetPackInt(bits)), SetPackInt(value)));
+}
+
+//Negates the lanes where bit Bit of hash is set
+template<int Bit>
+inline Pack FlipSign(Pack value, PackInt hash)
+{
+    return Xor(value, CastToFloat(ShiftLeftInt<31 - Bit>(AndInt(hash, SetPackInt(1 << Bit)))));
+}
+
+//Dot product of the offset with the gradient picked by the hash
+template<int32_t Dim>
+inline Pack NoiseGradient(PackInt hash, const Pack (&offset)[Dim])
+{
+    if constexpr (Dim == 2)
+    {
+        //(+-1, +-2) and (+-2, +-1)
+        Pack swap = HashEquals(hash, 1, 1);
+        Pack u    = Select(swap, offset[1], offset[0]);
+        Pack v    = Select(swap, offset[0], offset[1]);
+
+        return Add(FlipSign<1>(u, hash), FlipSign<2>(Add(v, v), hash));
+    }
+    else if constexpr (Dim == 3)
+    {
+        //The 12 cube edges of improved Perlin noise, 4 of them twice
+        Pack u = Select(HashEquals(hash, 8, 0), offset[0], offset[1]);
+        Pack v = Select(HashEquals(hash, 12, 0), offset[1],
+                 Select(HashEquals(hash, 13, 12), offset[0], offset[2]));
+
+        return Add(FlipSign<0>(u, hash), FlipSign<1>(v, hash));
+    }
+    else
+    {
+        //The 32 tesseract edges, bits 3 and 4 pick the zero axis
+        Pack a = Select(HashEquals(hash, 24, 0), offset[1], offset[0]);
+        Pack b = Select(HashEquals(hash, 16, 0), offset[2], offset[1]);
+        Pack c = Select(HashEquals(hash, 24, 24), offset[2], offset[3]);
+
+        return Add(Add(FlipSign<0>(a, hash), FlipSign<1>(b, hash)), FlipSign<2>(c, hash));
+    }
+}
+
+//! Noise
+template<int32_t Dim>
+inline Pack GradientNoise(const Pack (&position)[Dim], PackInt seed)
+{
+    constexpr int32_t Corners = 1 << Dim;
+
+    const Pack one = SetPack(1.0f);
+    Pack offset[Dim], fade[Dim];
+    PackInt primed[Dim];
+
+    for(int32_t axis = 0; axis < Dim; ++axis)
+    {
+        Pack floor;
+        PackInt floorInt;
+        Floor(position[axis], floor, floorInt);
+
+        //6t^5 - 15t^4 + 10t^3
+        Pack t       = Sub(position[axis], floor);
+        offset[axis] = t;
+        fade[axis]   = Mul(Mul(Mul(t, t), t), MulAdd(t, MulAdd(t, SetPack(6.0f), SetPack(-15.0f)), SetPack(10.0f)));
+        primed[axis] = MulInt(floorInt, SetPackInt(static_cast<int32_t>(NoisePrimes[axis])));
+    }
+
+    //Bit a of the corner index is the step along axis a
+    Pack values[Corners];
+    for(int32_t corner = 0; corner < Corners; ++corner)
+    {
+        PackInt hash = seed;
+        Pack d[Dim];
+
+        for(int32_t axis = 0; axis < Dim; ++axis)
+        {
+            bool step = (corner >> axis) & 1;
+            hash      = XorInt(hash, step ? AddInt(primed[axis], SetPackInt(static_cast<int32_t>(NoisePrimes[axis]))) :
+                                            primed[axis]);
+            d[axis]   = step ? Sub(offset[axis], one) : offset[axis];
+        }
+
+        values[corner] = NoiseGradient<Dim>(FinishNoiseHash(hash), d);
+    }
+
+    //Interpolates the pairs along one axis at a time, x first
+    for(int32_t axis = 0, count = Corners / 2; axis < Dim; ++axis, count /= 2)
+    {
+        for(int32_t i = 0; i < count; ++i)
+        {
+            values[i] = MulAdd(Sub(values[i * 2 + 1], values[i * 2]), fade[axis], values[i * 2]);
+        }
+    }
+
+    return Mul(values[0], SetPack(GradientNoiseScale[Dim]));
+}
+
+template<int32_t Dim>
+inline Pack SimplexNoise(const Pack (&position)[Dim], PackInt seed)
+{
+    const Pack one    = SetPack(1.0f);
+    const Pack unskew = SetPack(SimplexUnskew[Dim]);
+
+    Pack sum = position[0];
+    for(int32_t axis = 1; axis < Dim; ++axis)
+    {
+        sum = Add(sum, position[axis]);
+    }
+
+    //Cell of the skewed grid and the offset from its origin in input space
+    Pack skew    = Mul(sum, SetPack(SimplexSkew[Dim]));
+    Pack cellSum = ZeroPack();
+    Pack cell[Dim], offset[Dim];
+    PackInt primed[Dim];
+
+    for(int32_t axis = 0; axis < Dim; ++axis)
+    {
+        PackInt floorInt;
+        Floor(Add(position[axis], skew), cell[axis], floorInt);
+
+        cellSum      = Add(cellSum, cell[axis]);
+        primed[axis] = MulInt(floorInt, SetPackInt(static_cast<int32_t>(NoisePrimes[axis])));
+    }
+
+    Pack t = Mul(cellSum, unskew);
+    for(int32_t axis = 0; axis < Dim; ++axis)
+    {
+        offset[axis] = Add(Sub(position[axis], cell[axis]), t);
+    }
+
+    //The simplex steps along the axes from the largest offset to the smallest,
+    //rank is the number of offsets each one is larger than
+    Pack rank[Dim];
+    for(int32_t axis = 0; axis < Dim; ++axis)
+    {
+        rank[axis] = ZeroPack();
+    }
+
+    for(int32_t a = 0; a < Dim; ++a)
+    {
+        for(int32_t b = a + 1; b < Dim; ++b)
+        {
+            Pack greater = Less(offset[b], offset[a]);
+            rank[a]      = Add(rank[a], And(greater, one));
+            rank[b]      = Add(rank[b], AndNot(greater, one));
+        }
+    }
+
+    Pack result = ZeroPack();
+    for(int32_t corner = 0; corner <= Dim; ++corner)
+    {
+        PackInt hash    = seed;
+        Pack distance   = SetPack(0.5f);
+        Pack correction = SetPack(corner * SimplexUnskew[Dim]);
+        Pack d[Dim];
+
+        for(int32_t axis = 0; axis < Dim; ++axis)
+        {
+            Pack step = GreaterEqual(rank[axis], SetPack(static_cast<float>(Dim - corner)));
+
+            hash       = XorInt(hash, AddInt(primed[axis], AndInt(CastToInt(step),
+                                SetPackInt(static_cast<int32_t>(NoisePrimes[axis])))));
+            d[axis]    = Add(Sub(offset[axis], And(step, one)), correction);
+            distance   = Sub(distance, Mul(d[axis], d[axis]));
+        }
+
+        //(0.5 - r^2)^4 falloff
+        Pack falloff = Max(distance, ZeroPack());
+        falloff      = Mul(falloff, falloff);
+        falloff      = Mul(falloff, falloff);
+        result       = MulAdd(falloff, NoiseGradient<Dim>(FinishNoiseHash(hash), d), result);
+    }
+
+    return Mul(result, SetPack(SimplexNoiseScale[Dim]));
+}
+
+//Octaves of noise at frequency * lacunarity^o weighted by gain^o and
+//normalised by the total weight. Ridged octaves are (1 - |n|)^2 remapped to
+//[-1, 1]. Octave o uses seed + o
+template<int32_t Dim, bool Simplex, bool Ridged>
+inline Pack FractalNoise(const Pack (&position)[Dim], int32_t seed, int32_t octaves, float frequency,
+    float lacunarity, float gain)
+{
+    const Pack one = SetPack(1.0f);
+    Pack sum       = ZeroPack();
+    float weight   = 1;
+    float total    = 0;
+
+    for(int32_t octave = 0; octave < octaves; ++octave)
+    {
+        Pack p[Dim];
+        for(int32_t axis = 0; axis < Dim; ++axis)
+        {
+            p[axis] = Mul(position[axis], SetPack(frequency));
+        }
+
+        PackInt octaveSeed = SetPackInt(static_cast<int32_t>(static_cast<uint32_t>(seed) + octave));
+        Pack value         = Simplex ? SimplexNoise<Dim>(p, octaveSeed) : GradientNoise<Dim>(p, octaveSeed);
+
+        if constexpr (Ridged)
+        {
+            value = Sub(one, AndNot(SetPack(-0.0f), value));
+            value = MulAdd(Mul(value, value), SetPack(2.0f), SetPack(-1.0f));
+        }
+
+        sum        = MulAdd(value, SetPack(weight), sum);
+        total     += weight;
+        weight    *= gain;
+        frequency *= lacunarity;
+    }
+
+    return Mul(sum, SetPack(1 / total));
+}
+
+//! Array kernels
+//Packed float2, float3 or float4 positions
+template<int32_t Dim, bool Simplex, bool Ridged>
+inline std::size_t SampleNoise(const float* positions, float* output, std::size_t count, int32_t seed,
+    int32_t octaves, float frequency, float lacunarity, float gain)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack p[Dim];
+        if constexpr (Dim == 2)
+        {
+            LoadDeinterleaved2(positions + i * 2, p[0], p[1]);
+        }
+        else if constexpr (Dim == 3)
+        {
+            LoadDeinterleaved3(positions + i * 3, p[0], p[1], p[2]);
+        }
+        else
+        {
+            LoadTransposed4(positions + i * 4, p[0], p[1], p[2], p[3]);
+        }
+
+        StorePackUnaligned(output + i, FractalNoise<Dim, Simplex, Ridged>(p, seed, octaves, frequency, lacunarity, gain));
+    }
+
+    return i;
+}
+
+//Row of a grid, x = start + i * spacing and the Dim - 1 other coordinates
+//fixed to position
+template<int32_t Dim, bool Simplex, bool Ridged>
+inline std::size_t SampleNoiseRow(float* output, std::size_t count, float start, float spacing,
+    const float* position, int32_t seed, int32_t octaves, float frequency, float lacunarity, float gain)
+{
+#if MATH_SIMD_AVX2
+    const Pack lanes = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+#else
+    const Pack lanes = _mm_setr_ps(0, 1, 2, 3);
+#endif
+    std::size_t i = 0;
+
+    Pack p[Dim];
+    for(int32_t axis = 1; axis < Dim; ++axis)
+    {
+        p[axis] = SetPack(position[axis - 1]);
+    }
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        p[0] = MulAdd(Add(SetPack(static_cast<float>(i)), lanes), SetPack(spacing), SetPack(start));
+
+        StorePackUnaligned(output + i, FractalNoise<Dim, Simplex, Ridged>(p, seed, octaves, frequency, lacunarity, gain));
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
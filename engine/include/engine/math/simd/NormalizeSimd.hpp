@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include "Simd.hpp"
+
+//SIMD kernels normalising packed float2/3/4 in place with FastInvSqrt (rsqrt
+//plus one Newton-Raphson step). They return the number of elements processed
+//so the caller can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+inline std::size_t FastNormalize2(float* v, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y;
+        LoadDeinterleaved2(v + i * 2, x, y);
+        Pack invL = FastInvSqrt(MulAdd(y, y, Mul(x, x)));
+
+        StoreInterleaved2(v + i * 2, Mul(x, invL), Mul(y, invL));
+    }
+
+    return i;
+}
+
+inline std::size_t FastNormalize3(float* v, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y, z;
+        LoadDeinterleaved3(v + i * 3, x, y, z);
+        Pack invL = FastInvSqrt(MulAdd(z, z, MulAdd(y, y, Mul(x, x))));
+
+        StoreInterleaved3(v + i * 3, Mul(x, invL), Mul(y, invL), Mul(z, invL));
+    }
+
+    return i;
+}
+
+inline std::size_t FastNormalize4(float* v, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y, z, w;
+        LoadTransposed4(v + i * 4, x, y, z, w);
+        Pack invL = FastInvSqrt(MulAdd(w, w, MulAdd(z, z, MulAdd(y, y, Mul(x, x)))));
+
+        StoreTransposed4(v + i * 4, Mul(x, invL), Mul(y, invL), Mul(z, invL), Mul(w, invL));
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
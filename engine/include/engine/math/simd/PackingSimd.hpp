@@ -0,0 +1,285 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+
+//SIMD kernels converting float arrays to and from half, snorm and unorm
+//storage and encoding normals with the octahedral mapping. Integer packing
+//runs on 128 bit registers (SSE2 has saturating packs, the AVX2 ones work per
+//lane) which is enough to saturate memory bandwidth. They return the number
+//of elements processed so the caller can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//! Half
+#if MATH_SIMD_F16C
+inline std::size_t FloatToHalf(const float* input, uint16_t* output, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i lo = _mm_cvtps_ph(_mm_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT);
+        __m128i hi = _mm_cvtps_ph(_mm_loadu_ps(input + i + 4), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi64(lo, hi));
+    }
+
+    return i;
+}
+
+inline std::size_t HalfToFloat(const uint16_t* input, float* output, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        _mm_storeu_ps(output + i, _mm_cvtph_ps(v));
+        _mm_storeu_ps(output + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(v, v)));
+    }
+
+    return i;
+}
+#endif
+
+//! Normalised integers
+//Clamps to [low, 1], zeroes NaN and scales to the integer range
+inline __m128i QuantizeNormalized(__m128 v, __m128 low, __m128 scale)
+{
+    v = And(v, Equal(v, v));
+    v = Max(low, Min(v, _mm_set1_ps(1.0f)));
+
+    return _mm_cvtps_epi32(Mul(v, scale));
+}
+
+inline std::size_t FloatToSnorm16(const float* input, int16_t* output, std::size_t count)
+{
+    const __m128 low   = _mm_set1_ps(-1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    std::size_t i      = 0;
+
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i lo = QuantizeNormalized(_mm_loadu_ps(input + i), low, scale);
+        __m128i hi = QuantizeNormalized(_mm_loadu_ps(input + i + 4), low, scale);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(lo, hi));
+    }
+
+    return i;
+}
+
+inline std::size_t FloatToSnorm8(const float* input, int8_t* output, std::size_t count)
+{
+    const __m128 low   = _mm_set1_ps(-1.0f);
+    const __m128 scale = _mm_set1_ps(127.0f);
+    std::size_t i      = 0;
+
+    for(; i + 16 <= count; i += 16)
+    {
+        __m128i a = QuantizeNormalized(_mm_loadu_ps(input + i), low, scale);
+        __m128i b = QuantizeNormalized(_mm_loadu_ps(input + i + 4), low, scale);
+        __m128i c = QuantizeNormalized(_mm_loadu_ps(input + i + 8), low, scale);
+        __m128i d = QuantizeNormalized(_mm_loadu_ps(input + i + 12), low, scale);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+            _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+
+    return i;
+}
+
+inline std::size_t FloatToUnorm16(const float* input, uint16_t* output, std::size_t count)
+{
+    const __m128 low    = _mm_setzero_ps();
+    const __m128 scale  = _mm_set1_ps(65535.0f);
+    const __m128i bias  = _mm_set1_epi32(32768);
+    const __m128i flip  = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+    std::size_t i       = 0;
+
+    //SSE2 only has a signed 32 to 16 bit pack, so the range is shifted down
+    //by 32768 before packing and flipped back after
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i lo = _mm_sub_epi32(QuantizeNormalized(_mm_loadu_ps(input + i), low, scale), bias);
+        __m128i hi = _mm_sub_epi32(QuantizeNormalized(_mm_loadu_ps(input + i + 4), low, scale), bias);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_xor_si128(_mm_packs_epi32(lo, hi), flip));
+    }
+
+    return i;
+}
+
+inline std::size_t FloatToUnorm8(const float* input, uint8_t* output, std::size_t count)
+{
+    const __m128 low   = _mm_setzero_ps();
+    const __m128 scale = _mm_set1_ps(255.0f);
+    std::size_t i      = 0;
+
+    for(; i + 16 <= count; i += 16)
+    {
+        __m128i a = QuantizeNormalized(_mm_loadu_ps(input + i), low, scale);
+        __m128i b = QuantizeNormalized(_mm_loadu_ps(input + i + 4), low, scale);
+        __m128i c = QuantizeNormalized(_mm_loadu_ps(input + i + 8), low, scale);
+        __m128i d = QuantizeNormalized(_mm_loadu_ps(input + i + 12), low, scale);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+            _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+
+    return i;
+}
+
+//Lanes 0-3 and 4-7 of 8 signed 16 bit integers as float
+inline void SignedWordsToFloat(__m128i v, __m128& lo, __m128& hi)
+{
+    lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+    hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+}
+
+inline void UnsignedWordsToFloat(__m128i v, __m128& lo, __m128& hi)
+{
+    lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128()));
+    hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v, _mm_setzero_si128()));
+}
+
+inline std::size_t Snorm16ToFloat(const int16_t* input, float* output, std::size_t count)
+{
+    const __m128 low   = _mm_set1_ps(-1.0f);
+    const __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+    std::size_t i      = 0;
+
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128 lo, hi;
+        SignedWordsToFloat(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), lo, hi);
+
+        _mm_storeu_ps(output + i, Max(low, Mul(lo, scale)));
+        _mm_storeu_ps(output + i + 4, Max(low, Mul(hi, scale)));
+    }
+
+    return i;
+}
+
+inline std::size_t Snorm8ToFloat(const int8_t* input, float* output, std::size_t count)
+{
+    const __m128 low   = _mm_set1_ps(-1.0f);
+    const __m128 scale = _mm_set1_ps(1.0f / 127.0f);
+    std::size_t i      = 0;
+
+    for(; i + 16 <= count; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128 a, b, c, d;
+        SignedWordsToFloat(_mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8), a, b);
+        SignedWordsToFloat(_mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8), c, d);
+
+        _mm_storeu_ps(output + i, Max(low, Mul(a, scale)));
+        _mm_storeu_ps(output + i + 4, Max(low, Mul(b, scale)));
+        _mm_storeu_ps(output + i + 8, Max(low, Mul(c, scale)));
+        _mm_storeu_ps(output + i + 12, Max(low, Mul(d, scale)));
+    }
+
+    return i;
+}
+
+inline std::size_t Unorm16ToFloat(const uint16_t* input, float* output, std::size_t count)
+{
+    const __m128 scale = _mm_set1_ps(1.0f / 65535.0f);
+    std::size_t i      = 0;
+
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128 lo, hi;
+        UnsignedWordsToFloat(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), lo, hi);
+
+        _mm_storeu_ps(output + i, Mul(lo, scale));
+        _mm_storeu_ps(output + i + 4, Mul(hi, scale));
+    }
+
+    return i;
+}
+
+inline std::size_t Unorm8ToFloat(const uint8_t* input, float* output, std::size_t count)
+{
+    const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+    std::size_t i      = 0;
+
+    for(; i + 16 <= count; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128 a, b, c, d;
+        UnsignedWordsToFloat(_mm_unpacklo_epi8(v, _mm_setzero_si128()), a, b);
+        UnsignedWordsToFloat(_mm_unpackhi_epi8(v, _mm_setzero_si128()), c, d);
+
+        _mm_storeu_ps(output + i, Mul(a, scale));
+        _mm_storeu_ps(output + i + 4, Mul(b, scale));
+        _mm_storeu_ps(output + i + 8, Mul(c, scale));
+        _mm_storeu_ps(output + i + 12, Mul(d, scale));
+    }
+
+    return i;
+}
+
+//! Octahedral normals
+//Packed float3 normals to packed float2 in [-1, 1]^2, see EncodeOctahedral
+inline std::size_t EncodeOctahedral(const float* normals, float* encoded, std::size_t count)
+{
+    const Pack signMask = SetPack(-0.0f);
+    const Pack one      = SetPack(1.0f);
+    std::size_t i       = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y, z;
+        LoadDeinterleaved3(normals + i * 3, x, y, z);
+
+        Pack ax    = AndNot(signMask, x);
+        Pack ay    = AndNot(signMask, y);
+        Pack invL1 = Div(one, Add(Add(ax, ay), AndNot(signMask, z)));
+
+        x = Mul(x, invL1);
+        y = Mul(y, invL1);
+
+        //Fold the lower hemisphere, x >= 0 ? 1 : -1 keeps -0 on the positive side
+        Pack fx = Mul(Sub(one, Mul(ay, invL1)), Select(GreaterEqual(x, ZeroPack()), one, SetPack(-1.0f)));
+        Pack fy = Mul(Sub(one, Mul(ax, invL1)), Select(GreaterEqual(y, ZeroPack()), one, SetPack(-1.0f)));
+
+        Pack lower = Less(z, ZeroPack());
+        StoreInterleaved2(encoded + i * 2, Select(lower, fx, x), Select(lower, fy, y));
+    }
+
+    return i;
+}
+
+inline std::size_t DecodeOctahedral(const float* encoded, float* normals, std::size_t count)
+{
+    const Pack signMask = SetPack(-0.0f);
+    const Pack one      = SetPack(1.0f);
+    std::size_t i       = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y;
+        LoadDeinterleaved2(encoded + i * 2, x, y);
+
+        Pack z = Sub(Sub(one, AndNot(signMask, x)), AndNot(signMask, y));
+        Pack t = Max(Sub(ZeroPack(), z), ZeroPack());
+
+        x = Select(GreaterEqual(x, ZeroPack()), Sub(x, t), Add(x, t));
+        y = Select(GreaterEqual(y, ZeroPack()), Sub(y, t), Add(y, t));
+
+        Pack invL = Div(one, Sqrt(MulAdd(z, z, MulAdd(y, y, Mul(x, x)))));
+        StoreInterleaved3(normals + i * 3, Mul(x, invL), Mul(y, invL), Mul(z, invL));
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,222 @@
+#pragma once
+#include <cstddef>
+#include "Simd.hpp"
+
+//SIMD kernels for float quaternions stored as packed (x, y, z, w). They return
+//the number of elements processed so the caller can finish the tail with
+//scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//Rotates (x, y, z) by (qx, qy, qz, qw) with v' = v + qw * t + cross(q.xyz, t)
+//where t = 2 * cross(q.xyz, v)
+template<typename V>
+inline void Rotate(V qx, V qy, V qz, V qw, V& x, V& y, V& z)
+{
+    V tx = Sub(Mul(qy, z), Mul(qz, y));
+    V ty = Sub(Mul(qz, x), Mul(qx, z));
+    V tz = Sub(Mul(qx, y), Mul(qy, x));
+    tx = Add(tx, tx);
+    ty = Add(ty, ty);
+    tz = Add(tz, tz);
+
+    x = Add(MulAdd(qw, tx, x), Sub(Mul(qy, tz), Mul(qz, ty)));
+    y = Add(MulAdd(qw, ty, y), Sub(Mul(qz, tx), Mul(qx, tz)));
+    z = Add(MulAdd(qw, tz, z), Sub(Mul(qx, ty), Mul(qy, tx)));
+}
+
+//Rotates every packed float3 by the same quaternion
+inline std::size_t RotateVec3(const float* q, const float* in, float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if MATH_SIMD_AVX2
+    __m256 qx = _mm256_set1_ps(q[0]), qy = _mm256_set1_ps(q[1]);
+    __m256 qz = _mm256_set1_ps(q[2]), qw = _mm256_set1_ps(q[3]);
+
+    for(; i + 8 <= count; i += 8)
+    {
+        const float* src = in + i * 3;
+        float* dst       = out + i * 3;
+        __m256 x, y, z;
+
+        Deinterleave3(_mm256_loadu2_m128(src + 12, src), _mm256_loadu2_m128(src + 16, src + 4),
+            _mm256_loadu2_m128(src + 20, src + 8), x, y, z);
+        Rotate(qx, qy, qz, qw, x, y, z);
+
+        __m256 v0, v1, v2;
+        Interleave3(x, y, z, v0, v1, v2);
+        _mm256_storeu2_m128(dst + 12, dst, v0);
+        _mm256_storeu2_m128(dst + 16, dst + 4, v1);
+        _mm256_storeu2_m128(dst + 20, dst + 8, v2);
+    }
+#endif
+
+    __m128 sx = _mm_set1_ps(q[0]), sy = _mm_set1_ps(q[1]);
+    __m128 sz = _mm_set1_ps(q[2]), sw = _mm_set1_ps(q[3]);
+
+    for(; i + 4 <= count; i += 4)
+    {
+        const float* src = in + i * 3;
+        float* dst       = out + i * 3;
+        __m128 x, y, z;
+
+        Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+        Rotate(sx, sy, sz, sw, x, y, z);
+
+        __m128 v0, v1, v2;
+        Interleave3(x, y, z, v0, v1, v2);
+        _mm_storeu_ps(dst, v0);
+        _mm_storeu_ps(dst + 4, v1);
+        _mm_storeu_ps(dst + 8, v2);
+    }
+
+    return i;
+}
+
+//Rotates every packed float3 by its own quaternion
+inline std::size_t RotateVec3PerElement(const float* q, const float* in, float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if MATH_SIMD_AVX2
+    for(; i + 8 <= count; i += 8)
+    {
+        const float* qs  = q + i * 4;
+        const float* src = in + i * 3;
+        float* dst       = out + i * 3;
+        __m256 qx = _mm256_loadu2_m128(qs + 16, qs);
+        __m256 qy = _mm256_loadu2_m128(qs + 20, qs + 4);
+        __m256 qz = _mm256_loadu2_m128(qs + 24, qs + 8);
+        __m256 qw = _mm256_loadu2_m128(qs + 28, qs + 12);
+        __m256 x, y, z;
+
+        Transpose4(qx, qy, qz, qw);
+        Deinterleave3(_mm256_loadu2_m128(src + 12, src), _mm256_loadu2_m128(src + 16, src + 4),
+            _mm256_loadu2_m128(src + 20, src + 8), x, y, z);
+        Rotate(qx, qy, qz, qw, x, y, z);
+
+        __m256 v0, v1, v2;
+        Interleave3(x, y, z, v0, v1, v2);
+        _mm256_storeu2_m128(dst + 12, dst, v0);
+        _mm256_storeu2_m128(dst + 16, dst + 4, v1);
+        _mm256_storeu2_m128(dst + 20, dst + 8, v2);
+    }
+#endif
+
+    for(; i + 4 <= count; i += 4)
+    {
+        const float* qs  = q + i * 4;
+        const float* src = in + i * 3;
+        float* dst       = out + i * 3;
+        __m128 qx = _mm_loadu_ps(qs);
+        __m128 qy = _mm_loadu_ps(qs + 4);
+        __m128 qz = _mm_loadu_ps(qs + 8);
+        __m128 qw = _mm_loadu_ps(qs + 12);
+        __m128 x, y, z;
+
+        Transpose4(qx, qy, qz, qw);
+        Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+        Rotate(qx, qy, qz, qw, x, y, z);
+
+        __m128 v0, v1, v2;
+        Interleave3(x, y, z, v0, v1, v2);
+        _mm_storeu_ps(dst, v0);
+        _mm_storeu_ps(dst + 4, v1);
+        _mm_storeu_ps(dst + 8, v2);
+    }
+
+    return i;
+}
+
+//Blends packed quaternions a[i] and b[i] by weights[i] through the shortest
+//path. Approximate applies the FastSlerp weight correction
+inline std::size_t BlendQuat(const float* a, const float* b, const float* weights, float* out, 
+    std::size_t count, bool approximate)
+{
+    std::size_t i = 0;
+    Pack signMask = SetPack(-0.0f);
+    Pack one      = SetPack(1.0f);
+    Pack half     = SetPack(0.5f);
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack ax, ay, az, aw, bx, by, bz, bw;
+        LoadTransposed4(a + i * 4, ax, ay, az, aw);
+        LoadTransposed4(b + i * 4, bx, by, bz, bw);
+        Pack t = LoadPackUnaligned(weights + i);
+
+        Pack d    = MulAdd(aw, bw, MulAdd(az, bz, MulAdd(ay, by, Mul(ax, bx))));
+        Pack sign = And(d, signMask);
+
+        if(approximate)
+        {
+            d = AndNot(signMask, d);
+            Pack ka = MulAdd(d, MulAdd(d, Sub(SetPack(3.55645f), Mul(d, SetPack(1.43519f))), 
+                SetPack(-3.2452f)), SetPack(1.0904f));
+            Pack kb = MulAdd(d, MulAdd(d, SetPack(0.215638f), SetPack(-1.06021f)), SetPack(0.848013f));
+            Pack th = Sub(t, half);
+            Pack k  = MulAdd(Mul(ka, th), th, kb);
+            t = MulAdd(Mul(Mul(t, th), Sub(t, one)), k, t);
+        }
+
+        Pack ta = Sub(one, t);
+        Pack tb = Xor(t, sign);
+        Pack rx = MulAdd(bx, tb, Mul(ax, ta));
+        Pack ry = MulAdd(by, tb, Mul(ay, ta));
+        Pack rz = MulAdd(bz, tb, Mul(az, ta));
+        Pack rw = MulAdd(bw, tb, Mul(aw, ta));
+        Pack invL = Div(one, Sqrt(MulAdd(rw, rw, MulAdd(rz, rz, MulAdd(ry, ry, Mul(rx, rx))))));
+
+        StoreTransposed4(out + i * 4, Mul(rx, invL), Mul(ry, invL), Mul(rz, invL), Mul(rw, invL));
+    }
+
+    return i;
+}
+
+//accumulator[i] += rotations[i] * weights[i], flipping rotations[i] to the
+//hemisphere of accumulator[i]
+inline std::size_t AccumulateQuat(float* accumulator, const float* rotations, const float* weights, 
+    std::size_t count)
+{
+    std::size_t i = 0;
+    Pack signMask = SetPack(-0.0f);
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack ax, ay, az, aw, bx, by, bz, bw;
+        LoadTransposed4(accumulator + i * 4, ax, ay, az, aw);
+        LoadTransposed4(rotations + i * 4, bx, by, bz, bw);
+
+        Pack d = MulAdd(aw, bw, MulAdd(az, bz, MulAdd(ay, by, Mul(ax, bx))));
+        Pack t = Xor(LoadPackUnaligned(weights + i), And(d, signMask));
+
+        StoreTransposed4(accumulator + i * 4, MulAdd(bx, t, ax), MulAdd(by, t, ay), 
+            MulAdd(bz, t, az), MulAdd(bw, t, aw));
+    }
+
+    return i;
+}
+
+inline std::size_t NormalizeQuat(float* q, std::size_t count)
+{
+    std::size_t i = 0;
+    Pack one      = SetPack(1.0f);
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y, z, w;
+        LoadTransposed4(q + i * 4, x, y, z, w);
+        Pack invL = Div(one, Sqrt(MulAdd(w, w, MulAdd(z, z, MulAdd(y, y, Mul(x, x))))));
+
+        StoreTransposed4(q + i * 4, Mul(x, invL), Mul(y, invL), Mul(z, invL), Mul(w, invL));
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
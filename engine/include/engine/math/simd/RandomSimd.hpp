@@ -0,0 +1,257 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+#include "TranscendentalSimd.hpp"
+
+//SIMD xoshiro128** generators and the distributions sampled from them. The
+//state of RandomLanes independent streams is stored as 4 words of RandomLanes
+//lanes (s0..., s1..., s2..., s3...) and runs a PackWidth lane group at a time,
+//so value l of step t is written at t * RandomLanes + l with SSE and AVX2
+//alike. The kernels write count whole blocks, a block is one step of every
+//lane for the uniform outputs and the steps one sample of every lane needs
+//for the others
+namespace math::simd
+{
+
+constexpr std::size_t RandomLanes = 8;
+
+#if MATH_SIMD_SSE
+
+struct RandomPack
+{
+    PackInt s0, s1, s2, s3;
+};
+
+template<int N>
+inline PackInt RotateLeftInt(PackInt v)
+{
+    return OrInt(ShiftLeftInt<N>(v), ShiftRightInt<32 - N>(v));
+}
+
+//High 32 bits of the unsigned 64 bit products a * b
+inline PackInt MulHighUnsigned(PackInt a, uint32_t b)
+{
+#if MATH_SIMD_AVX2
+    const __m256i factor = _mm256_set1_epi32(static_cast<int32_t>(b));
+    __m256i even         = _mm256_srli_epi64(_mm256_mul_epu32(a, factor), 32);
+    __m256i odd          = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), factor);
+
+    return _mm256_blend_epi32(even, odd, 0xAA);
+#else
+    const __m128i factor = _mm_set1_epi32(static_cast<int32_t>(b));
+    __m128i even         = _mm_srli_epi64(_mm_mul_epu32(a, factor), 32);
+    __m128i odd          = _mm_mul_epu32(_mm_srli_epi64(a, 32), factor);
+
+    return _mm_or_si128(even, _mm_and_si128(odd, _mm_set_epi32(-1, 0, -1, 0)));
+#endif
+}
+
+//Next 32 bits of every stream. The multiplications by 5 and 9 are shifts and
+//adds, SSE2 has no 32 bit multiply
+inline PackInt NextRandom(RandomPack& s)
+{
+    PackInt x      = AddInt(s.s1, ShiftLeftInt<2>(s.s1));
+    x              = RotateLeftInt<7>(x);
+    PackInt result = AddInt(x, ShiftLeftInt<3>(x));
+    PackInt t      = ShiftLeftInt<9>(s.s1);
+
+    s.s2 = XorInt(s.s2, s.s0);
+    s.s3 = XorInt(s.s3, s.s1);
+    s.s1 = XorInt(s.s1, s.s2);
+    s.s0 = XorInt(s.s0, s.s3);
+    s.s2 = XorInt(s.s2, t);
+    s.s3 = RotateLeftInt<11>(s.s3);
+
+    return result;
+}
+
+//Top 24 bits to [0, 1)
+inline Pack ToUniform(PackInt bits)
+{
+    return Mul(ConvertToFloat(ShiftRightInt<8>(bits)), SetPack(1.0f / 16777216.0f));
+}
+
+//Calls sample(streams, lane) once per lane group with the streams in registers
+template<typename Func>
+inline void ForEachRandomGroup(uint32_t* state, const Func& sample)
+{
+    for(std::size_t lane = 0; lane < RandomLanes; lane += PackWidth)
+    {
+        float* words = reinterpret_cast<float*>(state + lane);
+        RandomPack s = { CastToInt(LoadPackUnaligned(words)),
+                         CastToInt(LoadPackUnaligned(words + RandomLanes)),
+                         CastToInt(LoadPackUnaligned(words + RandomLanes * 2)),
+                         CastToInt(LoadPackUnaligned(words + RandomLanes * 3)) };
+
+        sample(s, lane);
+
+        StorePackUnaligned(words,                   CastToFloat(s.s0));
+        StorePackUnaligned(words + RandomLanes,     CastToFloat(s.s1));
+        StorePackUnaligned(words + RandomLanes * 2, CastToFloat(s.s2));
+        StorePackUnaligned(words + RandomLanes * 3, CastToFloat(s.s3));
+    }
+}
+
+//Angle in [-pi, pi)
+inline Pack ToAngle(PackInt bits)
+{
+    return MulAdd(ToUniform(bits), SetPack(6.28318530717958648f), SetPack(-3.14159265358979324f));
+}
+
+//! Uniform
+inline void RandomBits(uint32_t* state, uint32_t* output, std::size_t count)
+{
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            StorePackUnaligned(reinterpret_cast<float*>(output + i * RandomLanes + lane), CastToFloat(NextRandom(s)));
+        }
+    });
+}
+
+//[min, max)
+inline void RandomUniform(uint32_t* state, float* output, std::size_t count, float min, float max)
+{
+    const Pack offset = SetPack(min);
+    const Pack scale  = SetPack(max - min);
+
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            StorePackUnaligned(output + i * RandomLanes + lane, Add(Mul(ToUniform(NextRandom(s)), scale), offset));
+        }
+    });
+}
+
+//min + [0, range) by multiply and shift, range 0 is the whole 32 bit range
+inline void RandomUniformInt(uint32_t* state, int32_t* output, std::size_t count, int32_t min, uint32_t range)
+{
+    const PackInt offset = SetPackInt(min);
+
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            PackInt bits = NextRandom(s);
+            bits         = range == 0 ? bits : MulHighUnsigned(bits, range);
+
+            StorePackUnaligned(reinterpret_cast<float*>(output + i * RandomLanes + lane), CastToFloat(AddInt(bits, offset)));
+        }
+    });
+}
+
+//! Shapes
+//Box-Muller on two steps, the cosines fill the first half of a block of
+//2 * RandomLanes values and the sines the second
+inline void RandomGaussian(uint32_t* state, float* output, std::size_t count, float mean, float deviation)
+{
+    const Pack one    = SetPack(1.0f);
+    const Pack offset = SetPack(mean);
+    const Pack scale  = SetPack(deviation);
+
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            //1 - u is in (0, 1] so the logarithm is finite
+            Pack u      = Sub(one, ToUniform(NextRandom(s)));
+            Pack radius = Sqrt(Mul(Log<false>(u), SetPack(-2.0f)));
+            Pack sin, cos;
+            SinCos<false>(ToAngle(NextRandom(s)), sin, cos);
+
+            float* block = output + i * RandomLanes * 2 + lane;
+            StorePackUnaligned(block,               Add(Mul(Mul(radius, cos), scale), offset));
+            StorePackUnaligned(block + RandomLanes, Add(Mul(Mul(radius, sin), scale), offset));
+        }
+    });
+}
+
+//Uniform height and angle around z, two steps per sample
+inline void RandomDirection(RandomPack& s, Pack& x, Pack& y, Pack& z)
+{
+    z = Sub(Mul(ToUniform(NextRandom(s)), SetPack(2.0f)), SetPack(1.0f));
+
+    Pack radius = Sqrt(Max(ZeroPack(), Sub(SetPack(1.0f), Mul(z, z))));
+    Pack sin, cos;
+    SinCos<false>(ToAngle(NextRandom(s)), sin, cos);
+
+    x = Mul(radius, cos);
+    y = Mul(radius, sin);
+}
+
+//Packed float3
+inline void RandomOnUnitSphere(uint32_t* state, float* output, std::size_t count)
+{
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            Pack x, y, z;
+            RandomDirection(s, x, y, z);
+
+            StoreInterleaved3(output + (i * RandomLanes + lane) * 3, x, y, z);
+        }
+    });
+}
+
+//Packed float3, a direction scaled by the cube root of a third step
+inline void RandomInUnitSphere(uint32_t* state, float* output, std::size_t count)
+{
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            Pack x, y, z;
+            RandomDirection(s, x, y, z);
+
+            //u = 0 gives exp(-inf) = 0. The fast polynomials are enough for a
+            //radius, the clamp keeps their error from leaving the ball
+            Pack radius = Exp<true>(Mul(Log<true>(ToUniform(NextRandom(s))), SetPack(1.0f / 3.0f)));
+            radius      = Min(radius, SetPack(1.0f));
+
+            StoreInterleaved3(output + (i * RandomLanes + lane) * 3, Mul(x, radius), Mul(y, radius), Mul(z, radius));
+        }
+    });
+}
+
+//Packed float2
+inline void RandomInUnitDisk(uint32_t* state, float* output, std::size_t count)
+{
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            Pack radius = Sqrt(ToUniform(NextRandom(s)));
+            Pack sin, cos;
+            SinCos<false>(ToAngle(NextRandom(s)), sin, cos);
+
+            StoreInterleaved2(output + (i * RandomLanes + lane) * 2, Mul(radius, cos), Mul(radius, sin));
+        }
+    });
+}
+
+//Packed float quaternions (x, y, z, w), Shoemake's uniform rotations
+inline void RandomRotations(uint32_t* state, float* output, std::size_t count)
+{
+    ForEachRandomGroup(state, [&](RandomPack& s, std::size_t lane)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            Pack u = ToUniform(NextRandom(s));
+            Pack a = Sqrt(Sub(SetPack(1.0f), u));
+            Pack b = Sqrt(u);
+            Pack sin0, cos0, sin1, cos1;
+            SinCos<false>(ToAngle(NextRandom(s)), sin0, cos0);
+            SinCos<false>(ToAngle(NextRandom(s)), sin1, cos1);
+
+            StoreTransposed4(output + (i * RandomLanes + lane) * 4, Mul(a, sin0), Mul(a, cos0), Mul(b, sin1), Mul(b, cos1));
+        }
+    });
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include "Simd.hpp"
+
+//SIMD kernels moving double precision world data into camera relative space
+//and narrowing it to float. The subtraction is done in double so the float
+//result keeps full precision at any distance from the world origin. They
+//return the number of elements processed so the caller can finish the tail
+//with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//Packed double3 - origin -> packed float3, 4 positions (12 doubles) per
+//iteration so the origin pattern repeats on register boundaries
+inline std::size_t RebasePositions(const double* positions, const double* origin, float* output, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if MATH_SIMD_AVX2
+    const __m256d o0 = _mm256_setr_pd(origin[0], origin[1], origin[2], origin[0]);
+    const __m256d o1 = _mm256_setr_pd(origin[1], origin[2], origin[0], origin[1]);
+    const __m256d o2 = _mm256_setr_pd(origin[2], origin[0], origin[1], origin[2]);
+
+    for(; i + 4 <= count; i += 4)
+    {
+        const double* src = positions + i * 3;
+        float* dst        = output + i * 3;
+
+        _mm_storeu_ps(dst,     _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src),     o0)));
+        _mm_storeu_ps(dst + 4, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src + 4), o1)));
+        _mm_storeu_ps(dst + 8, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src + 8), o2)));
+    }
+#else
+    const __m128d o0 = _mm_setr_pd(origin[0], origin[1]);
+    const __m128d o1 = _mm_setr_pd(origin[2], origin[0]);
+    const __m128d o2 = _mm_setr_pd(origin[1], origin[2]);
+
+    for(; i + 4 <= count; i += 4)
+    {
+        const double* src = positions + i * 3;
+        float* dst        = output + i * 3;
+
+        //Each conversion fills the low half, two of them make one store
+        __m128 a = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src),      o0));
+        __m128 b = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 2),  o1));
+        __m128 c = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 4),  o2));
+        __m128 d = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 6),  o0));
+        __m128 e = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 8),  o1));
+        __m128 f = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 10), o2));
+
+        _mm_storeu_ps(dst,     _mm_movelh_ps(a, b));
+        _mm_storeu_ps(dst + 4, _mm_movelh_ps(c, d));
+        _mm_storeu_ps(dst + 8, _mm_movelh_ps(e, f));
+    }
+#endif
+
+    return i;
+}
+
+//Column major double 4x4 matrices premultiplied by a translation of -origin
+//-> float matrices. Every column loses origin * w, which only touches the
+//translation of affine transforms
+inline std::size_t RebaseTransforms(const double* matrices, const double* origin, float* output, std::size_t count)
+{
+#if MATH_SIMD_AVX2
+    const __m256d o = _mm256_setr_pd(origin[0], origin[1], origin[2], 0);
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        const double* src = matrices + i * 16;
+        float* dst        = output + i * 16;
+
+        for(std::size_t c = 0; c < 16; c += 4)
+        {
+            __m256d column = _mm256_loadu_pd(src + c);
+            __m256d w      = _mm256_permute4x64_pd(column, 0xFF);
+
+            _mm_storeu_ps(dst + c, _mm256_cvtpd_ps(_mm256_sub_pd(column, _mm256_mul_pd(o, w))));
+        }
+    }
+#else
+    const __m128d oxy = _mm_setr_pd(origin[0], origin[1]);
+    const __m128d oz  = _mm_setr_pd(origin[2], 0);
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        const double* src = matrices + i * 16;
+        float* dst        = output + i * 16;
+
+        for(std::size_t c = 0; c < 16; c += 4)
+        {
+            __m128d xy = _mm_loadu_pd(src + c);
+            __m128d zw = _mm_loadu_pd(src + c + 2);
+            __m128d w  = _mm_unpackhi_pd(zw, zw);
+
+            __m128 lo = _mm_cvtpd_ps(_mm_sub_pd(xy, _mm_mul_pd(oxy, w)));
+            __m128 hi = _mm_cvtpd_ps(_mm_sub_pd(zw, _mm_mul_pd(oz, w)));
+            _mm_storeu_ps(dst + c, _mm_movelh_ps(lo, hi));
+        }
+    }
+#endif
+
+    return count;
+}
+
+#endif
+
+} //namespace math::simd
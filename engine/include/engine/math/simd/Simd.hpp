@@ -0,0 +1,412 @@
+#pragma once
+
+//SIMD instruction set selection. SSE2 is always available on x86-64 and
+//AVX2/FMA/F16C are enabled when the compiler targets them (-mavx2 -mfma -mf16c
+//or the ENGINE_MATH_AVX2 CMake option). Define MATH_SIMD_DISABLE to force the
+//scalar paths
+#if !defined(MATH_SIMD_DISABLE) && (defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define MATH_SIMD_SSE 1
+#else
+    #define MATH_SIMD_SSE 0
+#endif
+
+#if MATH_SIMD_SSE && defined(__AVX2__)
+    #define MATH_SIMD_AVX2 1
+#else
+    #define MATH_SIMD_AVX2 0
+#endif
+
+#if MATH_SIMD_SSE && defined(__FMA__)
+    #define MATH_SIMD_FMA 1
+#else
+    #define MATH_SIMD_FMA 0
+#endif
+
+#if MATH_SIMD_SSE && defined(__F16C__)
+    #define MATH_SIMD_F16C 1
+#else
+    #define MATH_SIMD_F16C 0
+#endif
+
+#if MATH_SIMD_SSE
+    #include <immintrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+#define MATH_SHUFFLE_MASK(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//! 128 bit operations
+inline __m128 Add(__m128 a, __m128 b)     { return _mm_add_ps(a, b); }
+inline __m128 Sub(__m128 a, __m128 b)     { return _mm_sub_ps(a, b); }
+inline __m128 Mul(__m128 a, __m128 b)     { return _mm_mul_ps(a, b); }
+inline __m128 Div(__m128 a, __m128 b)     { return _mm_div_ps(a, b); }
+inline __m128 Min(__m128 a, __m128 b)     { return _mm_min_ps(a, b); }
+inline __m128 Max(__m128 a, __m128 b)     { return _mm_max_ps(a, b); }
+inline __m128 Sqrt(__m128 a)              { return _mm_sqrt_ps(a); }
+inline __m128 And(__m128 a, __m128 b)     { return _mm_and_ps(a, b); }
+inline __m128 Or(__m128 a, __m128 b)      { return _mm_or_ps(a, b); }
+inline __m128 Xor(__m128 a, __m128 b)     { return _mm_xor_ps(a, b); }
+inline __m128 AndNot(__m128 a, __m128 b)  { return _mm_andnot_ps(a, b); }
+inline __m128 GreaterEqual(__m128 a, __m128 b) { return _mm_cmpge_ps(a, b); }
+inline __m128 Less(__m128 a, __m128 b)    { return _mm_cmplt_ps(a, b); }
+inline __m128 Equal(__m128 a, __m128 b)   { return _mm_cmpeq_ps(a, b); }
+inline int    MoveMask(__m128 a)          { return _mm_movemask_ps(a); }
+
+//a * b + c
+inline __m128 MulAdd(__m128 a, __m128 b, __m128 c)
+{
+#if MATH_SIMD_FMA
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+//(a[X], a[Y], b[Z], b[W])
+template<int X, int Y, int Z, int W>
+inline __m128 Shuffle(__m128 a, __m128 b)
+{
+    return _mm_shuffle_ps(a, b, MATH_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+template<int X, int Y, int Z, int W>
+inline __m128 Swizzle(__m128 v)
+{
+    return _mm_shuffle_ps(v, v, MATH_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+template<int I>
+inline __m128 Splat(__m128 v)
+{
+    return _mm_shuffle_ps(v, v, MATH_SHUFFLE_MASK(I, I, I, I));
+}
+
+//1 / sqrt(x) from rsqrtps refined with one Newton-Raphson step
+//(max relative error ~5e-7, see FastInvSqrt in Functions.hpp)
+inline __m128 FastInvSqrt(__m128 x)
+{
+    __m128 y   = _mm_rsqrt_ps(x);
+    __m128 xyy = _mm_mul_ps(_mm_mul_ps(x, y), y);
+
+    return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), xyy));
+}
+
+//Sum of the 4 lanes broadcast to every lane
+inline __m128 HorizontalSum(__m128 v)
+{
+    v = _mm_add_ps(v, Swizzle<2, 3, 0, 1>(v));
+    return _mm_add_ps(v, Swizzle<1, 0, 3, 2>(v));
+}
+
+//! 256 bit operations
+#if MATH_SIMD_AVX2
+inline __m256 Add(__m256 a, __m256 b)     { return _mm256_add_ps(a, b); }
+inline __m256 Sub(__m256 a, __m256 b)     { return _mm256_sub_ps(a, b); }
+inline __m256 Mul(__m256 a, __m256 b)     { return _mm256_mul_ps(a, b); }
+inline __m256 Div(__m256 a, __m256 b)     { return _mm256_div_ps(a, b); }
+inline __m256 Min(__m256 a, __m256 b)     { return _mm256_min_ps(a, b); }
+inline __m256 Max(__m256 a, __m256 b)     { return _mm256_max_ps(a, b); }
+inline __m256 Sqrt(__m256 a)              { return _mm256_sqrt_ps(a); }
+inline __m256 And(__m256 a, __m256 b)     { return _mm256_and_ps(a, b); }
+inline __m256 Or(__m256 a, __m256 b)      { return _mm256_or_ps(a, b); }
+inline __m256 Xor(__m256 a, __m256 b)     { return _mm256_xor_ps(a, b); }
+inline __m256 AndNot(__m256 a, __m256 b)  { return _mm256_andnot_ps(a, b); }
+inline __m256 GreaterEqual(__m256 a, __m256 b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+inline __m256 Less(__m256 a, __m256 b)    { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+inline __m256 Equal(__m256 a, __m256 b)   { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+inline int    MoveMask(__m256 a)          { return _mm256_movemask_ps(a); }
+
+//a * b + c
+inline __m256 MulAdd(__m256 a, __m256 b, __m256 c)
+{
+#if MATH_SIMD_FMA
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+inline __m256 FastInvSqrt(__m256 x)
+{
+    __m256 y   = _mm256_rsqrt_ps(x);
+    __m256 xyy = _mm256_mul_ps(_mm256_mul_ps(x, y), y);
+
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), _mm256_sub_ps(_mm256_set1_ps(3.0f), xyy));
+}
+
+//(a[X], a[Y], b[Z], b[W]) on each 128 bit lane
+template<int X, int Y, int Z, int W>
+inline __m256 Shuffle(__m256 a, __m256 b)
+{
+    return _mm256_shuffle_ps(a, b, MATH_SHUFFLE_MASK(X, Y, Z, W));
+}
+#endif
+
+//! Register layout helpers
+//Converts 4 packed float3 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) into
+//(x0 x1 x2 x3), (y0 y1 y2 y3), (z0 z1 z2 z3). Works per 128 bit lane on __m256
+template<typename V>
+inline void Deinterleave3(V v0, V v1, V v2, V& x, V& y, V& z)
+{
+    V t = Shuffle<2, 3, 0, 1>(v1, v2);
+    V u = Shuffle<1, 2, 0, 1>(v0, v1);
+    V s = Shuffle<3, 3, 2, 2>(v1, v2);
+
+    x = Shuffle<0, 3, 0, 3>(v0, t);
+    y = Shuffle<0, 2, 0, 2>(u, s);
+    z = Shuffle<1, 3, 0, 3>(u, v2);
+}
+
+//Transposes 4 float4 rows in place. Works per 128 bit lane on __m256
+template<typename V>
+inline void Transpose4(V& r0, V& r1, V& r2, V& r3)
+{
+    V t0 = Shuffle<0, 1, 0, 1>(r0, r1);
+    V t1 = Shuffle<2, 3, 2, 3>(r0, r1);
+    V t2 = Shuffle<0, 1, 0, 1>(r2, r3);
+    V t3 = Shuffle<2, 3, 2, 3>(r2, r3);
+
+    r0 = Shuffle<0, 2, 0, 2>(t0, t2);
+    r1 = Shuffle<1, 3, 1, 3>(t0, t2);
+    r2 = Shuffle<0, 2, 0, 2>(t1, t3);
+    r3 = Shuffle<1, 3, 1, 3>(t1, t3);
+}
+
+//Inverse of Deinterleave3
+template<typename V>
+inline void Interleave3(V x, V y, V z, V& v0, V& v1, V& v2)
+{
+    V a = Shuffle<0, 2, 0, 2>(x, y);
+    V b = Shuffle<0, 1, 1, 3>(z, x);
+    V c = Shuffle<1, 3, 2, 3>(y, z);
+    V d = Shuffle<0, 0, 1, 1>(c, b);
+    V e = Shuffle<2, 2, 3, 3>(c, b);
+
+    v0 = Shuffle<0, 2, 0, 2>(a, b);
+    v1 = Shuffle<0, 2, 1, 3>(d, a);
+    v2 = Shuffle<0, 2, 1, 3>(e, c);
+}
+
+//Lanes of a where mask is set, lanes of b elsewhere
+template<typename V>
+inline V Select(V mask, V a, V b)
+{
+    return Or(And(mask, a), AndNot(mask, b));
+}
+
+//! Widest float register available
+#if MATH_SIMD_AVX2
+using Pack = __m256;
+constexpr std::size_t PackWidth = 8;
+
+inline Pack LoadPack(const float* ptr)                { return _mm256_load_ps(ptr); }
+inline Pack LoadPackUnaligned(const float* ptr)       { return _mm256_loadu_ps(ptr); }
+inline void StorePack(float* ptr, Pack v)             { _mm256_store_ps(ptr, v); }
+inline void StorePackUnaligned(float* ptr, Pack v)    { _mm256_storeu_ps(ptr, v); }
+inline Pack SetPack(float value)                      { return _mm256_set1_ps(value); }
+inline Pack ZeroPack()                                { return _mm256_setzero_ps(); }
+
+//Matching 32 bit integer lanes
+using PackInt = __m256i;
+
+inline PackInt SetPackInt(int32_t value)              { return _mm256_set1_epi32(value); }
+inline PackInt ConvertToInt(Pack v)                   { return _mm256_cvtps_epi32(v); }
+inline PackInt TruncateToInt(Pack v)                  { return _mm256_cvttps_epi32(v); }
+inline Pack    ConvertToFloat(PackInt v)              { return _mm256_cvtepi32_ps(v); }
+inline PackInt CastToInt(Pack v)                      { return _mm256_castps_si256(v); }
+inline Pack    CastToFloat(PackInt v)                 { return _mm256_castsi256_ps(v); }
+inline PackInt AddInt(PackInt a, PackInt b)           { return _mm256_add_epi32(a, b); }
+inline PackInt SubInt(PackInt a, PackInt b)           { return _mm256_sub_epi32(a, b); }
+inline PackInt AndInt(PackInt a, PackInt b)           { return _mm256_and_si256(a, b); }
+inline PackInt OrInt(PackInt a, PackInt b)            { return _mm256_or_si256(a, b); }
+inline PackInt XorInt(PackInt a, PackInt b)           { return _mm256_xor_si256(a, b); }
+//Low 32 bits of the products
+inline PackInt MulInt(PackInt a, PackInt b)           { return _mm256_mullo_epi32(a, b); }
+inline PackInt EqualInt(PackInt a, PackInt b)         { return _mm256_cmpeq_epi32(a, b); }
+
+template<int N>
+inline PackInt ShiftLeftInt(PackInt v)                { return _mm256_slli_epi32(v, N); }
+//Logical shift, zeros are shifted in
+template<int N>
+inline PackInt ShiftRightInt(PackInt v)               { return _mm256_srli_epi32(v, N); }
+#else
+using Pack = __m128;
+constexpr std::size_t PackWidth = 4;
+
+inline Pack LoadPack(const float* ptr)                { return _mm_load_ps(ptr); }
+inline Pack LoadPackUnaligned(const float* ptr)       { return _mm_loadu_ps(ptr); }
+inline void StorePack(float* ptr, Pack v)             { _mm_store_ps(ptr, v); }
+inline void StorePackUnaligned(float* ptr, Pack v)    { _mm_storeu_ps(ptr, v); }
+inline Pack SetPack(float value)                      { return _mm_set1_ps(value); }
+inline Pack ZeroPack()                                { return _mm_setzero_ps(); }
+
+//Matching 32 bit integer lanes
+using PackInt = __m128i;
+
+inline PackInt SetPackInt(int32_t value)              { return _mm_set1_epi32(value); }
+inline PackInt ConvertToInt(Pack v)                   { return _mm_cvtps_epi32(v); }
+inline PackInt TruncateToInt(Pack v)                  { return _mm_cvttps_epi32(v); }
+inline Pack    ConvertToFloat(PackInt v)              { return _mm_cvtepi32_ps(v); }
+inline PackInt CastToInt(Pack v)                      { return _mm_castps_si128(v); }
+inline Pack    CastToFloat(PackInt v)                 { return _mm_castsi128_ps(v); }
+inline PackInt AddInt(PackInt a, PackInt b)           { return _mm_add_epi32(a, b); }
+inline PackInt SubInt(PackInt a, PackInt b)           { return _mm_sub_epi32(a, b); }
+inline PackInt AndInt(PackInt a, PackInt b)           { return _mm_and_si128(a, b); }
+inline PackInt OrInt(PackInt a, PackInt b)            { return _mm_or_si128(a, b); }
+inline PackInt XorInt(PackInt a, PackInt b)           { return _mm_xor_si128(a, b); }
+
+//Low 32 bits of the products, SSE2 multiplies the even and odd lanes separately
+inline PackInt MulInt(PackInt a, PackInt b)
+{
+#if defined(__SSE4_1__)
+    return _mm_mullo_epi32(a, b);
+#else
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, MATH_SHUFFLE_MASK(0, 2, 0, 0)), 
+                              _mm_shuffle_epi32(odd, MATH_SHUFFLE_MASK(0, 2, 0, 0)));
+#endif
+}
+
+inline PackInt EqualInt(PackInt a, PackInt b)         { return _mm_cmpeq_epi32(a, b); }
+
+template<int N>
+inline PackInt ShiftLeftInt(PackInt v)                { return _mm_slli_epi32(v, N); }
+//Logical shift, zeros are shifted in
+template<int N>
+inline PackInt ShiftRightInt(PackInt v)               { return _mm_srli_epi32(v, N); }
+#endif
+
+//Loads PackWidth packed float4 as (x..., y..., z..., w...)
+inline void LoadTransposed4(const float* ptr, Pack& x, Pack& y, Pack& z, Pack& w)
+{
+#if MATH_SIMD_AVX2
+    x = _mm256_loadu2_m128(ptr + 16, ptr);
+    y = _mm256_loadu2_m128(ptr + 20, ptr + 4);
+    z = _mm256_loadu2_m128(ptr + 24, ptr + 8);
+    w = _mm256_loadu2_m128(ptr + 28, ptr + 12);
+#else
+    x = _mm_loadu_ps(ptr);
+    y = _mm_loadu_ps(ptr + 4);
+    z = _mm_loadu_ps(ptr + 8);
+    w = _mm_loadu_ps(ptr + 12);
+#endif
+    Transpose4(x, y, z, w);
+}
+
+//Loads a float4 from each of the PackWidth pointers as (x..., y..., z..., w...)
+inline void GatherTransposed4(const float* const* ptrs, Pack& x, Pack& y, Pack& z, Pack& w)
+{
+#if MATH_SIMD_AVX2
+    x = _mm256_loadu2_m128(ptrs[4], ptrs[0]);
+    y = _mm256_loadu2_m128(ptrs[5], ptrs[1]);
+    z = _mm256_loadu2_m128(ptrs[6], ptrs[2]);
+    w = _mm256_loadu2_m128(ptrs[7], ptrs[3]);
+#else
+    x = _mm_loadu_ps(ptrs[0]);
+    y = _mm_loadu_ps(ptrs[1]);
+    z = _mm_loadu_ps(ptrs[2]);
+    w = _mm_loadu_ps(ptrs[3]);
+#endif
+    Transpose4(x, y, z, w);
+}
+
+//Loads a float4 every stride floats, PackWidth times, as (x..., y..., z..., w...).
+//Reads structures wider than a float4 (rays, boxes, triangles) a part at a time
+inline void LoadStridedTransposed4(const float* ptr, std::size_t stride, Pack& x, Pack& y, Pack& z, Pack& w)
+{
+#if MATH_SIMD_AVX2
+    x = _mm256_loadu2_m128(ptr + stride * 4, ptr);
+    y = _mm256_loadu2_m128(ptr + stride * 5, ptr + stride);
+    z = _mm256_loadu2_m128(ptr + stride * 6, ptr + stride * 2);
+    w = _mm256_loadu2_m128(ptr + stride * 7, ptr + stride * 3);
+#else
+    x = _mm_loadu_ps(ptr);
+    y = _mm_loadu_ps(ptr + stride);
+    z = _mm_loadu_ps(ptr + stride * 2);
+    w = _mm_loadu_ps(ptr + stride * 3);
+#endif
+    Transpose4(x, y, z, w);
+}
+
+//Inverse of LoadTransposed4
+inline void StoreTransposed4(float* ptr, Pack x, Pack y, Pack z, Pack w)
+{
+    Transpose4(x, y, z, w);
+#if MATH_SIMD_AVX2
+    _mm256_storeu2_m128(ptr + 16, ptr, x);
+    _mm256_storeu2_m128(ptr + 20, ptr + 4, y);
+    _mm256_storeu2_m128(ptr + 24, ptr + 8, z);
+    _mm256_storeu2_m128(ptr + 28, ptr + 12, w);
+#else
+    _mm_storeu_ps(ptr, x);
+    _mm_storeu_ps(ptr + 4, y);
+    _mm_storeu_ps(ptr + 8, z);
+    _mm_storeu_ps(ptr + 12, w);
+#endif
+}
+
+//Loads PackWidth packed float2 as (x..., y...)
+inline void LoadDeinterleaved2(const float* ptr, Pack& x, Pack& y)
+{
+#if MATH_SIMD_AVX2
+    Pack v0 = _mm256_loadu2_m128(ptr + 8, ptr);
+    Pack v1 = _mm256_loadu2_m128(ptr + 12, ptr + 4);
+#else
+    Pack v0 = _mm_loadu_ps(ptr);
+    Pack v1 = _mm_loadu_ps(ptr + 4);
+#endif
+    x = Shuffle<0, 2, 0, 2>(v0, v1);
+    y = Shuffle<1, 3, 1, 3>(v0, v1);
+}
+
+//Inverse of LoadDeinterleaved2
+inline void StoreInterleaved2(float* ptr, Pack x, Pack y)
+{
+#if MATH_SIMD_AVX2
+    _mm256_storeu2_m128(ptr + 8, ptr, _mm256_unpacklo_ps(x, y));
+    _mm256_storeu2_m128(ptr + 12, ptr + 4, _mm256_unpackhi_ps(x, y));
+#else
+    _mm_storeu_ps(ptr, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(ptr + 4, _mm_unpackhi_ps(x, y));
+#endif
+}
+
+//Loads PackWidth packed float3 as (x..., y..., z...)
+inline void LoadDeinterleaved3(const float* ptr, Pack& x, Pack& y, Pack& z)
+{
+#if MATH_SIMD_AVX2
+    Deinterleave3(_mm256_loadu2_m128(ptr + 12, ptr), _mm256_loadu2_m128(ptr + 16, ptr + 4),
+        _mm256_loadu2_m128(ptr + 20, ptr + 8), x, y, z);
+#else
+    Deinterleave3(_mm_loadu_ps(ptr), _mm_loadu_ps(ptr + 4), _mm_loadu_ps(ptr + 8), x, y, z);
+#endif
+}
+
+//Inverse of LoadDeinterleaved3
+inline void StoreInterleaved3(float* ptr, Pack x, Pack y, Pack z)
+{
+    Pack v0, v1, v2;
+    Interleave3(x, y, z, v0, v1, v2);
+#if MATH_SIMD_AVX2
+    _mm256_storeu2_m128(ptr + 12, ptr, v0);
+    _mm256_storeu2_m128(ptr + 16, ptr + 4, v1);
+    _mm256_storeu2_m128(ptr + 20, ptr + 8, v2);
+#else
+    _mm_storeu_ps(ptr, v0);
+    _mm_storeu_ps(ptr + 4, v1);
+    _mm_storeu_ps(ptr + 8, v2);
+#endif
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,163 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+#include "QuaternionSimd.hpp"
+
+//SIMD CPU skinning kernels blending 4 bone influences per vertex. Every vertex
+//has 4 bone indices (uint16_t[4]) and 4 weights (float[4]), unused slots have
+//a weight of 0. Positions and normals are packed float3 and normals may be
+//null. They return the number of vertices processed so the caller can finish
+//the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//Stores the xyz lanes of v
+inline void StoreFloat3(float* ptr, __m128 v)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(ptr), v);
+    _mm_store_ss(ptr + 2, _mm_movehl_ps(v, v));
+}
+
+//Linear blend skinning with column based 4x4 bone matrices (float[16]). One
+//vertex per iteration, the bone columns are blended as they are stored so no
+//gather or transpose is needed
+inline std::size_t SkinLinear(const float* bones, const uint16_t* indices, const float* weights, 
+    const float* positions, const float* normals, float* outPositions, float* outNormals, std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        const uint16_t* index = indices + i * 4;
+        const float* bone     = bones + index[0] * 16;
+        __m128 w              = _mm_set1_ps(weights[i * 4]);
+
+        __m128 c0 = Mul(w, _mm_loadu_ps(bone));
+        __m128 c1 = Mul(w, _mm_loadu_ps(bone + 4));
+        __m128 c2 = Mul(w, _mm_loadu_ps(bone + 8));
+        __m128 c3 = Mul(w, _mm_loadu_ps(bone + 12));
+
+        for(int32_t k = 1; k < 4; ++k)
+        {
+            bone = bones + index[k] * 16;
+            w    = _mm_set1_ps(weights[i * 4 + k]);
+
+            c0 = MulAdd(w, _mm_loadu_ps(bone), c0);
+            c1 = MulAdd(w, _mm_loadu_ps(bone + 4), c1);
+            c2 = MulAdd(w, _mm_loadu_ps(bone + 8), c2);
+            c3 = MulAdd(w, _mm_loadu_ps(bone + 12), c3);
+        }
+
+        const float* p = positions + i * 3;
+        StoreFloat3(outPositions + i * 3, 
+            MulAdd(c2, _mm_set1_ps(p[2]), MulAdd(c1, _mm_set1_ps(p[1]), MulAdd(c0, _mm_set1_ps(p[0]), c3))));
+
+        if(normals)
+        {
+            const float* n = normals + i * 3;
+            StoreFloat3(outNormals + i * 3, 
+                MulAdd(c2, _mm_set1_ps(n[2]), MulAdd(c1, _mm_set1_ps(n[1]), Mul(c0, _mm_set1_ps(n[0])))));
+        }
+    }
+
+    return count;
+}
+
+//Dual quaternion skinning with bones stored as (real xyzw, dual xyzw). Weights
+//of bones on the other hemisphere of the first one are negated before
+//blending, the blend is normalised by the length of its real part
+inline std::size_t SkinDualQuaternion(const float* bones, const uint16_t* indices, const float* weights, 
+    const float* positions, const float* normals, float* outPositions, float* outNormals, std::size_t count)
+{
+    std::size_t i = 0;
+    Pack zero     = ZeroPack();
+    Pack signBit  = SetPack(-0.0f);
+    Pack one      = SetPack(1.0f);
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack w[4];
+        LoadTransposed4(weights + i * 4, w[0], w[1], w[2], w[3]);
+
+        Pack rx, ry, rz, rw, dx, dy, dz, dw;
+        Pack fx, fy, fz, fw;
+        for(int32_t k = 0; k < 4; ++k)
+        {
+            const float* real[PackWidth];
+            const float* dual[PackWidth];
+            for(std::size_t j = 0; j < PackWidth; ++j)
+            {
+                real[j] = bones + indices[(i + j) * 4 + k] * 8;
+                dual[j] = real[j] + 4;
+            }
+
+            Pack qx, qy, qz, qw, ex, ey, ez, ew;
+            GatherTransposed4(real, qx, qy, qz, qw);
+            GatherTransposed4(dual, ex, ey, ez, ew);
+
+            if(k == 0)
+            {
+                fx = qx;
+                fy = qy;
+                fz = qz;
+                fw = qw;
+                rx = Mul(w[0], qx);
+                ry = Mul(w[0], qy);
+                rz = Mul(w[0], qz);
+                rw = Mul(w[0], qw);
+                dx = Mul(w[0], ex);
+                dy = Mul(w[0], ey);
+                dz = Mul(w[0], ez);
+                dw = Mul(w[0], ew);
+                continue;
+            }
+
+            Pack dot    = MulAdd(qw, fw, MulAdd(qz, fz, MulAdd(qy, fy, Mul(qx, fx))));
+            Pack weight = Xor(w[k], AndNot(GreaterEqual(dot, zero), signBit));
+
+            rx = MulAdd(weight, qx, rx);
+            ry = MulAdd(weight, qy, ry);
+            rz = MulAdd(weight, qz, rz);
+            rw = MulAdd(weight, qw, rw);
+            dx = MulAdd(weight, ex, dx);
+            dy = MulAdd(weight, ey, dy);
+            dz = MulAdd(weight, ez, dz);
+            dw = MulAdd(weight, ew, dw);
+        }
+
+        Pack invL = Div(one, Sqrt(MulAdd(rw, rw, MulAdd(rz, rz, MulAdd(ry, ry, Mul(rx, rx))))));
+        rx = Mul(rx, invL);
+        ry = Mul(ry, invL);
+        rz = Mul(rz, invL);
+        rw = Mul(rw, invL);
+        dx = Mul(dx, invL);
+        dy = Mul(dy, invL);
+        dz = Mul(dz, invL);
+        dw = Mul(dw, invL);
+
+        //translation = 2 * (real.w * dual.xyz - dual.w * real.xyz + cross(real.xyz, dual.xyz))
+        Pack tx = Add(Sub(Mul(rw, dx), Mul(dw, rx)), Sub(Mul(ry, dz), Mul(rz, dy)));
+        Pack ty = Add(Sub(Mul(rw, dy), Mul(dw, ry)), Sub(Mul(rz, dx), Mul(rx, dz)));
+        Pack tz = Add(Sub(Mul(rw, dz), Mul(dw, rz)), Sub(Mul(rx, dy), Mul(ry, dx)));
+
+        Pack px, py, pz;
+        LoadDeinterleaved3(positions + i * 3, px, py, pz);
+        Rotate(rx, ry, rz, rw, px, py, pz);
+        StoreInterleaved3(outPositions + i * 3, Add(px, Add(tx, tx)), Add(py, Add(ty, ty)), Add(pz, Add(tz, tz)));
+
+        if(normals)
+        {
+            Pack nx, ny, nz;
+            LoadDeinterleaved3(normals + i * 3, nx, ny, nz);
+            Rotate(rx, ry, rz, rw, nx, ny, nz);
+            StoreInterleaved3(outNormals + i * 3, nx, ny, nz);
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
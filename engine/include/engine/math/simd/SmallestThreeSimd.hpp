@@ -0,0 +1,173 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+
+//SIMD smallest three encoding of packed float quaternions (x, y, z, w) into
+//16 bit words, see SmallestThree.hpp for the format. The math runs SoA on
+//PackWidth rotations and the bit fields go through two 32 bit halves, low for
+//bits [0, 32) and high for bits [32, 64). They return the number of elements
+//processed so the caller can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+template<int32_t ComponentBits>
+inline std::size_t EncodeSmallestThree(const float* rotations, uint16_t* words, std::size_t count)
+{
+    constexpr int32_t Words    = (2 + 3 * ComponentBits + 15) / 16;
+    constexpr float   MaxValue = static_cast<float>((1u << ComponentBits) - 2);
+
+    const Pack signMask = SetPack(-0.0f);
+    std::size_t i       = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y, z, w;
+        LoadTransposed4(rotations + i * 4, x, y, z, w);
+
+        //Index of the largest absolute component, the first one wins ties
+        Pack maxAbs  = AndNot(signMask, x);
+        Pack largest = ZeroPack();
+        Pack a       = AndNot(signMask, y);
+        Pack mask    = Less(maxAbs, a);
+        maxAbs       = Select(mask, a, maxAbs);
+        largest      = Select(mask, SetPack(1.0f), largest);
+        a            = AndNot(signMask, z);
+        mask         = Less(maxAbs, a);
+        maxAbs       = Select(mask, a, maxAbs);
+        largest      = Select(mask, SetPack(2.0f), largest);
+        mask         = Less(maxAbs, AndNot(signMask, w));
+        largest      = Select(mask, SetPack(3.0f), largest);
+
+        PackInt index = ConvertToInt(largest);
+        Pack is0      = Equal(largest, ZeroPack());
+        Pack is1      = Equal(largest, SetPack(1.0f));
+        Pack is2      = Equal(largest, SetPack(2.0f));
+
+        //Flip the rotation so the dropped component is positive
+        Pack dropped = Select(is0, x, Select(is1, y, Select(is2, z, w)));
+        Pack sign    = And(dropped, signMask);
+
+        //Remaining components in order, (y, z, w), (x, z, w), (x, y, w) or (x, y, z)
+        Pack c0 = Xor(Select(is0, y, x), sign);
+        Pack c1 = Xor(Select(Or(is0, is1), z, y), sign);
+        Pack c2 = Xor(Select(Or(Or(is0, is1), is2), w, z), sign);
+
+        const Pack sqrt2   = SetPack(1.41421356f);
+        const Pack one     = SetPack(1.0f);
+        const Pack halfMax = SetPack(0.5f * MaxValue);
+        const Pack maxPack = SetPack(MaxValue);
+
+        PackInt q0 = ConvertToInt(Max(ZeroPack(), Min(maxPack, Mul(MulAdd(c0, sqrt2, one), halfMax))));
+        PackInt q1 = ConvertToInt(Max(ZeroPack(), Min(maxPack, Mul(MulAdd(c1, sqrt2, one), halfMax))));
+        PackInt q2 = ConvertToInt(Max(ZeroPack(), Min(maxPack, Mul(MulAdd(c2, sqrt2, one), halfMax))));
+
+        //Bit layout is index | q0 | q1 | q2 from the top, q2 at bit 0
+        PackInt lo = OrInt(q2, ShiftLeftInt<ComponentBits>(q1));
+        lo         = OrInt(lo, ShiftLeftInt<2 * ComponentBits>(q0));
+
+        if constexpr (Words == 2)
+        {
+            //Two little endian words are one 32 bit value
+            lo = OrInt(lo, ShiftLeftInt<3 * ComponentBits>(index));
+            StorePackUnaligned(reinterpret_cast<float*>(words + i * 2), CastToFloat(lo));
+            continue;
+        }
+
+        //q0 straddles the two halves
+        PackInt hi = OrInt(ShiftRightInt<32 - 2 * ComponentBits>(q0), ShiftLeftInt<3 * ComponentBits - 32>(index));
+
+        alignas(32) uint32_t low[PackWidth];
+        alignas(32) uint32_t high[PackWidth];
+        StorePack(reinterpret_cast<float*>(low), CastToFloat(lo));
+        StorePack(reinterpret_cast<float*>(high), CastToFloat(hi));
+
+        for(std::size_t j = 0; j < PackWidth; ++j)
+        {
+            uint64_t packed = (static_cast<uint64_t>(high[j]) << 32) | low[j];
+            uint16_t* dst   = words + (i + j) * Words;
+
+            for(int32_t k = 0; k < Words; ++k)
+            {
+                dst[k] = static_cast<uint16_t>(packed >> (16 * k));
+            }
+        }
+    }
+
+    return i;
+}
+
+template<int32_t ComponentBits>
+inline std::size_t DecodeSmallestThree(const uint16_t* words, float* rotations, std::size_t count)
+{
+    constexpr int32_t Words    = (2 + 3 * ComponentBits + 15) / 16;
+    constexpr int32_t MaxValue = (1 << ComponentBits) - 2;
+    constexpr int32_t Mask     = (1 << ComponentBits) - 1;
+
+    //Centred in integers first so the midpoint decodes to exactly 0
+    const Pack scale     = SetPack(2 / (MaxValue * 1.41421356f));
+    const PackInt middle = SetPackInt(MaxValue / 2);
+    std::size_t i        = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        PackInt mask = SetPackInt(Mask);
+        PackInt lo, q0, index;
+
+        if constexpr (Words == 2)
+        {
+            lo    = CastToInt(LoadPackUnaligned(reinterpret_cast<const float*>(words + i * 2)));
+            q0    = AndInt(ShiftRightInt<2 * ComponentBits>(lo), mask);
+            index = ShiftRightInt<3 * ComponentBits>(lo);
+        }
+        else
+        {
+            alignas(32) uint32_t low[PackWidth];
+            alignas(32) uint32_t high[PackWidth];
+
+            for(std::size_t j = 0; j < PackWidth; ++j)
+            {
+                const uint16_t* src = words + (i + j) * Words;
+                uint64_t packed     = 0;
+
+                for(int32_t k = 0; k < Words; ++k)
+                {
+                    packed |= static_cast<uint64_t>(src[k]) << (16 * k);
+                }
+
+                low[j]  = static_cast<uint32_t>(packed);
+                high[j] = static_cast<uint32_t>(packed >> 32);
+            }
+
+            lo         = CastToInt(LoadPack(reinterpret_cast<const float*>(low)));
+            PackInt hi = CastToInt(LoadPack(reinterpret_cast<const float*>(high)));
+            q0         = AndInt(OrInt(ShiftRightInt<2 * ComponentBits>(lo), ShiftLeftInt<32 - 2 * ComponentBits>(hi)), mask);
+            index      = AndInt(ShiftRightInt<3 * ComponentBits - 32>(hi), SetPackInt(3));
+        }
+
+        Pack a = Mul(ConvertToFloat(SubInt(q0, middle)), scale);
+        Pack b = Mul(ConvertToFloat(SubInt(AndInt(ShiftRightInt<ComponentBits>(lo), mask), middle)), scale);
+        Pack c = Mul(ConvertToFloat(SubInt(AndInt(lo, mask), middle)), scale);
+        Pack d = Sqrt(Max(ZeroPack(), Sub(SetPack(1.0f), MulAdd(c, c, MulAdd(b, b, Mul(a, a))))));
+
+        Pack is0 = CastToFloat(EqualInt(index, SetPackInt(0)));
+        Pack is1 = CastToFloat(EqualInt(index, SetPackInt(1)));
+        Pack is2 = CastToFloat(EqualInt(index, SetPackInt(2)));
+        Pack is3 = CastToFloat(EqualInt(index, SetPackInt(3)));
+
+        Pack x = Select(is0, d, a);
+        Pack y = Select(is0, a, Select(is1, d, b));
+        Pack z = Select(Or(is0, is1), b, Select(is2, d, c));
+        Pack w = Select(is3, d, c);
+
+        StoreTransposed4(rotations + i * 4, x, y, z, w);
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,207 @@
+#pragma once
+#include <cstddef>
+#include "Simd.hpp"
+
+//SIMD kernels for structure of arrays float streams. Loads and stores on the
+//component arrays are aligned, so they must come from AlignedAllocator and
+//start at a multiple of PackWidth. Every kernel returns the number of
+//elements processed so the caller can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//Packed float3 -> x, y, z arrays
+inline std::size_t Gather3(const float* in, float* x, float* y, float* z, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if MATH_SIMD_AVX2
+    for(; i + 8 <= count; i += 8)
+    {
+        const float* src = in + i * 3;
+        __m256 rx, ry, rz;
+        Deinterleave3(_mm256_loadu2_m128(src + 12, src), _mm256_loadu2_m128(src + 16, src + 4),
+            _mm256_loadu2_m128(src + 20, src + 8), rx, ry, rz);
+
+        _mm256_store_ps(x + i, rx);
+        _mm256_store_ps(y + i, ry);
+        _mm256_store_ps(z + i, rz);
+    }
+#endif
+
+    for(; i + 4 <= count; i += 4)
+    {
+        const float* src = in + i * 3;
+        __m128 rx, ry, rz;
+        Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), rx, ry, rz);
+
+        _mm_store_ps(x + i, rx);
+        _mm_store_ps(y + i, ry);
+        _mm_store_ps(z + i, rz);
+    }
+
+    return i;
+}
+
+//x, y, z arrays -> packed float3
+inline std::size_t Scatter3(const float* x, const float* y, const float* z, float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if MATH_SIMD_AVX2
+    for(; i + 8 <= count; i += 8)
+    {
+        float* dst = out + i * 3;
+        __m256 v0, v1, v2;
+        Interleave3(_mm256_load_ps(x + i), _mm256_load_ps(y + i), _mm256_load_ps(z + i), v0, v1, v2);
+
+        _mm256_storeu2_m128(dst + 12, dst, v0);
+        _mm256_storeu2_m128(dst + 16, dst + 4, v1);
+        _mm256_storeu2_m128(dst + 20, dst + 8, v2);
+    }
+#endif
+
+    for(; i + 4 <= count; i += 4)
+    {
+        float* dst = out + i * 3;
+        __m128 v0, v1, v2;
+        Interleave3(_mm_load_ps(x + i), _mm_load_ps(y + i), _mm_load_ps(z + i), v0, v1, v2);
+
+        _mm_storeu_ps(dst, v0);
+        _mm_storeu_ps(dst + 4, v1);
+        _mm_storeu_ps(dst + 8, v2);
+    }
+
+    return i;
+}
+
+//Packed float4 -> x, y, z, w arrays
+inline std::size_t Gather4(const float* in, float* x, float* y, float* z, float* w, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + 4 <= count; i += 4)
+    {
+        const float* src = in + i * 4;
+        __m128 r0 = _mm_loadu_ps(src);
+        __m128 r1 = _mm_loadu_ps(src + 4);
+        __m128 r2 = _mm_loadu_ps(src + 8);
+        __m128 r3 = _mm_loadu_ps(src + 12);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_store_ps(x + i, r0);
+        _mm_store_ps(y + i, r1);
+        _mm_store_ps(z + i, r2);
+        _mm_store_ps(w + i, r3);
+    }
+
+    return i;
+}
+
+//x, y, z, w arrays -> packed float4
+inline std::size_t Scatter4(const float* x, const float* y, const float* z, const float* w, 
+    float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + 4 <= count; i += 4)
+    {
+        float* dst = out + i * 4;
+        __m128 r0 = _mm_load_ps(x + i);
+        __m128 r1 = _mm_load_ps(y + i);
+        __m128 r2 = _mm_load_ps(z + i);
+        __m128 r3 = _mm_load_ps(w + i);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_storeu_ps(dst, r0);
+        _mm_storeu_ps(dst + 4, r1);
+        _mm_storeu_ps(dst + 8, r2);
+        _mm_storeu_ps(dst + 12, r3);
+    }
+
+    return i;
+}
+
+//out may be unaligned
+inline std::size_t Length3(const float* x, const float* y, const float* z, float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack vx = LoadPack(x + i);
+        Pack vy = LoadPack(y + i);
+        Pack vz = LoadPack(z + i);
+        Pack l2 = MulAdd(vz, vz, MulAdd(vy, vy, Mul(vx, vx)));
+
+        StorePackUnaligned(out + i, Sqrt(l2));
+    }
+
+    return i;
+}
+
+inline std::size_t Length4(const float* x, const float* y, const float* z, const float* w, 
+    float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack vx = LoadPack(x + i);
+        Pack vy = LoadPack(y + i);
+        Pack vz = LoadPack(z + i);
+        Pack vw = LoadPack(w + i);
+        Pack l2 = MulAdd(vw, vw, MulAdd(vz, vz, MulAdd(vy, vy, Mul(vx, vx))));
+
+        StorePackUnaligned(out + i, Sqrt(l2));
+    }
+
+    return i;
+}
+
+inline std::size_t Normalize3(float* x, float* y, float* z, std::size_t count)
+{
+    std::size_t i = 0;
+    Pack one = SetPack(1.0f);
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack vx   = LoadPack(x + i);
+        Pack vy   = LoadPack(y + i);
+        Pack vz   = LoadPack(z + i);
+        Pack invL = Div(one, Sqrt(MulAdd(vz, vz, MulAdd(vy, vy, Mul(vx, vx)))));
+
+        StorePack(x + i, Mul(vx, invL));
+        StorePack(y + i, Mul(vy, invL));
+        StorePack(z + i, Mul(vz, invL));
+    }
+
+    return i;
+}
+
+inline std::size_t Normalize4(float* x, float* y, float* z, float* w, std::size_t count)
+{
+    std::size_t i = 0;
+    Pack one = SetPack(1.0f);
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack vx   = LoadPack(x + i);
+        Pack vy   = LoadPack(y + i);
+        Pack vz   = LoadPack(z + i);
+        Pack vw   = LoadPack(w + i);
+        Pack invL = Div(one, Sqrt(MulAdd(vw, vw, MulAdd(vz, vz, MulAdd(vy, vy, Mul(vx, vx))))));
+
+        StorePack(x + i, Mul(vx, invL));
+        StorePack(y + i, Mul(vy, invL));
+        StorePack(z + i, Mul(vz, invL));
+        StorePack(w + i, Mul(vw, invL));
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "Simd.hpp"
+
+//SIMD support point search over packed float3, used by the convex hull support
+//mapping of the GJK/EPA queries. Like the other array kernels it returns the
+//number of points processed so the caller can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//Index of the point with the largest dot product with direction among the
+//first multiple of PackWidth points, the first one on ties. bestDot and
+//bestIndex are only written when at least one pack was processed
+inline std::size_t FindSupport(const float* points, std::size_t count, const float* direction, float& bestDot,
+    uint32_t& bestIndex)
+{
+    if(count < PackWidth)
+    {
+        return 0;
+    }
+
+    Pack dx = SetPack(direction[0]);
+    Pack dy = SetPack(direction[1]);
+    Pack dz = SetPack(direction[2]);
+
+    alignas(32) int32_t lanes[PackWidth];
+    for(std::size_t lane = 0; lane < PackWidth; ++lane)
+    {
+        lanes[lane] = static_cast<int32_t>(lane);
+    }
+
+    PackInt index   = CastToInt(LoadPack(reinterpret_cast<const float*>(lanes)));
+    PackInt step    = SetPackInt(static_cast<int32_t>(PackWidth));
+    Pack    best    = SetPack(-std::numeric_limits<float>::infinity());
+    Pack    bestIdx = CastToFloat(index);
+
+    std::size_t i = 0;
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack x, y, z;
+        LoadDeinterleaved3(points + i * 3, x, y, z);
+
+        //Strictly greater keeps the first index of every lane
+        Pack dot   = MulAdd(z, dz, MulAdd(y, dy, Mul(x, dx)));
+        Pack mask  = Less(best, dot);
+        best       = Select(mask, dot, best);
+        bestIdx    = Select(mask, CastToFloat(index), bestIdx);
+        index      = AddInt(index, step);
+    }
+
+    alignas(32) float   dots[PackWidth];
+    alignas(32) int32_t indices[PackWidth];
+    StorePack(dots, best);
+    StorePack(reinterpret_cast<float*>(indices), bestIdx);
+
+    bestDot   = dots[0];
+    bestIndex = static_cast<uint32_t>(indices[0]);
+    for(std::size_t lane = 1; lane < PackWidth; ++lane)
+    {
+        uint32_t laneIndex = static_cast<uint32_t>(indices[lane]);
+        if(dots[lane] > bestDot || (dots[lane] == bestDot && laneIndex < bestIndex))
+        {
+            bestDot   = dots[lane];
+            bestIndex = laneIndex;
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+} //namespace math::simd
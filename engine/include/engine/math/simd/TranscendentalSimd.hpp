@@ -0,0 +1,329 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include "Simd.hpp"
+
+//Polynomial approximations of sin, cos, exp, log, atan2 and pow on whole
+//registers. Fast = false uses the Cephes single precision polynomials (a few
+//ulp), Fast = true uses shorter minimax fits with a single step range
+//reduction (see the error bounds on each function). The array kernels return
+//the number of elements processed so the caller can finish the tail with
+//scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//sin and cos of x in one pass. The argument is reduced by multiples of pi / 4,
+//accurate results need |x| < 8192 and the fast path loses accuracy above ~100.
+//Max absolute error ~1e-7 (accurate) and ~1e-6 (fast) on [-pi, pi]
+template<bool Fast>
+inline void SinCos(Pack x, Pack& sin, Pack& cos)
+{
+    const Pack signMask = SetPack(-0.0f);
+
+    Pack sign = And(x, signMask);
+    x         = AndNot(signMask, x);
+
+    //Octant rounded up to an even number so x lands in [-pi / 4, pi / 4]
+    PackInt octant = TruncateToInt(Mul(x, SetPack(1.27323954473516f)));
+    octant         = AndInt(AddInt(octant, SetPackInt(1)), SetPackInt(~1));
+    Pack y         = ConvertToFloat(octant);
+
+    if constexpr (Fast)
+    {
+        x = MulAdd(y, SetPack(-0.78539816339744831f), x);
+    }
+    else
+    {
+        x = MulAdd(y, SetPack(-0.78515625f), x);
+        x = MulAdd(y, SetPack(-2.4187564849853515625e-4f), x);
+        x = MulAdd(y, SetPack(-3.77489497744594108e-8f), x);
+    }
+
+    //Octants 2 and 6 swap the polynomials, 4 and 6 flip the sign of sin, 2
+    //and 4 the sign of cos
+    Pack usesSin  = CastToFloat(EqualInt(AndInt(octant, SetPackInt(2)), SetPackInt(0)));
+    Pack sinSign  = Xor(sign, CastToFloat(ShiftLeftInt<29>(AndInt(octant, SetPackInt(4)))));
+    Pack cosSign  = CastToFloat(ShiftLeftInt<29>(AndInt(SubInt(octant, SetPackInt(2)), SetPackInt(4))));
+    cosSign       = Xor(cosSign, signMask);
+
+    Pack z = Mul(x, x);
+    Pack s, c;
+
+    if constexpr (Fast)
+    {
+        s = MulAdd(z, SetPack(8.153007380437319e-3f), SetPack(-1.6662834687054484e-1f));
+        c = MulAdd(z, SetPack(-1.365248488344538e-3f), SetPack(4.1661280828974925e-2f));
+    }
+    else
+    {
+        s = MulAdd(z, SetPack(-1.9515295891e-4f), SetPack(8.3321608736e-3f));
+        s = MulAdd(s, z, SetPack(-1.6666654611e-1f));
+        c = MulAdd(z, SetPack(2.443315711809948e-5f), SetPack(-1.388731625493765e-3f));
+        c = MulAdd(c, z, SetPack(4.166664568298827e-2f));
+    }
+
+    s = MulAdd(Mul(s, z), x, x);
+    c = MulAdd(Mul(c, z), z, MulAdd(z, SetPack(-0.5f), SetPack(1.0f)));
+
+    sin = Xor(Select(usesSin, s, c), sinSign);
+    cos = Xor(Select(usesSin, c, s), cosSign);
+}
+
+template<bool Fast>
+inline Pack Sin(Pack x)
+{
+    Pack sin, cos;
+    SinCos<Fast>(x, sin, cos);
+    return sin;
+}
+
+template<bool Fast>
+inline Pack Cos(Pack x)
+{
+    Pack sin, cos;
+    SinCos<Fast>(x, sin, cos);
+    return cos;
+}
+
+//e^x. Results overflow to inf above ~88.72 and flush to 0 below ~-87.34.
+//Max relative error ~2e-7 (accurate) and ~6e-6 (fast)
+template<bool Fast>
+inline Pack Exp(Pack x)
+{
+    const Pack maxInput = SetPack(88.7228391f);
+    const Pack minInput = SetPack(-87.3365447f);
+
+    Pack overflow  = Less(maxInput, x);
+    Pack underflow = Less(x, minInput);
+    x              = Max(minInput, Min(maxInput, x));
+
+    //x = n * ln(2) + r with |r| <= ln(2) / 2
+    Pack n = ConvertToFloat(ConvertToInt(Mul(x, SetPack(1.44269504088896341f))));
+    Pack p;
+
+    if constexpr (Fast)
+    {
+        x = MulAdd(n, SetPack(-0.69314718055994531f), x);
+
+        p = MulAdd(x, SetPack(4.1921155638902564e-2f), SetPack(1.67538833061041e-1f));
+        p = MulAdd(p, x, SetPack(4.999895132007826e-1f));
+    }
+    else
+    {
+        x = MulAdd(n, SetPack(-0.693359375f), x);
+        x = MulAdd(n, SetPack(2.12194440e-4f), x);
+
+        p = MulAdd(x, SetPack(1.9875691500e-4f), SetPack(1.3981999507e-3f));
+        p = MulAdd(p, x, SetPack(8.3334519073e-3f));
+        p = MulAdd(p, x, SetPack(4.1665795894e-2f));
+        p = MulAdd(p, x, SetPack(1.6666665459e-1f));
+        p = MulAdd(p, x, SetPack(5.0000001201e-1f));
+    }
+
+    p = MulAdd(Mul(p, x), x, Add(x, SetPack(1.0f)));
+
+    //Scale by 2^n through the exponent bits. n = 128 at the top of the range
+    //is split in two multiplications so it does not overflow the exponent
+    PackInt e   = ConvertToInt(n);
+    PackInt top = ShiftRightInt<31>(SubInt(SetPackInt(127), e));
+    p           = Mul(p, CastToFloat(ShiftLeftInt<23>(AddInt(SubInt(e, top), SetPackInt(127)))));
+    p           = Mul(p, CastToFloat(ShiftLeftInt<23>(AddInt(top, SetPackInt(127)))));
+
+    p = Select(overflow, SetPack(std::numeric_limits<float>::infinity()), p);
+    return AndNot(underflow, p);
+}
+
+//Natural logarithm. Negative and NaN inputs give NaN, 0 gives -inf and denormals are
+//treated as the smallest normal float. Max absolute error ~1e-7 (accurate) and
+//~4e-6 (fast) around 1, relative error ~1e-7 elsewhere
+template<bool Fast>
+inline Pack Log(Pack x)
+{
+    Pack valid    = GreaterEqual(x, ZeroPack());
+    Pack zero     = Equal(x, ZeroPack());
+    Pack infinite = Equal(x, SetPack(std::numeric_limits<float>::infinity()));
+
+    x = Max(SetPack(std::numeric_limits<float>::min()), x);
+
+    //x = m * 2^e with m in [sqrt(0.5), sqrt(2))
+    PackInt bits = CastToInt(x);
+    Pack e       = ConvertToFloat(SubInt(ShiftRightInt<23>(bits), SetPackInt(126)));
+    Pack m       = Or(CastToFloat(AndInt(bits, SetPackInt(0x007FFFFF))), SetPack(0.5f));
+
+    Pack small = Less(m, SetPack(0.707106781186547524f));
+    e          = Sub(e, And(small, SetPack(1.0f)));
+    m          = Sub(Add(m, And(small, m)), SetPack(1.0f));
+
+    Pack z = Mul(m, m);
+    Pack p;
+
+    if constexpr (Fast)
+    {
+        p = MulAdd(m, SetPack(-1.470231134759933e-1f), SetPack(2.1924192741165752e-1f));
+        p = MulAdd(p, m, SetPack(-2.5252143543239935e-1f));
+        p = MulAdd(p, m, SetPack(3.327250613112235e-1f));
+    }
+    else
+    {
+        p = MulAdd(m, SetPack(7.0376836292e-2f), SetPack(-1.1514610310e-1f));
+        p = MulAdd(p, m, SetPack(1.1676998740e-1f));
+        p = MulAdd(p, m, SetPack(-1.2420140846e-1f));
+        p = MulAdd(p, m, SetPack(1.4249322787e-1f));
+        p = MulAdd(p, m, SetPack(-1.6668057665e-1f));
+        p = MulAdd(p, m, SetPack(2.0000714765e-1f));
+        p = MulAdd(p, m, SetPack(-2.4999993993e-1f));
+        p = MulAdd(p, m, SetPack(3.3333331174e-1f));
+    }
+
+    //log(1 + m) = m - m^2 / 2 + m^3 * p, e * ln(2) is added in two parts
+    Pack y = Mul(Mul(p, m), z);
+    y      = MulAdd(e, SetPack(-2.12194440e-4f), y);
+    y      = MulAdd(z, SetPack(-0.5f), y);
+    y      = MulAdd(e, SetPack(0.693359375f), Add(m, y));
+
+    y = Select(infinite, SetPack(std::numeric_limits<float>::infinity()), y);
+    y = Select(zero, SetPack(-std::numeric_limits<float>::infinity()), y);
+    return Select(valid, y, SetPack(std::numeric_limits<float>::quiet_NaN()));
+}
+
+//atan2(y, x) in [-pi, pi] with the quadrant conventions of std::atan2 (signed
+//zeros included, both infinite is not handled). Max absolute error ~2e-7
+//(accurate) and ~6e-6 (fast)
+template<bool Fast>
+inline Pack Atan2(Pack y, Pack x)
+{
+    const Pack signMask = SetPack(-0.0f);
+
+    Pack ax = AndNot(signMask, x);
+    Pack ay = AndNot(signMask, y);
+
+    //atan of t = min / max in [0, 1], moved around pi / 4 above tan(pi / 8)
+    Pack steep = Less(ax, ay);
+    Pack lo    = Min(ax, ay);
+    Pack hi    = Max(ax, ay);
+    Pack t     = AndNot(Equal(hi, ZeroPack()), Div(lo, hi));
+
+    Pack mid    = Less(SetPack(0.414213562373095f), t);
+    t           = Select(mid, Div(Sub(t, SetPack(1.0f)), Add(t, SetPack(1.0f))), t);
+    Pack offset = And(mid, SetPack(0.785398163397448f));
+
+    Pack z = Mul(t, t);
+    Pack p;
+
+    if constexpr (Fast)
+    {
+        p = MulAdd(z, SetPack(1.6856890486407375e-1f), SetPack(-3.3156864081260173e-1f));
+    }
+    else
+    {
+        p = MulAdd(z, SetPack(8.05374449538e-2f), SetPack(-1.38776856032e-1f));
+        p = MulAdd(p, z, SetPack(1.99777106478e-1f));
+        p = MulAdd(p, z, SetPack(-3.33329491539e-1f));
+    }
+
+    Pack angle = Add(MulAdd(Mul(p, z), t, t), offset);
+
+    //Unfold the octant, then the half plane from the sign of x and finally the
+    //sign of y
+    Pack negativeX = CastToFloat(EqualInt(CastToInt(And(x, signMask)), CastToInt(signMask)));
+
+    angle = Select(steep, Sub(SetPack(1.57079632679489662f), angle), angle);
+    angle = Select(negativeX, Sub(SetPack(3.14159265358979324f), angle), angle);
+    return Or(angle, And(y, signMask));
+}
+
+//base^exponent as e^(exponent * log(base)). Negative bases give NaN and x^0 is
+//1 for every x. The relative error grows with |exponent * log(base)|, ~1e-6 for
+//results in [1e-4, 1e4] on the accurate path
+template<bool Fast>
+inline Pack Pow(Pack base, Pack exponent)
+{
+    Pack result = Exp<Fast>(Mul(exponent, Log<Fast>(base)));
+    return Select(Equal(exponent, ZeroPack()), SetPack(1.0f), result);
+}
+
+//! Array kernels
+template<typename F>
+inline std::size_t TransformArray(const float* input, float* output, std::size_t count, F function)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        StorePackUnaligned(output + i, function(LoadPackUnaligned(input + i)));
+    }
+
+    return i;
+}
+
+template<typename F>
+inline std::size_t TransformArray(const float* a, const float* b, float* output, std::size_t count, F function)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        StorePackUnaligned(output + i, function(LoadPackUnaligned(a + i), LoadPackUnaligned(b + i)));
+    }
+
+    return i;
+}
+
+template<bool Fast>
+inline std::size_t Sin(const float* input, float* output, std::size_t count)
+{
+    return TransformArray(input, output, count, [](Pack x) { return Sin<Fast>(x); });
+}
+
+template<bool Fast>
+inline std::size_t Cos(const float* input, float* output, std::size_t count)
+{
+    return TransformArray(input, output, count, [](Pack x) { return Cos<Fast>(x); });
+}
+
+template<bool Fast>
+inline std::size_t SinCos(const float* input, float* sin, float* cos, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for(; i + PackWidth <= count; i += PackWidth)
+    {
+        Pack s, c;
+        SinCos<Fast>(LoadPackUnaligned(input + i), s, c);
+
+        StorePackUnaligned(sin + i, s);
+        StorePackUnaligned(cos + i, c);
+    }
+
+    return i;
+}
+
+template<bool Fast>
+inline std::size_t Exp(const float* input, float* output, std::size_t count)
+{
+    return TransformArray(input, output, count, [](Pack x) { return Exp<Fast>(x); });
+}
+
+template<bool Fast>
+inline std::size_t Log(const float* input, float* output, std::size_t count)
+{
+    return TransformArray(input, output, count, [](Pack x) { return Log<Fast>(x); });
+}
+
+template<bool Fast>
+inline std::size_t Atan2(const float* y, const float* x, float* output, std::size_t count)
+{
+    return TransformArray(y, x, output, count, [](Pack a, Pack b) { return Atan2<Fast>(a, b); });
+}
+
+template<bool Fast>
+inline std::size_t Pow(const float* base, const float* exponent, float* output, std::size_t count)
+{
+    return TransformArray(base, exponent, output, count, [](Pack a, Pack b) { return Pow<Fast>(a, b); });
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,168 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Simd.hpp"
+
+//SIMD kernels that transform packed float3/float4 buffers by a column based
+//4x4 float matrix. They return the number of elements processed so the caller
+//can finish the tail with scalar code
+namespace math::simd
+{
+
+#if MATH_SIMD_SSE
+
+//Transforms float3 elements with an implicit w of 1 (Translate = true)
+//or 0 (Translate = false)
+template<bool Translate>
+inline std::size_t TransformVec3(const float* m, const float* in, float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if MATH_SIMD_AVX2
+    //8 elements per iteration, the low lane holds elements 0-3 and the high lane 4-7
+    __m256 m0  = _mm256_set1_ps(m[0]),  m1  = _mm256_set1_ps(m[1]),  m2  = _mm256_set1_ps(m[2]);
+    __m256 m4  = _mm256_set1_ps(m[4]),  m5  = _mm256_set1_ps(m[5]),  m6  = _mm256_set1_ps(m[6]);
+    __m256 m8  = _mm256_set1_ps(m[8]),  m9  = _mm256_set1_ps(m[9]),  m10 = _mm256_set1_ps(m[10]);
+    __m256 m12 = _mm256_set1_ps(m[12]), m13 = _mm256_set1_ps(m[13]), m14 = _mm256_set1_ps(m[14]);
+
+    for(; i + 8 <= count; i += 8)
+    {
+        const float* src = in + i * 3;
+        float* dst       = out + i * 3;
+
+        __m256 v0 = _mm256_loadu2_m128(src + 12, src);
+        __m256 v1 = _mm256_loadu2_m128(src + 16, src + 4);
+        __m256 v2 = _mm256_loadu2_m128(src + 20, src + 8);
+        __m256 x, y, z;
+        Deinterleave3(v0, v1, v2, x, y, z);
+
+        __m256 rx = Translate ? MulAdd(m0, x, m12) : _mm256_mul_ps(m0, x);
+        __m256 ry = Translate ? MulAdd(m1, x, m13) : _mm256_mul_ps(m1, x);
+        __m256 rz = Translate ? MulAdd(m2, x, m14) : _mm256_mul_ps(m2, x);
+        rx = MulAdd(m8, z, MulAdd(m4, y, rx));
+        ry = MulAdd(m9, z, MulAdd(m5, y, ry));
+        rz = MulAdd(m10, z, MulAdd(m6, y, rz));
+
+        Interleave3(rx, ry, rz, v0, v1, v2);
+        _mm256_storeu2_m128(dst + 12, dst, v0);
+        _mm256_storeu2_m128(dst + 16, dst + 4, v1);
+        _mm256_storeu2_m128(dst + 20, dst + 8, v2);
+    }
+#endif
+
+    __m128 n0  = _mm_set1_ps(m[0]),  n1  = _mm_set1_ps(m[1]),  n2  = _mm_set1_ps(m[2]);
+    __m128 n4  = _mm_set1_ps(m[4]),  n5  = _mm_set1_ps(m[5]),  n6  = _mm_set1_ps(m[6]);
+    __m128 n8  = _mm_set1_ps(m[8]),  n9  = _mm_set1_ps(m[9]),  n10 = _mm_set1_ps(m[10]);
+    __m128 n12 = _mm_set1_ps(m[12]), n13 = _mm_set1_ps(m[13]), n14 = _mm_set1_ps(m[14]);
+
+    for(; i + 4 <= count; i += 4)
+    {
+        const float* src = in + i * 3;
+        float* dst       = out + i * 3;
+
+        __m128 v0 = _mm_loadu_ps(src);
+        __m128 v1 = _mm_loadu_ps(src + 4);
+        __m128 v2 = _mm_loadu_ps(src + 8);
+        __m128 x, y, z;
+        Deinterleave3(v0, v1, v2, x, y, z);
+
+        __m128 rx = Translate ? MulAdd(n0, x, n12) : _mm_mul_ps(n0, x);
+        __m128 ry = Translate ? MulAdd(n1, x, n13) : _mm_mul_ps(n1, x);
+        __m128 rz = Translate ? MulAdd(n2, x, n14) : _mm_mul_ps(n2, x);
+        rx = MulAdd(n8, z, MulAdd(n4, y, rx));
+        ry = MulAdd(n9, z, MulAdd(n5, y, ry));
+        rz = MulAdd(n10, z, MulAdd(n6, y, rz));
+
+        Interleave3(rx, ry, rz, v0, v1, v2);
+        _mm_storeu_ps(dst, v0);
+        _mm_storeu_ps(dst + 4, v1);
+        _mm_storeu_ps(dst + 8, v2);
+    }
+
+    return i;
+}
+
+template<bool Aligned>
+inline std::size_t TransformVec4Impl(const float* m, const float* in, float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if MATH_SIMD_AVX2
+    //2 elements per register
+    __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m));
+    __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 4));
+    __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 8));
+    __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 12));
+
+    for(; i + 4 <= count; i += 4)
+    {
+        __m256 v01 = Aligned ? _mm256_load_ps(in + i * 4)     : _mm256_loadu_ps(in + i * 4);
+        __m256 v23 = Aligned ? _mm256_load_ps(in + i * 4 + 8) : _mm256_loadu_ps(in + i * 4 + 8);
+
+        __m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v01, v01, MATH_SHUFFLE_MASK(0, 0, 0, 0)));
+        __m256 r23 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v23, v23, MATH_SHUFFLE_MASK(0, 0, 0, 0)));
+        r01 = MulAdd(c1, _mm256_shuffle_ps(v01, v01, MATH_SHUFFLE_MASK(1, 1, 1, 1)), r01);
+        r23 = MulAdd(c1, _mm256_shuffle_ps(v23, v23, MATH_SHUFFLE_MASK(1, 1, 1, 1)), r23);
+        r01 = MulAdd(c2, _mm256_shuffle_ps(v01, v01, MATH_SHUFFLE_MASK(2, 2, 2, 2)), r01);
+        r23 = MulAdd(c2, _mm256_shuffle_ps(v23, v23, MATH_SHUFFLE_MASK(2, 2, 2, 2)), r23);
+        r01 = MulAdd(c3, _mm256_shuffle_ps(v01, v01, MATH_SHUFFLE_MASK(3, 3, 3, 3)), r01);
+        r23 = MulAdd(c3, _mm256_shuffle_ps(v23, v23, MATH_SHUFFLE_MASK(3, 3, 3, 3)), r23);
+
+        if constexpr (Aligned)
+        {
+            _mm256_store_ps(out + i * 4, r01);
+            _mm256_store_ps(out + i * 4 + 8, r23);
+        }
+        else
+        {
+            _mm256_storeu_ps(out + i * 4, r01);
+            _mm256_storeu_ps(out + i * 4 + 8, r23);
+        }
+    }
+#endif
+
+    __m128 n0 = _mm_loadu_ps(m);
+    __m128 n1 = _mm_loadu_ps(m + 4);
+    __m128 n2 = _mm_loadu_ps(m + 8);
+    __m128 n3 = _mm_loadu_ps(m + 12);
+
+    for(; i < count; ++i)
+    {
+        __m128 v = Aligned ? _mm_load_ps(in + i * 4) : _mm_loadu_ps(in + i * 4);
+        __m128 r = _mm_mul_ps(n0, Splat<0>(v));
+        r = MulAdd(n1, Splat<1>(v), r);
+        r = MulAdd(n2, Splat<2>(v), r);
+        r = MulAdd(n3, Splat<3>(v), r);
+
+        if constexpr (Aligned)
+        {
+            _mm_store_ps(out + i * 4, r);
+        }
+        else
+        {
+            _mm_storeu_ps(out + i * 4, r);
+        }
+    }
+
+    return i;
+}
+
+//Transforms float4 elements. Takes the aligned path when both buffers are
+//aligned to the register width
+inline std::size_t TransformVec4(const float* m, const float* in, float* out, std::size_t count)
+{
+#if MATH_SIMD_AVX2
+    constexpr std::uintptr_t alignment = 32;
+#else
+    constexpr std::uintptr_t alignment = 16;
+#endif
+
+    if(((reinterpret_cast<std::uintptr_t>(in) | reinterpret_cast<std::uintptr_t>(out)) & (alignment - 1)) == 0)
+        return TransformVec4Impl<true>(m, in, out, count);
+
+    return TransformVec4Impl<false>(m, in, out, count);
+}
+
+#endif
+
+} //namespace math::simd
@@ -0,0 +1,52 @@
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include "../vector/Vector2.hpp"
+#include "../vector/Vector3.hpp"
+#include "../geometry/AABB.hpp"
+
+namespace math
+{
+
+template<typename Key>
+concept MortonKeyConcept = std::same_as<Key, uint32_t> || std::same_as<Key, uint64_t>;
+
+//Bits per axis of a Morton key, 16 and 10 for 32 bit keys, 32 and 21 for 64 bit keys
+template<MortonKeyConcept Key>
+constexpr int32_t MortonBits2 = sizeof(Key) * 4;
+template<MortonKeyConcept Key>
+constexpr int32_t MortonBits3 = sizeof(Key) * 8 / 3;
+
+//! Scalar
+//Interleaves the low MortonBits bits of every coordinate, x in the lowest
+//bit. Sorting by key walks the grid along a Z-order curve. Uses pdep/pext
+//when compiled with BMI2 and shifts and masks otherwise
+template<MortonKeyConcept Key = uint32_t>
+constexpr Key EncodeMorton2(uint32_t x, uint32_t y);
+template<MortonKeyConcept Key = uint32_t>
+constexpr Key EncodeMorton3(uint32_t x, uint32_t y, uint32_t z);
+template<MortonKeyConcept Key>
+constexpr Vector2<uint32_t> DecodeMorton2(Key key);
+template<MortonKeyConcept Key>
+constexpr Vector3<uint32_t> DecodeMorton3(Key key);
+
+//! Batched
+//Positions are quantised to the 2^MortonBits cells per axis of the bounds
+//and clamped to them. 32 bit keys are encoded 4 (SSE) or 8 (AVX2) at a time.
+//The output span must be at least as big as the input span
+template<MortonKeyConcept Key>
+void EncodeMorton(std::span<const Vector2<float>> positions, const Vector2<float>& min, const Vector2<float>& max,
+    std::span<Key> keys);
+template<MortonKeyConcept Key>
+void EncodeMorton(std::span<const Vector3<float>> positions, const AABB<float>& bounds, std::span<Key> keys);
+//Centers of the cells of the keys
+template<MortonKeyConcept Key>
+void DecodeMorton(std::span<const Key> keys, const Vector2<float>& min, const Vector2<float>& max,
+    std::span<Vector2<float>> positions);
+template<MortonKeyConcept Key>
+void DecodeMorton(std::span<const Key> keys, const AABB<float>& bounds, std::span<Vector3<float>> positions);
+
+} //namespace math
+
+#include "Morton.inl"
@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include "../simd/MortonSimd.hpp"
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace math
+{
+
+namespace detail
+{
+
+//! Bit interleaving, the same steps as simd/MortonSimd.hpp
+template<typename Key>
+constexpr Key SpreadBits2(Key v)
+{
+    if constexpr (sizeof(Key) == 4)
+    {
+        v &= 0x0000FFFFu;
+        v  = (v | (v << 8)) & 0x00FF00FFu;
+        v  = (v | (v << 4)) & 0x0F0F0F0Fu;
+        v  = (v | (v << 2)) & 0x33333333u;
+        return (v | (v << 1)) & 0x55555555u;
+    }
+    else
+    {
+        v &= 0x00000000FFFFFFFFull;
+        v  = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+        v  = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+        v  = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        v  = (v | (v << 2)) & 0x3333333333333333ull;
+        return (v | (v << 1)) & 0x5555555555555555ull;
+    }
+}
+
+template<typename Key>
+constexpr Key SpreadBits3(Key v)
+{
+    if constexpr (sizeof(Key) == 4)
+    {
+        v &= 0x000003FFu;
+        v  = (v | (v << 16)) & 0x030000FFu;
+        v  = (v | (v << 8)) & 0x0300F00Fu;
+        v  = (v | (v << 4)) & 0x030C30C3u;
+        return (v | (v << 2)) & 0x09249249u;
+    }
+    else
+    {
+        v &= 0x00000000001FFFFFull;
+        v  = (v | (v << 32)) & 0x001F00000000FFFFull;
+        v  = (v | (v << 16)) & 0x001F0000FF0000FFull;
+        v  = (v | (v << 8)) & 0x100F00F00F00F00Full;
+        v  = (v | (v << 4)) & 0x10C30C30C30C30C3ull;
+        return (v | (v << 2)) & 0x1249249249249249ull;
+    }
+}
+
+template<typename Key>
+constexpr Key CompactBits2(Key v)
+{
+    if constexpr (sizeof(Key) == 4)
+    {
+        v &= 0x55555555u;
+        v  = (v | (v >> 1)) & 0x33333333u;
+        v  = (v | (v >> 2)) & 0x0F0F0F0Fu;
+        v  = (v | (v >> 4)) & 0x00FF00FFu;
+        return (v | (v >> 8)) & 0x0000FFFFu;
+    }
+    else
+    {
+        v &= 0x5555555555555555ull;
+        v  = (v | (v >> 1)) & 0x3333333333333333ull;
+        v  = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+        v  = (v | (v >> 4)) & 0x00FF00FF00FF00FFull;
+        v  = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+        return (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+    }
+}
+
+template<typename Key>
+constexpr Key CompactBits3(Key v)
+{
+    if constexpr (sizeof(Key) == 4)
+    {
+        v &= 0x09249249u;
+        v  = (v | (v >> 2)) & 0x030C30C3u;
+        v  = (v | (v >> 4)) & 0x0300F00Fu;
+        v  = (v | (v >> 8)) & 0x030000FFu;
+        return (v | (v >> 16)) & 0x000003FFu;
+    }
+    else
+    {
+        v &= 0x1249249249249249ull;
+        v  = (v | (v >> 2)) & 0x10C30C30C30C30C3ull;
+        v  = (v | (v >> 4)) & 0x100F00F00F00F00Full;
+        v  = (v | (v >> 8)) & 0x001F0000FF0000FFull;
+        v  = (v | (v >> 16)) & 0x001F00000000FFFFull;
+        return (v | (v >> 32)) & 0x00000000001FFFFFull;
+    }
+}
+
+#if defined(__BMI2__)
+template<typename Key>
+inline Key DepositBits(Key v, Key mask)
+{
+    if constexpr (sizeof(Key) == 4)
+    {
+        return _pdep_u32(v, mask);
+    }
+    else
+    {
+        return _pdep_u64(v, mask);
+    }
+}
+
+template<typename Key>
+inline Key ExtractBits(Key v, Key mask)
+{
+    if constexpr (sizeof(Key) == 4)
+    {
+        return _pext_u32(v, mask);
+    }
+    else
+    {
+        return _pext_u64(v, mask);
+    }
+}
+#endif
+
+//Bits of x in a 2D and 3D key
+template<typename Key>
+constexpr Key MortonMask2 = static_cast<Key>(0x5555555555555555ull);
+template<typename Key>
+constexpr Key MortonMask3 = static_cast<Key>(sizeof(Key) == 4 ? 0x09249249ull : 0x1249249249249249ull);
+
+//! Quantisation
+//64 bit keys have up to 32 bits per axis, more than a float holds
+template<typename Key>
+using MortonReal = std::conditional_t<sizeof(Key) == 4, float, double>;
+
+template<typename Key>
+struct MortonGrid
+{
+    MortonReal<Key> min[3];
+    MortonReal<Key> scale[3];
+    MortonReal<Key> cellSize[3];
+};
+
+template<typename Key, int32_t Bits>
+MortonGrid<Key> CreateMortonGrid(const float* min, const float* max, int32_t axes)
+{
+    using Real = MortonReal<Key>;
+    Real cells = static_cast<Real>(uint64_t{1} << Bits);
+
+    MortonGrid<Key> grid {};
+    for(int32_t axis = 0; axis < axes; ++axis)
+    {
+        Real extent          = static_cast<Real>(max[axis]) - static_cast<Real>(min[axis]);
+        grid.min[axis]       = static_cast<Real>(min[axis]);
+        grid.scale[axis]     = extent > 0 ? cells / extent : 0;
+        grid.cellSize[axis]  = extent > 0 ? extent / cells : 0;
+    }
+    return grid;
+}
+
+//Like simd::QuantiseMorton, NaN gives cell 0
+template<typename Key, int32_t Bits>
+uint32_t QuantiseMorton(float v, const MortonGrid<Key>& grid, int32_t axis)
+{
+    using Real = MortonReal<Key>;
+    constexpr Real MaxCell = static_cast<Real>((uint64_t{1} << Bits) - 1);
+
+    Real cell = (static_cast<Real>(v) - grid.min[axis]) * grid.scale[axis];
+    return static_cast<uint32_t>(std::min(std::max(Real{0}, cell), MaxCell));
+}
+
+template<typename Key>
+float CellCenter(uint32_t cell, const MortonGrid<Key>& grid, int32_t axis)
+{
+    using Real = MortonReal<Key>;
+    return static_cast<float>((static_cast<Real>(cell) + static_cast<Real>(0.5)) * grid.cellSize[axis] + grid.min[axis]);
+}
+
+} //namespace detail
+
+//! Scalar
+template<MortonKeyConcept Key>
+constexpr Key EncodeMorton2(uint32_t x, uint32_t y)
+{
+#if defined(__BMI2__)
+    if !consteval
+    {
+        return detail::DepositBits<Key>(x, detail::MortonMask2<Key>) |
+            detail::DepositBits<Key>(y, detail::MortonMask2<Key> << 1);
+    }
+#endif
+    return detail::SpreadBits2<Key>(x) | (detail::SpreadBits2<Key>(y) << 1);
+}
+
+template<MortonKeyConcept Key>
+constexpr Key EncodeMorton3(uint32_t x, uint32_t y, uint32_t z)
+{
+#if defined(__BMI2__)
+    if !consteval
+    {
+        return detail::DepositBits<Key>(x, detail::MortonMask3<Key>) |
+            detail::DepositBits<Key>(y, detail::MortonMask3<Key> << 1) |
+            detail::DepositBits<Key>(z, detail::MortonMask3<Key> << 2);
+    }
+#endif
+    return detail::SpreadBits3<Key>(x) | (detail::SpreadBits3<Key>(y) << 1) | (detail::SpreadBits3<Key>(z) << 2);
+}
+
+template<MortonKeyConcept Key>
+constexpr Vector2<uint32_t> DecodeMorton2(Key key)
+{
+#if defined(__BMI2__)
+    if !consteval
+    {
+        return Vector2<uint32_t>(static_cast<uint32_t>(detail::ExtractBits<Key>(key, detail::MortonMask2<Key>)),
+            static_cast<uint32_t>(detail::ExtractBits<Key>(key, detail::MortonMask2<Key> << 1)));
+    }
+#endif
+    return Vector2<uint32_t>(static_cast<uint32_t>(detail::CompactBits2<Key>(key)),
+        static_cast<uint32_t>(detail::CompactBits2<Key>(key >> 1)));
+}
+
+template<MortonKeyConcept Key>
+constexpr Vector3<uint32_t> DecodeMorton3(Key key)
+{
+#if defined(__BMI2__)
+    if !consteval
+    {
+        return Vector3<uint32_t>(static_cast<uint32_t>(detail::ExtractBits<Key>(key, detail::MortonMask3<Key>)),
+            static_cast<uint32_t>(detail::ExtractBits<Key>(key, detail::MortonMask3<Key> << 1)),
+            static_cast<uint32_t>(detail::ExtractBits<Key>(key, detail::MortonMask3<Key> << 2)));
+    }
+#endif
+    return Vector3<uint32_t>(static_cast<uint32_t>(detail::CompactBits3<Key>(key)),
+        static_cast<uint32_t>(detail::CompactBits3<Key>(key >> 1)),
+        static_cast<uint32_t>(detail::CompactBits3<Key>(key >> 2)));
+}
+
+//! Batched
+template<MortonKeyConcept Key>
+void EncodeMorton(std::span<const Vector2<float>> positions, const Vector2<float>& min, const Vector2<float>& max,
+    std::span<Key> keys)
+{
+    assert(keys.size() >= positions.size());
+
+    constexpr int32_t Bits = MortonBits2<Key>;
+    auto grid = detail::CreateMortonGrid<Key, Bits>(&min.x, &max.x, 2);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<Key, uint32_t>)
+    {
+        i = simd::EncodeMorton2(reinterpret_cast<const float*>(positions.data()), keys.data(), positions.size(),
+            grid.min, grid.scale);
+    }
+#endif
+
+    for(; i < positions.size(); ++i)
+    {
+        keys[i] = EncodeMorton2<Key>(detail::QuantiseMorton<Key, Bits>(positions[i].x, grid, 0),
+            detail::QuantiseMorton<Key, Bits>(positions[i].y, grid, 1));
+    }
+}
+
+template<MortonKeyConcept Key>
+void EncodeMorton(std::span<const Vector3<float>> positions, const AABB<float>& bounds, std::span<Key> keys)
+{
+    assert(keys.size() >= positions.size());
+
+    constexpr int32_t Bits = MortonBits3<Key>;
+    auto grid = detail::CreateMortonGrid<Key, Bits>(&bounds.min.x, &bounds.max.x, 3);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<Key, uint32_t>)
+    {
+        i = simd::EncodeMorton3(reinterpret_cast<const float*>(positions.data()), keys.data(), positions.size(),
+            grid.min, grid.scale);
+    }
+#endif
+
+    for(; i < positions.size(); ++i)
+    {
+        keys[i] = EncodeMorton3<Key>(detail::QuantiseMorton<Key, Bits>(positions[i].x, grid, 0),
+            detail::QuantiseMorton<Key, Bits>(positions[i].y, grid, 1),
+            detail::QuantiseMorton<Key, Bits>(positions[i].z, grid, 2));
+    }
+}
+
+template<MortonKeyConcept Key>
+void DecodeMorton(std::span<const Key> keys, const Vector2<float>& min, const Vector2<float>& max,
+    std::span<Vector2<float>> positions)
+{
+    assert(positions.size() >= keys.size());
+
+    auto grid = detail::CreateMortonGrid<Key, MortonBits2<Key>>(&min.x, &max.x, 2);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<Key, uint32_t>)
+    {
+        i = simd::DecodeMorton2(keys.data(), reinterpret_cast<float*>(positions.data()), keys.size(), grid.min,
+            grid.cellSize);
+    }
+#endif
+
+    for(; i < keys.size(); ++i)
+    {
+        Vector2<uint32_t> cell = DecodeMorton2(keys[i]);
+        positions[i]           = Vector2<float>(detail::CellCenter(cell.x, grid, 0), detail::CellCenter(cell.y, grid, 1));
+    }
+}
+
+template<MortonKeyConcept Key>
+void DecodeMorton(std::span<const Key> keys, const AABB<float>& bounds, std::span<Vector3<float>> positions)
+{
+    assert(positions.size() >= keys.size());
+
+    auto grid = detail::CreateMortonGrid<Key, MortonBits3<Key>>(&bounds.min.x, &bounds.max.x, 3);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<Key, uint32_t>)
+    {
+        i = simd::DecodeMorton3(keys.data(), reinterpret_cast<float*>(positions.data()), keys.size(), grid.min,
+            grid.cellSize);
+    }
+#endif
+
+    for(; i < keys.size(); ++i)
+    {
+        Vector3<uint32_t> cell = DecodeMorton3(keys[i]);
+        positions[i]           = Vector3<float>(detail::CellCenter(cell.x, grid, 0), detail::CellCenter(cell.y, grid, 1),
+            detail::CellCenter(cell.z, grid, 2));
+    }
+}
+
+} //namespace math
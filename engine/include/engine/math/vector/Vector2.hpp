@@ -48,6 +48,8 @@ public:
     constexpr T       Cross2D(const Vector2 other) const;
     constexpr Vector2 GetNormalized() const;
     constexpr Vector2 GetSafeNormalized() const;
+    //Rsqrt based, max relative error ~5e-7 for float
+    constexpr Vector2 GetFastNormalized() const;
     constexpr Vector2 GetReflected(const Vector2 normal) const;
     constexpr Vector2 GetRotated(T radians) const;
 
@@ -1,4 +1,5 @@
 #include <cmath>
+#include "../Functions.hpp"
 
 namespace math
 {
@@ -160,7 +161,7 @@ constexpr T Vector2<T>::Dot(const Vector2<T> other) const
 template<typename T>
 constexpr T Vector2<T>::Length() const
 {
-    return std::sqrt(x * x + y * y);
+    return Sqrt(x * x + y * y);
 }
 
 template<typename T>
@@ -178,7 +179,15 @@ constexpr T Vector2<T>::Cross2D(const Vector2 other) const
 template<typename T>
 constexpr Vector2<T> Vector2<T>::GetNormalized() const
 {
-    T invL = 1 / std::sqrt(x * x + y * y);
+    T invL = 1 / Sqrt(x * x + y * y);
+
+    return Vector2(x * invL, y * invL);
+}
+
+template<typename T>
+constexpr Vector2<T> Vector2<T>::GetFastNormalized() const
+{
+    T invL = FastInvSqrt(x * x + y * y);
 
     return Vector2(x * invL, y * invL);
 }
@@ -186,7 +195,7 @@ constexpr Vector2<T> Vector2<T>::GetNormalized() const
 template<typename T>
 constexpr Vector2<T> Vector2<T>::GetSafeNormalized() const
 {
-    T l = std::sqrt(x * x + y * y);
+    T l = Sqrt(x * x + y * y);
 
     if(l != 0)
     {
@@ -209,10 +218,10 @@ constexpr Vector2<T> Vector2<T>::GetReflected(const Vector2<T> normal) const
 template<typename T>
 constexpr Vector2<T> Vector2<T>::GetRotated(T radians) const
 {
-    T cos = std::cos(radians);
-    T sin = std::sin(radians);
+    T cos = Cos(radians);
+    T sin = Sin(radians);
 
-    return Vector2(x + cos - y * sin, 
+    return Vector2(x * cos - y * sin, 
                    x * sin + y * cos);
 }
 
@@ -44,6 +44,8 @@ public:
     constexpr Vector3 Cross(const Vector3& other) const;
     constexpr Vector3 GetNormalized() const;
     constexpr Vector3 GetSafeNormalized() const;
+    //Rsqrt based, max relative error ~5e-7 for float
+    constexpr Vector3 GetFastNormalized() const;
     constexpr Vector3 GetReflected(const Vector3& normal) const;
 
 public:
@@ -1,4 +1,5 @@
 #include <cmath>
+#include "../Functions.hpp"
 
 namespace math
 {
@@ -171,7 +172,7 @@ constexpr T Vector3<T>::Dot(const Vector3<T>& other) const
 template<typename T>
 constexpr T Vector3<T>::Length() const
 {
-    return std::sqrt(x * x + y * y + z * z);
+    return Sqrt(x * x + y * y + z * z);
 }
 
 template<typename T>
@@ -191,7 +192,15 @@ constexpr Vector3<T> Vector3<T>::Cross(const Vector3& other) const
 template<typename T>
 constexpr Vector3<T> Vector3<T>::GetNormalized() const
 {
-    T invL = 1 / std::sqrt(x * x + y * y + z * z);
+    T invL = 1 / Sqrt(x * x + y * y + z * z);
+
+    return Vector3(x * invL, y * invL, z * invL);
+}
+
+template<typename T>
+constexpr Vector3<T> Vector3<T>::GetFastNormalized() const
+{
+    T invL = FastInvSqrt(x * x + y * y + z * z);
 
     return Vector3(x * invL, y * invL, z * invL);
 }
@@ -199,7 +208,7 @@ constexpr Vector3<T> Vector3<T>::GetNormalized() const
 template<typename T>
 constexpr Vector3<T> Vector3<T>::GetSafeNormalized() const
 {
-    T l = std::sqrt(x * x + y * y + z * z);
+    T l = Sqrt(x * x + y * y + z * z);
 
     if(l != 0)
     {
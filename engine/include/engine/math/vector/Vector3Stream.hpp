@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "Vector3.hpp"
+#include "../simd/AlignedAllocator.hpp"
+
+namespace math
+{
+
+//Structure of arrays storage for Vector3. Every component array is aligned
+//and padded to the SIMD width so the bulk operations run without tails.
+//Element wise operations between streams require both to have the same size
+template<typename T>
+struct Vector3Stream
+{
+public:
+    using Type  = T;
+    using Array = std::vector<T, simd::AlignedAllocator<T>>;
+    constexpr static std::size_t Width = simd::DefaultAlignment / sizeof(T);
+
+    //! Constructors
+    Vector3Stream();
+    explicit Vector3Stream(std::size_t size);
+    explicit Vector3Stream(std::span<const Vector3<T>> values);
+
+    //! Operators
+    Vector3Stream& operator+=(const Vector3Stream& other);
+    Vector3Stream& operator-=(const Vector3Stream& other);
+    Vector3Stream& operator*=(const T value);
+    Vector3Stream& operator*=(const Vector3Stream& other);
+
+    //! Accessors
+    std::size_t Size() const;
+    std::size_t PaddedSize() const;
+    void        Resize(std::size_t size);
+    Vector3<T>  Get(std::size_t index) const;
+    void        Set(std::size_t index, const Vector3<T>& v);
+    void        Gather(std::span<const Vector3<T>> values);
+    void        Scatter(std::span<Vector3<T>> values) const;
+
+    //! Operations
+    //Output spans must hold at least Size() elements
+    void Dot(const Vector3Stream& other, std::span<T> output) const;
+    void Length(std::span<T> output) const;
+    void LengthSquared(std::span<T> output) const;
+    void Cross(const Vector3Stream& other, Vector3Stream& output) const;
+    void MulAdd(const Vector3Stream& other, T value);
+    void Normalize();
+    void SafeNormalize();
+
+public:
+    Array x, y, z;
+
+private:
+    std::size_t m_size;
+};
+
+template struct Vector3Stream<float>;
+template struct Vector3Stream<double>;
+
+using Vec3Stream  = Vector3Stream<float>;
+using Vec3dStream = Vector3Stream<double>;
+
+} //namespace math
+
+#include "Vector3Stream.inl"
@@ -0,0 +1,280 @@
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include "../simd/StreamSimd.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+Vector3Stream<T>::Vector3Stream() : x{}, y{}, z{}, m_size{0} { }
+
+template<typename T>
+Vector3Stream<T>::Vector3Stream(std::size_t size) : x{}, y{}, z{}, m_size{0}
+{
+    Resize(size);
+}
+
+template<typename T>
+Vector3Stream<T>::Vector3Stream(std::span<const Vector3<T>> values) : x{}, y{}, z{}, m_size{0}
+{
+    Gather(values);
+}
+
+//! Operators
+template<typename T>
+Vector3Stream<T>& Vector3Stream<T>::operator+=(const Vector3Stream<T>& other)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] += other.x[i];
+        y[i] += other.y[i];
+        z[i] += other.z[i];
+    }
+
+    return *this;
+}
+
+template<typename T>
+Vector3Stream<T>& Vector3Stream<T>::operator-=(const Vector3Stream<T>& other)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] -= other.x[i];
+        y[i] -= other.y[i];
+        z[i] -= other.z[i];
+    }
+
+    return *this;
+}
+
+template<typename T>
+Vector3Stream<T>& Vector3Stream<T>::operator*=(const T value)
+{
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] *= value;
+        y[i] *= value;
+        z[i] *= value;
+    }
+
+    return *this;
+}
+
+template<typename T>
+Vector3Stream<T>& Vector3Stream<T>::operator*=(const Vector3Stream<T>& other)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] *= other.x[i];
+        y[i] *= other.y[i];
+        z[i] *= other.z[i];
+    }
+
+    return *this;
+}
+
+//! Accessors
+template<typename T>
+std::size_t Vector3Stream<T>::Size() const
+{
+    return m_size;
+}
+
+template<typename T>
+std::size_t Vector3Stream<T>::PaddedSize() const
+{
+    return x.size();
+}
+
+template<typename T>
+void Vector3Stream<T>::Resize(std::size_t size)
+{
+    std::size_t padded = (size + Width - 1) / Width * Width;
+
+    x.resize(padded);
+    y.resize(padded);
+    z.resize(padded);
+
+    //Keep the padding zeroed
+    for(std::size_t i = size; i < padded; ++i)
+    {
+        x[i] = 0;
+        y[i] = 0;
+        z[i] = 0;
+    }
+
+    m_size = size;
+}
+
+template<typename T>
+Vector3<T> Vector3Stream<T>::Get(std::size_t index) const
+{
+    return Vector3<T>(x[index], y[index], z[index]);
+}
+
+template<typename T>
+void Vector3Stream<T>::Set(std::size_t index, const Vector3<T>& v)
+{
+    x[index] = v.x;
+    y[index] = v.y;
+    z[index] = v.z;
+}
+
+template<typename T>
+void Vector3Stream<T>::Gather(std::span<const Vector3<T>> values)
+{
+    Resize(values.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Gather3(reinterpret_cast<const T*>(values.data()), 
+            x.data(), y.data(), z.data(), values.size());
+    }
+#endif
+
+    for(; i < values.size(); ++i)
+    {
+        Set(i, values[i]);
+    }
+}
+
+template<typename T>
+void Vector3Stream<T>::Scatter(std::span<Vector3<T>> values) const
+{
+    assert(values.size() >= m_size);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Scatter3(x.data(), y.data(), z.data(), 
+            reinterpret_cast<T*>(values.data()), m_size);
+    }
+#endif
+
+    for(; i < m_size; ++i)
+    {
+        values[i] = Get(i);
+    }
+}
+
+//! Operations
+template<typename T>
+void Vector3Stream<T>::Dot(const Vector3Stream<T>& other, std::span<T> output) const
+{
+    assert(m_size == other.m_size && output.size() >= m_size);
+
+    for(std::size_t i = 0; i < m_size; ++i)
+    {
+        output[i] = x[i] * other.x[i] + y[i] * other.y[i] + z[i] * other.z[i];
+    }
+}
+
+template<typename T>
+void Vector3Stream<T>::Length(std::span<T> output) const
+{
+    assert(output.size() >= m_size);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Length3(x.data(), y.data(), z.data(), output.data(), m_size);
+    }
+#endif
+
+    for(; i < m_size; ++i)
+    {
+        output[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+    }
+}
+
+template<typename T>
+void Vector3Stream<T>::LengthSquared(std::span<T> output) const
+{
+    assert(output.size() >= m_size);
+
+    for(std::size_t i = 0; i < m_size; ++i)
+    {
+        output[i] = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+    }
+}
+
+template<typename T>
+void Vector3Stream<T>::Cross(const Vector3Stream<T>& other, Vector3Stream<T>& output) const
+{
+    assert(m_size == other.m_size);
+    output.Resize(m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        T cx = y[i] * other.z[i] - z[i] * other.y[i];
+        T cy = z[i] * other.x[i] - x[i] * other.z[i];
+        T cz = x[i] * other.y[i] - y[i] * other.x[i];
+
+        output.x[i] = cx;
+        output.y[i] = cy;
+        output.z[i] = cz;
+    }
+}
+
+//this += other * value
+template<typename T>
+void Vector3Stream<T>::MulAdd(const Vector3Stream<T>& other, T value)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] += other.x[i] * value;
+        y[i] += other.y[i] * value;
+        z[i] += other.z[i] * value;
+    }
+}
+
+template<typename T>
+void Vector3Stream<T>::Normalize()
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Normalize3(x.data(), y.data(), z.data(), m_size);
+    }
+#endif
+
+    for(; i < m_size; ++i)
+    {
+        T invL = 1 / std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+
+        x[i] *= invL;
+        y[i] *= invL;
+        z[i] *= invL;
+    }
+}
+
+template<typename T>
+void Vector3Stream<T>::SafeNormalize()
+{
+    for(std::size_t i = 0; i < m_size; ++i)
+    {
+        T l2   = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        T invL = l2 != 0 ? 1 / std::sqrt(l2) : 1;
+
+        x[i] *= invL;
+        y[i] *= invL;
+        z[i] *= invL;
+    }
+}
+
+} //namespace math
@@ -43,6 +43,8 @@ public:
     constexpr T       LengthSquared() const;
     constexpr Vector4 GetNormalized() const;
     constexpr Vector4 GetSafeNormalized() const;
+    //Rsqrt based, max relative error ~5e-7 for float
+    constexpr Vector4 GetFastNormalized() const;
 
 public:
     T x, y, z, w;
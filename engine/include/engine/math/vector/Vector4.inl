@@ -1,4 +1,5 @@
 #include <cmath>
+#include "../Functions.hpp"
 
 namespace math
 {
@@ -180,7 +181,7 @@ constexpr T Vector4<T>::Dot(const Vector4<T>& other) const
 template<typename T>
 constexpr T Vector4<T>::Length() const
 {
-    return std::sqrt(x * x + y * y + z * z + w * w);
+    return Sqrt(x * x + y * y + z * z + w * w);
 }
 
 template<typename T>
@@ -192,7 +193,15 @@ constexpr T Vector4<T>::LengthSquared() const
 template<typename T>
 constexpr Vector4<T> Vector4<T>::GetNormalized() const
 {
-    T invL = 1 / std::sqrt(x * x + y * y + z * z + w * w);
+    T invL = 1 / Sqrt(x * x + y * y + z * z + w * w);
+
+    return Vector4(x * invL, y * invL, z * invL, w * invL);
+}
+
+template<typename T>
+constexpr Vector4<T> Vector4<T>::GetFastNormalized() const
+{
+    T invL = FastInvSqrt(x * x + y * y + z * z + w * w);
 
     return Vector4(x * invL, y * invL, z * invL, w * invL);
 }
@@ -200,7 +209,7 @@ constexpr Vector4<T> Vector4<T>::GetNormalized() const
 template<typename T>
 constexpr Vector4<T> Vector4<T>::GetSafeNormalized() const
 {
-    T l = std::sqrt(x * x + y * y + z * z + w * w);
+    T l = Sqrt(x * x + y * y + z * z + w * w);
 
     if(l != 0)
     {
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "Vector4.hpp"
+#include "../simd/Simd.hpp"
+
+#if MATH_SIMD_SSE
+
+namespace math
+{
+
+//16 byte aligned float Vector4 held in a SSE register
+struct alignas(16) Vector4A
+{
+public:
+    using Type = float;
+    constexpr static int32_t Size        = 4;
+    constexpr static int32_t SizeInBytes = sizeof(float) * Size;
+
+    //! Constructors
+    Vector4A();
+    Vector4A(float value);
+    Vector4A(float x, float y, float z, float w);
+    Vector4A(__m128 v);
+    Vector4A(const Vector4<float>& v);
+
+    //! Operators
+    float&       operator[](std::size_t index);
+    const float& operator[](std::size_t index) const;
+    Vector4A     operator+(const Vector4A other) const;
+    Vector4A&    operator+=(const Vector4A other);
+    Vector4A     operator-() const;
+    Vector4A     operator-(const Vector4A other) const;
+    Vector4A&    operator-=(const Vector4A other);
+    Vector4A     operator*(const float value) const;
+    Vector4A&    operator*=(const float value);
+    Vector4A     operator*(const Vector4A other) const;
+    Vector4A&    operator*=(const Vector4A other);
+    Vector4A     operator/(const float value) const;
+    Vector4A&    operator/=(const float value);
+    Vector4A     operator/(const Vector4A other) const;
+    Vector4A&    operator/=(const Vector4A other);
+    bool         operator==(const Vector4A other) const;
+    bool         operator!=(const Vector4A other) const;
+
+    //! Operations
+    float           X() const;
+    float           Y() const;
+    float           Z() const;
+    float           W() const;
+    float           Dot(const Vector4A other) const;
+    float           Length() const;
+    float           LengthSquared() const;
+    Vector4A        GetNormalized() const;
+    Vector4A        GetSafeNormalized() const;
+    Vector4<float>  ToVector4() const;
+
+public:
+    __m128 v;
+};
+
+using Vec4A = Vector4A;
+
+} //namespace math
+
+#include "Vector4A.inl"
+
+#endif
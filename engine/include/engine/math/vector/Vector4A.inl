@@ -0,0 +1,174 @@
+namespace math
+{
+
+//! Constructors
+inline Vector4A::Vector4A() : v{_mm_setzero_ps()} { }
+
+inline Vector4A::Vector4A(float value) : v{_mm_set1_ps(value)} { }
+
+inline Vector4A::Vector4A(float x, float y, float z, float w) : v{_mm_setr_ps(x, y, z, w)} { }
+
+inline Vector4A::Vector4A(__m128 v) : v{v} { }
+
+inline Vector4A::Vector4A(const Vector4<float>& v) : v{_mm_loadu_ps(&v.x)} { }
+
+//! Operators
+inline float& Vector4A::operator[](std::size_t index)
+{
+    return reinterpret_cast<float*>(&v)[index];
+}
+
+inline const float& Vector4A::operator[](std::size_t index) const
+{
+    return reinterpret_cast<const float*>(&v)[index];
+}
+
+inline Vector4A Vector4A::operator+(const Vector4A other) const
+{
+    return _mm_add_ps(v, other.v);
+}
+
+inline Vector4A& Vector4A::operator+=(const Vector4A other)
+{
+    v = _mm_add_ps(v, other.v);
+
+    return *this;
+}
+
+inline Vector4A Vector4A::operator-() const
+{
+    return _mm_xor_ps(v, _mm_set1_ps(-0.0f));
+}
+
+inline Vector4A Vector4A::operator-(const Vector4A other) const
+{
+    return _mm_sub_ps(v, other.v);
+}
+
+inline Vector4A& Vector4A::operator-=(const Vector4A other)
+{
+    v = _mm_sub_ps(v, other.v);
+
+    return *this;
+}
+
+inline Vector4A Vector4A::operator*(const float value) const
+{
+    return _mm_mul_ps(v, _mm_set1_ps(value));
+}
+
+inline Vector4A& Vector4A::operator*=(const float value)
+{
+    v = _mm_mul_ps(v, _mm_set1_ps(value));
+
+    return *this;
+}
+
+inline Vector4A Vector4A::operator*(const Vector4A other) const
+{
+    return _mm_mul_ps(v, other.v);
+}
+
+inline Vector4A& Vector4A::operator*=(const Vector4A other)
+{
+    v = _mm_mul_ps(v, other.v);
+
+    return *this;
+}
+
+inline Vector4A Vector4A::operator/(const float value) const
+{
+    return _mm_mul_ps(v, _mm_set1_ps(1 / value));
+}
+
+inline Vector4A& Vector4A::operator/=(const float value)
+{
+    v = _mm_mul_ps(v, _mm_set1_ps(1 / value));
+
+    return *this;
+}
+
+inline Vector4A Vector4A::operator/(const Vector4A other) const
+{
+    return _mm_div_ps(v, other.v);
+}
+
+inline Vector4A& Vector4A::operator/=(const Vector4A other)
+{
+    v = _mm_div_ps(v, other.v);
+
+    return *this;
+}
+
+inline bool Vector4A::operator==(const Vector4A other) const
+{
+    return _mm_movemask_ps(_mm_cmpeq_ps(v, other.v)) == 0xF;
+}
+
+inline bool Vector4A::operator!=(const Vector4A other) const
+{
+    return _mm_movemask_ps(_mm_cmpeq_ps(v, other.v)) != 0xF;
+}
+
+//! Operations
+inline float Vector4A::X() const
+{
+    return _mm_cvtss_f32(v);
+}
+
+inline float Vector4A::Y() const
+{
+    return _mm_cvtss_f32(simd::Splat<1>(v));
+}
+
+inline float Vector4A::Z() const
+{
+    return _mm_cvtss_f32(simd::Splat<2>(v));
+}
+
+inline float Vector4A::W() const
+{
+    return _mm_cvtss_f32(simd::Splat<3>(v));
+}
+
+inline float Vector4A::Dot(const Vector4A other) const
+{
+    return _mm_cvtss_f32(simd::HorizontalSum(_mm_mul_ps(v, other.v)));
+}
+
+inline float Vector4A::Length() const
+{
+    return _mm_cvtss_f32(_mm_sqrt_ss(simd::HorizontalSum(_mm_mul_ps(v, v))));
+}
+
+inline float Vector4A::LengthSquared() const
+{
+    return _mm_cvtss_f32(simd::HorizontalSum(_mm_mul_ps(v, v)));
+}
+
+inline Vector4A Vector4A::GetNormalized() const
+{
+    return _mm_div_ps(v, _mm_sqrt_ps(simd::HorizontalSum(_mm_mul_ps(v, v))));
+}
+
+inline Vector4A Vector4A::GetSafeNormalized() const
+{
+    __m128 l = _mm_sqrt_ps(simd::HorizontalSum(_mm_mul_ps(v, v)));
+
+    if(_mm_cvtss_f32(l) != 0)
+    {
+        return _mm_div_ps(v, l);
+    }
+
+    return v;
+}
+
+inline Vector4<float> Vector4A::ToVector4() const
+{
+    Vector4<float> r;
+    _mm_storeu_ps(&r.x, v);
+
+    return r;
+}
+
+} //namespace math
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "Vector4.hpp"
+#include "../simd/AlignedAllocator.hpp"
+
+namespace math
+{
+
+//Structure of arrays storage for Vector4. Every component array is aligned
+//and padded to the SIMD width so the bulk operations run without tails.
+//Element wise operations between streams require both to have the same size
+template<typename T>
+struct Vector4Stream
+{
+public:
+    using Type  = T;
+    using Array = std::vector<T, simd::AlignedAllocator<T>>;
+    constexpr static std::size_t Width = simd::DefaultAlignment / sizeof(T);
+
+    //! Constructors
+    Vector4Stream();
+    explicit Vector4Stream(std::size_t size);
+    explicit Vector4Stream(std::span<const Vector4<T>> values);
+
+    //! Operators
+    Vector4Stream& operator+=(const Vector4Stream& other);
+    Vector4Stream& operator-=(const Vector4Stream& other);
+    Vector4Stream& operator*=(const T value);
+    Vector4Stream& operator*=(const Vector4Stream& other);
+
+    //! Accessors
+    std::size_t Size() const;
+    std::size_t PaddedSize() const;
+    void        Resize(std::size_t size);
+    Vector4<T>  Get(std::size_t index) const;
+    void        Set(std::size_t index, const Vector4<T>& v);
+    void        Gather(std::span<const Vector4<T>> values);
+    void        Scatter(std::span<Vector4<T>> values) const;
+
+    //! Operations
+    //Output spans must hold at least Size() elements
+    void Dot(const Vector4Stream& other, std::span<T> output) const;
+    void Length(std::span<T> output) const;
+    void LengthSquared(std::span<T> output) const;
+    void MulAdd(const Vector4Stream& other, T value);
+    void Normalize();
+    void SafeNormalize();
+
+public:
+    Array x, y, z, w;
+
+private:
+    std::size_t m_size;
+};
+
+template struct Vector4Stream<float>;
+template struct Vector4Stream<double>;
+
+using Vec4Stream  = Vector4Stream<float>;
+using Vec4dStream = Vector4Stream<double>;
+
+} //namespace math
+
+#include "Vector4Stream.inl"
@@ -0,0 +1,272 @@
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include "../simd/StreamSimd.hpp"
+
+namespace math
+{
+
+//! Constructors
+template<typename T>
+Vector4Stream<T>::Vector4Stream() : x{}, y{}, z{}, w{}, m_size{0} { }
+
+template<typename T>
+Vector4Stream<T>::Vector4Stream(std::size_t size) : x{}, y{}, z{}, w{}, m_size{0}
+{
+    Resize(size);
+}
+
+template<typename T>
+Vector4Stream<T>::Vector4Stream(std::span<const Vector4<T>> values) : x{}, y{}, z{}, w{}, m_size{0}
+{
+    Gather(values);
+}
+
+//! Operators
+template<typename T>
+Vector4Stream<T>& Vector4Stream<T>::operator+=(const Vector4Stream<T>& other)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] += other.x[i];
+        y[i] += other.y[i];
+        z[i] += other.z[i];
+        w[i] += other.w[i];
+    }
+
+    return *this;
+}
+
+template<typename T>
+Vector4Stream<T>& Vector4Stream<T>::operator-=(const Vector4Stream<T>& other)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] -= other.x[i];
+        y[i] -= other.y[i];
+        z[i] -= other.z[i];
+        w[i] -= other.w[i];
+    }
+
+    return *this;
+}
+
+template<typename T>
+Vector4Stream<T>& Vector4Stream<T>::operator*=(const T value)
+{
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] *= value;
+        y[i] *= value;
+        z[i] *= value;
+        w[i] *= value;
+    }
+
+    return *this;
+}
+
+template<typename T>
+Vector4Stream<T>& Vector4Stream<T>::operator*=(const Vector4Stream<T>& other)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] *= other.x[i];
+        y[i] *= other.y[i];
+        z[i] *= other.z[i];
+        w[i] *= other.w[i];
+    }
+
+    return *this;
+}
+
+//! Accessors
+template<typename T>
+std::size_t Vector4Stream<T>::Size() const
+{
+    return m_size;
+}
+
+template<typename T>
+std::size_t Vector4Stream<T>::PaddedSize() const
+{
+    return x.size();
+}
+
+template<typename T>
+void Vector4Stream<T>::Resize(std::size_t size)
+{
+    std::size_t padded = (size + Width - 1) / Width * Width;
+
+    x.resize(padded);
+    y.resize(padded);
+    z.resize(padded);
+    w.resize(padded);
+
+    //Keep the padding zeroed
+    for(std::size_t i = size; i < padded; ++i)
+    {
+        x[i] = 0;
+        y[i] = 0;
+        z[i] = 0;
+        w[i] = 0;
+    }
+
+    m_size = size;
+}
+
+template<typename T>
+Vector4<T> Vector4Stream<T>::Get(std::size_t index) const
+{
+    return Vector4<T>(x[index], y[index], z[index], w[index]);
+}
+
+template<typename T>
+void Vector4Stream<T>::Set(std::size_t index, const Vector4<T>& v)
+{
+    x[index] = v.x;
+    y[index] = v.y;
+    z[index] = v.z;
+    w[index] = v.w;
+}
+
+template<typename T>
+void Vector4Stream<T>::Gather(std::span<const Vector4<T>> values)
+{
+    Resize(values.size());
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Gather4(reinterpret_cast<const T*>(values.data()), 
+            x.data(), y.data(), z.data(), w.data(), values.size());
+    }
+#endif
+
+    for(; i < values.size(); ++i)
+    {
+        Set(i, values[i]);
+    }
+}
+
+template<typename T>
+void Vector4Stream<T>::Scatter(std::span<Vector4<T>> values) const
+{
+    assert(values.size() >= m_size);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Scatter4(x.data(), y.data(), z.data(), w.data(), 
+            reinterpret_cast<T*>(values.data()), m_size);
+    }
+#endif
+
+    for(; i < m_size; ++i)
+    {
+        values[i] = Get(i);
+    }
+}
+
+//! Operations
+template<typename T>
+void Vector4Stream<T>::Dot(const Vector4Stream<T>& other, std::span<T> output) const
+{
+    assert(m_size == other.m_size && output.size() >= m_size);
+
+    for(std::size_t i = 0; i < m_size; ++i)
+    {
+        output[i] = x[i] * other.x[i] + y[i] * other.y[i] + z[i] * other.z[i] + w[i] * other.w[i];
+    }
+}
+
+template<typename T>
+void Vector4Stream<T>::Length(std::span<T> output) const
+{
+    assert(output.size() >= m_size);
+
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Length4(x.data(), y.data(), z.data(), w.data(), output.data(), m_size);
+    }
+#endif
+
+    for(; i < m_size; ++i)
+    {
+        output[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + w[i] * w[i]);
+    }
+}
+
+template<typename T>
+void Vector4Stream<T>::LengthSquared(std::span<T> output) const
+{
+    assert(output.size() >= m_size);
+
+    for(std::size_t i = 0; i < m_size; ++i)
+    {
+        output[i] = x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + w[i] * w[i];
+    }
+}
+
+//this += other * value
+template<typename T>
+void Vector4Stream<T>::MulAdd(const Vector4Stream<T>& other, T value)
+{
+    assert(m_size == other.m_size);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] += other.x[i] * value;
+        y[i] += other.y[i] * value;
+        z[i] += other.z[i] * value;
+        w[i] += other.w[i] * value;
+    }
+}
+
+template<typename T>
+void Vector4Stream<T>::Normalize()
+{
+    std::size_t i = 0;
+#if MATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        i = simd::Normalize4(x.data(), y.data(), z.data(), w.data(), m_size);
+    }
+#endif
+
+    for(; i < m_size; ++i)
+    {
+        T invL = 1 / std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + w[i] * w[i]);
+
+        x[i] *= invL;
+        y[i] *= invL;
+        z[i] *= invL;
+        w[i] *= invL;
+    }
+}
+
+template<typename T>
+void Vector4Stream<T>::SafeNormalize()
+{
+    for(std::size_t i = 0; i < m_size; ++i)
+    {
+        T l2   = x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + w[i] * w[i];
+        T invL = l2 != 0 ? 1 / std::sqrt(l2) : 1;
+
+        x[i] *= invL;
+        y[i] *= invL;
+        z[i] *= invL;
+        w[i] *= invL;
+    }
+}
+
+} //namespace math
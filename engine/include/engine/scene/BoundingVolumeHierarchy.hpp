@@ -0,0 +1,131 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#include "../math/vector/Vector2.hpp"
+#include "../math/vector/Vector3.hpp"
+#include "../math/geometry/AABB.hpp"
+#include "../math/geometry/Ray.hpp"
+#include "../math/geometry/Sphere.hpp"
+#include "../math/geometry/Triangle.hpp"
+#include "../math/simd/Simd.hpp"
+#include "../math/simd/AlignedAllocator.hpp"
+
+namespace scene
+{
+
+//Bounding volume hierarchy over primitive bounds, built top down with a
+//binned surface area heuristic. The top levels are split on the calling
+//thread with the binning spread over the workers, the subtrees below them are
+//then built in parallel. The binary tree is collapsed into a wide tree whose
+//nodes hold the boxes of up to Width children, which every query traverses
+//with one SIMD test per node. Primitives are referenced by their index in the
+//span given to Build, the triangle queries expect the same span
+class BoundingVolumeHierarchy
+{
+public:
+#if MATH_SIMD_SSE
+    inline static constexpr uint32_t Width {static_cast<uint32_t>(math::simd::PackWidth)};
+#else
+    inline static constexpr uint32_t Width {4};
+#endif
+    inline static constexpr uint32_t InvalidPrimitive {~0u};
+
+    //Binary node, interior nodes have count 0 and their children at first and
+    //first + 1, leaves reference count primitive indices starting at first
+    struct Node
+    {
+        math::Vec3 min;
+        uint32_t first;
+        math::Vec3 max;
+        uint32_t count;
+    };
+    static_assert(sizeof(Node) == 32);
+
+    //Child boxes in structure of arrays, 128 bytes with SSE and 256 with AVX2.
+    //A child with count 0 is the wide node at children[i], otherwise a leaf of
+    //counts[i] primitive indices starting at children[i]. Lanes past
+    //childCount are unused
+    struct alignas(Width * sizeof(float)) WideNode
+    {
+        float minX[Width];
+        float minY[Width];
+        float minZ[Width];
+        float maxX[Width];
+        float maxY[Width];
+        float maxZ[Width];
+        uint32_t children[Width];
+        uint8_t counts[Width];
+        uint32_t childCount;
+    };
+    static_assert(sizeof(WideNode) == Width * 32);
+
+    struct RayHit
+    {
+        uint32_t primitive {InvalidPrimitive};
+        float distance {std::numeric_limits<float>::infinity()};
+        //Weights of v1 and v2
+        math::Vec2 barycentric {};
+    };
+
+    struct PointHit
+    {
+        uint32_t primitive {InvalidPrimitive};
+        float distance {std::numeric_limits<float>::infinity()};
+        math::Vec3 point {};
+    };
+
+    //threadCount includes the thread calling Build, 0 uses every hardware thread
+    explicit BoundingVolumeHierarchy(uint32_t threadCount = 1);
+
+    void Build(std::span<const math::AABB3> bounds);
+    void Build(std::span<const math::Triangle3> triangles);
+    //Recomputes every box bottom up for primitives that moved, the tree is
+    //kept so its quality drops as they move away from where they were built
+    void Refit(std::span<const math::AABB3> bounds);
+    void Refit(std::span<const math::Triangle3> triangles);
+
+    //Closest triangle hit by the ray within maxDistance
+    RayHit IntersectRay(const math::Ray3& ray, std::span<const math::Triangle3> triangles,
+        float maxDistance = std::numeric_limits<float>::infinity()) const;
+    //Appends the primitives whose bounds overlap the sphere
+    void QuerySphere(const math::Sphere3& sphere, std::span<const math::AABB3> bounds, 
+        std::vector<uint32_t>& primitives) const;
+    //Appends the triangles touching the sphere
+    void QuerySphere(const math::Sphere3& sphere, std::span<const math::Triangle3> triangles,
+        std::vector<uint32_t>& primitives) const;
+    //Closest point on the triangles within maxDistance of point
+    PointHit GetClosestPoint(const math::Vec3& point, std::span<const math::Triangle3> triangles,
+        float maxDistance = std::numeric_limits<float>::infinity()) const;
+
+    std::span<const Node> GetNodes() const             { return m_nodes;      }
+    std::span<const WideNode> GetWideNodes() const     { return m_wideNodes;  }
+    std::span<const uint32_t> GetPrimitives() const    { return m_primitives; }
+    bool Empty() const                                 { return m_nodes.empty(); }
+    math::AABB3 GetBounds() const;
+
+private:
+    //Builds over count primitives whose bounds are getBounds(i)
+    template<typename BoundsFunc>
+    void BuildFromBounds(std::size_t count, const BoundsFunc& getBounds);
+    void Collapse();
+    uint32_t CollapseNode(uint32_t node);
+    void RefitWideNodes();
+    void RefitWideNode(uint32_t node);
+    //Calls visit(first, count) for every leaf whose box is within sqrt(radiusSquared) of center
+    template<typename Func>
+    void TraverseSphere(const math::Vec3& center, float radiusSquared, const Func& visit) const;
+
+private:
+    uint32_t m_threadCount {1};
+
+    std::vector<Node> m_nodes {};
+    math::simd::AlignedVector<WideNode> m_wideNodes {};
+    //Binary node of every wide node lane, used by Refit
+    std::vector<uint32_t> m_wideSources {};
+    //Primitive indices referenced by the leaves
+    std::vector<uint32_t> m_primitives {};
+};
+
+} //namespace scene
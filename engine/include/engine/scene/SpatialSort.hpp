@@ -0,0 +1,90 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../math/vector/Vector2.hpp"
+#include "../math/vector/Vector3.hpp"
+#include "../math/geometry/AABB.hpp"
+#include "../math/Parallel.hpp"
+
+namespace scene
+{
+
+//Orders points along a Z-order curve so points close in space end up close in
+//memory. Positions are encoded to 32 bit Morton keys (see math/spatial/Morton.hpp)
+//and sorted with a stable least significant digit radix sort whose passes are
+//split between the threads. The resulting order is then applied to every
+//array of a structure of arrays with Reorder
+class SpatialSort
+{
+public:
+    //threadCount includes the thread calling Sort, 0 uses every hardware thread
+    explicit SpatialSort(uint32_t threadCount = 1);
+
+    //Keys within the bounds of the positions
+    void Sort(std::span<const math::Vec3> positions);
+    void Sort(std::span<const math::Vec3> positions, const math::AABB3& bounds);
+    void Sort(std::span<const math::Vec2> positions, const math::Vec2& min, const math::Vec2& max);
+    //Precomputed keys, equal keys keep their relative order
+    void Sort(std::span<const uint32_t> keys);
+
+    //order[i] is the index before sorting of the element now at i
+    std::span<const uint32_t> GetOrder() const { return m_order; }
+    //Sorted keys
+    std::span<const uint32_t> GetKeys() const  { return m_keys;  }
+    std::size_t Size() const                   { return m_order.size(); }
+
+    //output[i] = input[order[i]], the spans must not overlap
+    template<typename T>
+    void Reorder(std::span<const T> input, std::span<T> output) const;
+    //Reorders values in place through a temporary copy
+    template<typename T, typename Allocator>
+    void Reorder(std::vector<T, Allocator>& values) const;
+
+private:
+    void SortKeys();
+
+private:
+    //Sorts and reorders with fewer elements than this per thread are not split
+    inline static constexpr std::size_t m_MinElementsPerThread {1 << 14};
+
+    uint32_t m_threadCount {1};
+
+    std::vector<uint32_t> m_keys {};
+    std::vector<uint32_t> m_order {};
+    //Radix sort ping pong buffers
+    std::vector<uint32_t> m_scratchKeys {};
+    std::vector<uint32_t> m_scratchOrder {};
+    //Digit counts of every thread, then their scatter offsets
+    std::vector<std::size_t> m_histograms {};
+};
+
+template<typename T>
+void SpatialSort::Reorder(std::span<const T> input, std::span<T> output) const
+{
+    assert(input.size() == m_order.size() && output.size() >= m_order.size());
+
+    std::size_t count    = m_order.size();
+    uint32_t threadCount = static_cast<uint32_t>(std::clamp<std::size_t>(count / m_MinElementsPerThread,
+        1, m_threadCount));
+
+    math::ParallelFor(threadCount, count, [&](uint32_t, std::size_t begin, std::size_t end)
+    {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            output[i] = input[m_order[i]];
+        }
+    });
+}
+
+template<typename T, typename Allocator>
+void SpatialSort::Reorder(std::vector<T, Allocator>& values) const
+{
+    std::vector<T, Allocator> sorted(values.size(), values.get_allocator());
+    Reorder(std::span<const T>(values), std::span<T>(sorted));
+    values.swap(sorted);
+}
+
+} //namespace scene
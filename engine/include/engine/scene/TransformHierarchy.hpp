@@ -0,0 +1,101 @@
+#pragma once
+#include <atomic>
+#include <barrier>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+#include "../math/vector/Vector3.hpp"
+#include "../math/quat/Quaternion.hpp"
+#include "../math/matrix/Matrix4.hpp"
+#include "../math/simd/AlignedAllocator.hpp"
+
+namespace scene
+{
+
+//Parent/child transforms stored as flat arrays sorted breadth first, so every
+//parent comes before its children and each depth level is a contiguous range.
+//Nodes keep a local scale, rotation and translation (the inputs of
+//Matrix4::CreateTransform) and Update only recomputes the world matrix of
+//dirty nodes and their descendants. Levels are processed in order and the
+//nodes of a level are split between the worker threads
+class TransformHierarchy
+{
+public:
+    using NodeId = int32_t;
+
+    inline static constexpr NodeId InvalidNode {-1};
+
+    //threadCount includes the thread calling Update, 0 uses every hardware thread
+    explicit TransformHierarchy(uint32_t threadCount = 1);
+    TransformHierarchy(const TransformHierarchy& other) = delete;
+    TransformHierarchy& operator=(const TransformHierarchy& other) = delete;
+    ~TransformHierarchy();
+
+    //Adds a node under parent (InvalidNode for a root). Ids stay valid for the
+    //lifetime of the hierarchy, flat indices change when nodes are sorted
+    NodeId AddNode(NodeId parent = InvalidNode, const math::Vec3& scale = math::Vec3(1), 
+        const math::Quat& rotation = math::Quat(0, 0, 0, 1), const math::Vec3& translation = math::Vec3(0));
+    void Reserve(std::size_t count);
+
+    void SetScale(NodeId node, const math::Vec3& scale);
+    void SetRotation(NodeId node, const math::Quat& rotation);
+    void SetTranslation(NodeId node, const math::Vec3& translation);
+    void SetLocal(NodeId node, const math::Vec3& scale, const math::Quat& rotation, const math::Vec3& translation);
+
+    const math::Vec3& GetScale(NodeId node) const       { return m_scales[m_indices[node]];       }
+    const math::Quat& GetRotation(NodeId node) const    { return m_rotations[m_indices[node]];    }
+    const math::Vec3& GetTranslation(NodeId node) const { return m_translations[m_indices[node]]; }
+    NodeId GetParent(NodeId node) const;
+
+    //World matrices are valid after Update
+    const math::Mat4& GetWorld(NodeId node) const { return m_worlds[m_indices[node]]; }
+    //World matrices in breadth first order, GetIndex maps an id into this span
+    std::span<const math::Mat4> GetWorldMatrices() const { return m_worlds; }
+    std::size_t GetIndex(NodeId node) const              { return m_indices[node]; }
+    std::size_t Size() const                             { return m_parents.size(); }
+    //Valid after Update
+    std::size_t GetLevelCount() const                    { return m_levelOffsets.size() - 1; }
+
+    //Sorts the nodes added since the last update and recomputes the world
+    //matrices of every dirty node and its descendants
+    void Update();
+
+private:
+    void Sort();
+    void WorkerLoop(uint32_t thread);
+    void UpdateLevels(uint32_t thread, uint32_t threadCount);
+    void UpdateRange(std::size_t begin, std::size_t end);
+    void MarkDirty(NodeId node);
+
+private:
+    //Levels smaller than this many nodes per thread are not split
+    inline static constexpr std::size_t m_MinNodesPerThread {1024};
+
+    //Flat arrays indexed in breadth first order
+    std::vector<int32_t> m_parents {};
+    std::vector<uint32_t> m_levels {};
+    std::vector<NodeId> m_ids {};
+    std::vector<math::Vec3> m_scales {};
+    std::vector<math::Quat> m_rotations {};
+    std::vector<math::Vec3> m_translations {};
+    math::simd::AlignedVector<math::Mat4> m_worlds {};
+    //Set when the local transform changed, during Update also set on every
+    //node whose parent was recomputed
+    std::vector<uint8_t> m_dirty {};
+
+    //NodeId -> flat index
+    std::vector<uint32_t> m_indices {};
+    //Start of every level plus the end of the last one
+    std::vector<std::size_t> m_levelOffsets {0};
+    bool m_needsSort {false};
+    bool m_anyDirty {false};
+
+    std::vector<std::thread> m_workers {};
+    std::barrier<> m_barrier;
+    std::atomic<bool> m_stop {false};
+};
+
+} //namespace scene
+
+namespace scn = scene;
@@ -0,0 +1,1476 @@
+#include <engine/scene/BoundingVolumeHierarchy.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <engine/math/Functions.hpp>
+#include <engine/math/Parallel.hpp>
+#include <engine/math/simd/IntersectionSimd.hpp>
+
+namespace scene
+{
+
+using Node     = BoundingVolumeHierarchy::Node;
+using WideNode = BoundingVolumeHierarchy::WideNode;
+
+namespace
+{
+
+//Surface area heuristic splits stop at this depth and the remaining
+//primitives are halved, which bounds the depth and the traversal stacks
+constexpr uint32_t MaxSahDepth = 64;
+constexpr uint32_t MaxDepth    = MaxSahDepth + 32;
+constexpr uint32_t MaxLeafSize = 8;
+constexpr uint32_t BinCount    = 16;
+//Subtrees with at most this many references are built from the references
+//sorted along every axis, which evaluates every split for less than binning
+constexpr uint32_t MaxSweepSize = 16;
+//Cost of visiting a node relative to testing a primitive
+constexpr float TraversalCost = 1.0f;
+//Nodes with more primitives than this are binned and partitioned on every thread
+constexpr std::size_t MinParallelSplit = 1 << 14;
+constexpr std::size_t StackSize          = MaxDepth * BoundingVolumeHierarchy::Width;
+
+//Node waiting to be split, its bounds are already stored in the node
+struct Task
+{
+    uint32_t node;
+    uint32_t begin;
+    uint32_t end;
+    uint32_t depth;
+    math::AABB3 centroidBounds;
+};
+
+//Primitives are partitioned with their bounds so the build reads them in
+//order instead of through the indices. Aligned so none straddles two cache lines
+struct alignas(32) Reference
+{
+    math::AABB3 bounds;
+    uint32_t primitive;
+};
+
+//Split plane between two bins of an axis with the bounds of both sides
+struct Split
+{
+    uint32_t axis {0};
+    uint32_t bin {0};
+    float cost {std::numeric_limits<float>::infinity()};
+    math::AABB3 left {};
+    math::AABB3 right {};
+};
+
+//Box kept in registers by the build loops, the w lanes are ignored
+struct Box
+{
+#if MATH_SIMD_SSE
+    __m128 min;
+    __m128 max;
+
+    static Box Load(const math::AABB3& bounds)
+    {
+        //The max load starts at min.z so it does not read past the box
+        return Box{_mm_loadu_ps(&bounds.min.x), math::simd::Swizzle<1, 2, 3, 3>(_mm_loadu_ps(&bounds.min.z))};
+    }
+
+    static Box CreateEmpty()
+    {
+        return Box{_mm_set1_ps(std::numeric_limits<float>::max()), _mm_set1_ps(-std::numeric_limits<float>::max())};
+    }
+
+    //Point box at the center
+    Box GetCenter() const
+    {
+        __m128 center = _mm_mul_ps(_mm_add_ps(min, max), _mm_set1_ps(0.5f));
+        return Box{center, center};
+    }
+
+    Box GetMerged(const Box& other) const
+    {
+        return Box{_mm_min_ps(min, other.min), _mm_max_ps(max, other.max)};
+    }
+
+    float GetSurfaceArea() const
+    {
+        __m128 size     = _mm_sub_ps(max, min);
+        __m128 products = _mm_mul_ps(size, math::simd::Swizzle<1, 2, 0, 3>(size));
+        __m128 sum      = _mm_add_ss(products, _mm_add_ss(math::simd::Swizzle<1, 1, 1, 1>(products),
+            _mm_movehl_ps(products, products)));
+        return 2 * _mm_cvtss_f32(sum);
+    }
+
+    math::AABB3 ToAABB() const
+    {
+        alignas(16) float minValues[4];
+        alignas(16) float maxValues[4];
+        _mm_store_ps(minValues, min);
+        _mm_store_ps(maxValues, max);
+        return math::AABB3(math::Vec3(minValues[0], minValues[1], minValues[2]),
+            math::Vec3(maxValues[0], maxValues[1], maxValues[2]));
+    }
+#else
+    math::AABB3 bounds;
+
+    static Box Load(const math::AABB3& bounds)     { return Box{bounds}; }
+    static Box CreateEmpty()                       { return Box{math::AABB3::CreateEmpty()}; }
+    Box GetCenter() const                          { return Box{math::AABB3(bounds.GetCenter(), bounds.GetCenter())}; }
+    Box GetMerged(const Box& other) const          { return Box{bounds.GetMerged(other.bounds)}; }
+    float GetSurfaceArea() const                   { return bounds.GetSurfaceArea(); }
+    math::AABB3 ToAABB() const                     { return bounds; }
+#endif
+};
+
+//Bins are reused from node to node, only the ones in use are reset
+struct Bin
+{
+    Box bounds;
+    uint32_t count;
+};
+
+using Bins = std::array<std::array<Bin, BinCount>, 3>;
+
+struct StackEntry
+{
+    uint32_t node;
+    float distance;
+};
+
+math::AABB3 MergeNodes(const Node& a, const Node& b)
+{
+    return math::AABB3(a.min, a.max).GetMerged(math::AABB3(b.min, b.max));
+}
+
+//Maps centroids to binCount bins, the scale leaves the max centroid inside
+//the last bin
+struct BinMapping
+{
+    math::Vec3 offset;
+    math::Vec3 scale;
+    uint32_t binCount;
+
+    BinMapping(const math::AABB3& centroidBounds, uint32_t count) : offset{centroidBounds.min}, binCount{count}
+    {
+        math::Vec3 size = centroidBounds.GetSize();
+
+        for(int32_t axis = 0; axis < 3; ++axis)
+        {
+            float axisScale = binCount * 0.99999f / size[axis];
+            scale[axis]     = size[axis] > 0 && axisScale < std::numeric_limits<float>::max() ? axisScale : 0;
+        }
+    }
+
+    //Same operations as the SIMD binning so both give the same bin
+    uint32_t operator()(const Reference& reference, uint32_t axis) const
+    {
+        float centroid = (reference.bounds.min[axis] + reference.bounds.max[axis]) * 0.5f;
+        uint32_t bin   = static_cast<uint32_t>((centroid - offset[axis]) * scale[axis]);
+        return std::min(bin, binCount - 1);
+    }
+};
+
+void ResetBins(Bins& bins, uint32_t binCount)
+{
+    for(uint32_t axis = 0; axis < 3; ++axis)
+    {
+        std::fill_n(bins[axis].begin(), binCount, Bin{Box::CreateEmpty(), 0});
+    }
+}
+
+//Every reference goes into one bin per axis. With SSE the bins are kept in
+//registers, the w lane of the loads belongs to the next member and is cleared
+void BinReferences(std::span<const Reference> references, const BinMapping& mapping, Bins& bins)
+{
+#if MATH_SIMD_SSE
+    using namespace math::simd;
+
+    const __m128 mask   = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    const __m128 half   = _mm_set1_ps(0.5f);
+    const __m128 offset = _mm_setr_ps(mapping.offset.x, mapping.offset.y, mapping.offset.z, 0);
+    const __m128 scale  = _mm_setr_ps(mapping.scale.x, mapping.scale.y, mapping.scale.z, 0);
+    const __m128 last   = _mm_set1_ps(static_cast<float>(mapping.binCount - 1));
+
+    //Two sets of bins, consecutive references in the same bin would
+    //otherwise wait on each other through memory
+    __m128 mins[2][3][BinCount];
+    __m128 maxs[2][3][BinCount];
+    uint32_t counts[2][3][BinCount] {};
+    for(uint32_t set = 0; set < 2; ++set)
+    {
+        for(uint32_t axis = 0; axis < 3; ++axis)
+        {
+            for(uint32_t i = 0; i < mapping.binCount; ++i)
+            {
+                mins[set][axis][i] = _mm_set1_ps(std::numeric_limits<float>::max());
+                maxs[set][axis][i] = _mm_set1_ps(-std::numeric_limits<float>::max());
+            }
+        }
+    }
+
+    auto add = [&](const Reference& reference, uint32_t set)
+    {
+        __m128 min      = And(_mm_loadu_ps(&reference.bounds.min.x), mask);
+        __m128 max      = And(_mm_loadu_ps(&reference.bounds.max.x), mask);
+        __m128 centroid = Mul(Add(min, max), half);
+
+        //The indices are moved out of the register, going through memory
+        //stalls on store forwarding
+        __m128i indices  = _mm_cvttps_epi32(Min(Mul(Sub(centroid, offset), scale), last));
+        int32_t index[3] = {_mm_cvtsi128_si32(indices), _mm_cvtsi128_si32(_mm_shuffle_epi32(indices, 1)),
+            _mm_cvtsi128_si32(_mm_shuffle_epi32(indices, 2))};
+
+        for(uint32_t axis = 0; axis < 3; ++axis)
+        {
+            mins[set][axis][index[axis]] = Min(mins[set][axis][index[axis]], min);
+            maxs[set][axis][index[axis]] = Max(maxs[set][axis][index[axis]], max);
+            ++counts[set][axis][index[axis]];
+        }
+    };
+
+    std::size_t i = 0;
+    for(; i + 1 < references.size(); i += 2)
+    {
+        add(references[i], 0);
+        add(references[i + 1], 1);
+    }
+
+    if(i < references.size())
+    {
+        add(references[i], 0);
+    }
+
+    for(uint32_t axis = 0; axis < 3; ++axis)
+    {
+        for(uint32_t i = 0; i < mapping.binCount; ++i)
+        {
+            bins[axis][i] = Bin{Box{Min(mins[0][axis][i], mins[1][axis][i]), Max(maxs[0][axis][i], maxs[1][axis][i])},
+                counts[0][axis][i] + counts[1][axis][i]};
+        }
+    }
+#else
+    ResetBins(bins, mapping.binCount);
+
+    for(const Reference& reference : references)
+    {
+        for(uint32_t axis = 0; axis < 3; ++axis)
+        {
+            Bin& bin   = bins[axis][mapping(reference, axis)];
+            bin.bounds = bin.bounds.GetMerged(Box::Load(reference.bounds));
+            ++bin.count;
+        }
+    }
+#endif
+}
+
+//Sweeps the bins of every axis, the cost of a split is the sum of the
+//surface area times primitive count of both sides
+Split FindSplit(const Bins& bins, uint32_t binCount)
+{
+    Split best {};
+    Box bestLeft {};
+
+    for(uint32_t axis = 0; axis < 3; ++axis)
+    {
+        const std::array<Bin, BinCount>& axisBins = bins[axis];
+        std::array<float, BinCount> rightCosts;
+        Box bounds     = Box::CreateEmpty();
+        uint32_t count = 0;
+
+        for(uint32_t i = binCount - 1; i > 0; --i)
+        {
+            bounds        = bounds.GetMerged(axisBins[i].bounds);
+            count        += axisBins[i].count;
+            rightCosts[i] = count == 0 ? -1 : bounds.GetSurfaceArea() * count;
+        }
+
+        bounds = Box::CreateEmpty();
+        count  = 0;
+
+        for(uint32_t i = 1; i < binCount; ++i)
+        {
+            bounds = bounds.GetMerged(axisBins[i - 1].bounds);
+            count += axisBins[i - 1].count;
+
+            if(count == 0 || rightCosts[i] < 0)
+            {
+                continue;
+            }
+
+            float cost = bounds.GetSurfaceArea() * count + rightCosts[i];
+            if(cost < best.cost)
+            {
+                best.axis = axis;
+                best.bin  = i;
+                best.cost = cost;
+                bestLeft  = bounds;
+            }
+        }
+    }
+
+    //Only the right side of the best split is gathered again
+    if(best.bin != 0)
+    {
+        Box right = Box::CreateEmpty();
+        for(uint32_t i = best.bin; i < binCount; ++i)
+        {
+            right = right.GetMerged(bins[best.axis][i].bounds);
+        }
+
+        best.left  = bestLeft.ToAABB();
+        best.right = right.ToAABB();
+    }
+
+    return best;
+}
+
+//In place, moves the references left of the split to the front and gathers
+//the centroid bounds of both sides. Returns the number of references on the left
+uint32_t Partition(std::span<Reference> references, const BinMapping& mapping, const Split& split,
+    math::AABB3& leftCentroids, math::AABB3& rightCentroids)
+{
+#if MATH_SIMD_SSE
+    using namespace math::simd;
+
+    const __m128 mask   = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    const __m128 half   = _mm_set1_ps(0.5f);
+    const __m128 offset = _mm_setr_ps(mapping.offset.x, mapping.offset.y, mapping.offset.z, 0);
+    const __m128 scale  = _mm_setr_ps(mapping.scale.x, mapping.scale.y, mapping.scale.z, 0);
+    const __m128 last   = _mm_set1_ps(static_cast<float>(mapping.binCount - 1));
+    const __m128i bin   = _mm_set1_epi32(static_cast<int32_t>(split.bin));
+    const int32_t axis  = static_cast<int32_t>(split.axis);
+
+    const __m128 highest = _mm_set1_ps(std::numeric_limits<float>::max());
+    const __m128 lowest  = _mm_set1_ps(-std::numeric_limits<float>::max());
+
+    __m128 leftMin  = highest;
+    __m128 leftMax  = lowest;
+    __m128 rightMin = highest;
+    __m128 rightMax = lowest;
+
+    //The side of every reference is found first without branching, it is not
+    //predictable. Bits are set for the left side. The centroid is clamped
+    //between limits picked by the side, which leaves it unchanged in the bounds
+    //of its side and turns it into an empty box for the other one
+    const __m128 limits[2] = {highest, lowest};
+    std::size_t count     = references.size();
+    std::size_t leftCount = 0;
+    std::vector<uint64_t> sides(count / 64 + 1, 0);
+
+    for(std::size_t word = 0; word * 64 < count; ++word)
+    {
+        std::size_t end = std::min(count, word * 64 + 64);
+        uint64_t bits   = 0;
+
+        for(std::size_t i = word * 64; i < end; ++i)
+        {
+            //Same operations as the binning
+            const Reference& reference = references[i];
+            __m128 centroid = Mul(Add(_mm_loadu_ps(&reference.bounds.min.x), _mm_loadu_ps(&reference.bounds.max.x)), half);
+            __m128i index   = _mm_cvttps_epi32(Min(Mul(Sub(centroid, offset), scale), last));
+            uint32_t isLeft = (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(index, bin))) >> axis) & 1;
+            __m128 lower    = limits[isLeft];
+            __m128 upper    = limits[1 - isLeft];
+
+            leftMin  = Min(leftMin, Max(centroid, lower));
+            leftMax  = Max(leftMax, Min(centroid, upper));
+            rightMin = Min(rightMin, Max(centroid, upper));
+            rightMax = Max(rightMax, Min(centroid, lower));
+
+            bits      |= uint64_t{isLeft} << (i - word * 64);
+            leftCount += isLeft;
+        }
+
+        sides[word] = bits;
+    }
+
+    //Right references before leftCount and left references after it are
+    //misplaced, there are as many of both and they are swapped in pairs
+    auto getLeftMask = [&](std::size_t word)
+    {
+        std::size_t first = word * 64;
+        return first + 64 <= leftCount ? ~uint64_t{0} :
+            first >= leftCount ? uint64_t{0} : (uint64_t{1} << (leftCount - first)) - 1;
+    };
+
+    std::size_t leftWord  = 0;
+    std::size_t rightWord = leftCount / 64;
+    uint64_t leftBits     = ~sides[leftWord] & getLeftMask(leftWord);
+    uint64_t rightBits    = sides[rightWord] & ~getLeftMask(rightWord);
+
+    while(true)
+    {
+        while(leftBits == 0 && ++leftWord * 64 < leftCount)
+        {
+            leftBits = ~sides[leftWord] & getLeftMask(leftWord);
+        }
+
+        if(leftBits == 0)
+        {
+            break;
+        }
+
+        while(rightBits == 0)
+        {
+            ++rightWord;
+            rightBits = sides[rightWord] & ~getLeftMask(rightWord);
+        }
+
+        std::swap(references[leftWord * 64 + std::countr_zero(leftBits)],
+            references[rightWord * 64 + std::countr_zero(rightBits)]);
+        leftBits  &= leftBits - 1;
+        rightBits &= rightBits - 1;
+    }
+
+    auto toBox = [&](__m128 min, __m128 max)
+    {
+        alignas(16) float minValues[4];
+        alignas(16) float maxValues[4];
+        _mm_store_ps(minValues, And(min, mask));
+        _mm_store_ps(maxValues, And(max, mask));
+        return math::AABB3(math::Vec3(minValues[0], minValues[1], minValues[2]),
+            math::Vec3(maxValues[0], maxValues[1], maxValues[2]));
+    };
+
+    leftCentroids  = leftCentroids.GetMerged(toBox(leftMin, leftMax));
+    rightCentroids = rightCentroids.GetMerged(toBox(rightMin, rightMax));
+    return static_cast<uint32_t>(leftCount);
+#else
+    std::size_t begin = 0;
+    std::size_t end   = references.size();
+
+    while(begin < end)
+    {
+        math::Vec3 centroid = references[begin].bounds.GetCenter();
+
+        if(mapping(references[begin], split.axis) < split.bin)
+        {
+            leftCentroids = leftCentroids.GetMerged(centroid);
+            ++begin;
+        }
+        else
+        {
+            rightCentroids = rightCentroids.GetMerged(centroid);
+            std::swap(references[begin], references[--end]);
+        }
+    }
+
+    return static_cast<uint32_t>(begin);
+#endif
+}
+
+//Splits the references of task into two children or turns the node into a
+//leaf. Returns false for leaves. Big nodes are binned and partitioned on
+//threadCount threads, the partition goes through scratch
+bool SplitNode(std::span<Reference> references, std::span<Reference> scratch, std::vector<Node>& nodes,
+    const Task& task, uint32_t threadCount, Bins& bins, Task& left, Task& right)
+{
+    Node& node               = nodes[task.node];
+    uint32_t count           = task.end - task.begin;
+    std::span<Reference> range = references.subspan(task.begin, count);
+
+    auto makeLeaf = [&]()
+    {
+        node.first = task.begin;
+        node.count = count;
+        return false;
+    };
+
+    if(count == 1)
+    {
+        return makeLeaf();
+    }
+
+    //Small nodes do not need the full resolution
+    BinMapping mapping(task.centroidBounds, std::min(BinCount, 4 + count / 4));
+    bool parallel = threadCount > 1 && count >= MinParallelSplit;
+    std::vector<Bins> threadBins(parallel ? threadCount : 0);
+    Split split {};
+
+    if(task.depth < MaxSahDepth)
+    {
+        if(parallel)
+        {
+            math::ParallelFor(threadCount, count, [&](uint32_t thread, std::size_t begin, std::size_t end)
+            {
+                BinReferences(range.subspan(begin, end - begin), mapping, threadBins[thread]);
+            });
+
+            ResetBins(bins, mapping.binCount);
+            for(const Bins& partial : threadBins)
+            {
+                for(uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    for(uint32_t i = 0; i < mapping.binCount; ++i)
+                    {
+                        bins[axis][i].bounds = bins[axis][i].bounds.GetMerged(partial[axis][i].bounds);
+                        bins[axis][i].count += partial[axis][i].count;
+                    }
+                }
+            }
+        }
+        else
+        {
+            BinReferences(range, mapping, bins);
+        }
+
+        split = FindSplit(bins, mapping.binCount);
+
+        float area     = math::AABB3(node.min, node.max).GetSurfaceArea();
+        float leafCost = static_cast<float>(count);
+        if(count <= MaxLeafSize && (split.bin == 0 || !(TraversalCost + split.cost / area < leafCost)))
+        {
+            return makeLeaf();
+        }
+    }
+    else if(count <= MaxLeafSize)
+    {
+        return makeLeaf();
+    }
+
+    math::AABB3 leftCentroids  = math::AABB3::CreateEmpty();
+    math::AABB3 rightCentroids = math::AABB3::CreateEmpty();
+    uint32_t leftCount {};
+
+    if(split.bin != 0 && parallel)
+    {
+        //The bins of each thread give where its references go, they are
+        //scattered into scratch and copied back
+        std::vector<uint32_t> leftOffsets(threadCount + 1, 0);
+        std::vector<uint32_t> rightOffsets(threadCount + 1, 0);
+        for(uint32_t thread = 0; thread < threadCount; ++thread)
+        {
+            uint32_t threadLeft  = 0;
+            uint32_t threadTotal = 0;
+            for(uint32_t i = 0; i < mapping.binCount; ++i)
+            {
+                threadLeft  += i < split.bin ? threadBins[thread][split.axis][i].count : 0;
+                threadTotal += threadBins[thread][split.axis][i].count;
+            }
+
+            leftOffsets[thread + 1]  = leftOffsets[thread] + threadLeft;
+            rightOffsets[thread + 1] = rightOffsets[thread] + threadTotal - threadLeft;
+        }
+
+        leftCount = leftOffsets[threadCount];
+        std::vector<math::AABB3> threadCentroids(threadCount * 2, math::AABB3::CreateEmpty());
+        std::span<Reference> target = scratch.subspan(task.begin, count);
+
+        math::ParallelFor(threadCount, count, [&](uint32_t thread, std::size_t begin, std::size_t end)
+        {
+            uint32_t leftIndex  = leftOffsets[thread];
+            uint32_t rightIndex = leftCount + rightOffsets[thread];
+
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                math::AABB3& centroids = mapping(range[i], split.axis) < split.bin ?
+                    threadCentroids[thread * 2] : threadCentroids[thread * 2 + 1];
+                uint32_t& index        = mapping(range[i], split.axis) < split.bin ? leftIndex : rightIndex;
+
+                centroids       = centroids.GetMerged(range[i].bounds.GetCenter());
+                target[index++] = range[i];
+            }
+        });
+        math::ParallelFor(threadCount, count, [&](uint32_t, std::size_t begin, std::size_t end)
+        {
+            std::copy(target.begin() + begin, target.begin() + end, range.begin() + begin);
+        });
+
+        for(uint32_t thread = 0; thread < threadCount; ++thread)
+        {
+            leftCentroids  = leftCentroids.GetMerged(threadCentroids[thread * 2]);
+            rightCentroids = rightCentroids.GetMerged(threadCentroids[thread * 2 + 1]);
+        }
+    }
+    else if(split.bin != 0)
+    {
+        leftCount = Partition(range, mapping, split, leftCentroids, rightCentroids);
+    }
+    else
+    {
+        //Too deep or no bin boundary between the centroids, halve along the
+        //longest centroid axis
+        math::Vec3 size = task.centroidBounds.GetSize();
+        uint32_t axis   = size.x > size.y ? (size.x > size.z ? 0 : 2) : (size.y > size.z ? 1 : 2);
+        leftCount       = count / 2;
+
+        std::nth_element(range.begin(), range.begin() + leftCount, range.end(),
+            [axis](const Reference& a, const Reference& b)
+            {
+                return a.bounds.min[axis] + a.bounds.max[axis] < b.bounds.min[axis] + b.bounds.max[axis];
+            });
+
+        split.left  = math::AABB3::CreateEmpty();
+        split.right = math::AABB3::CreateEmpty();
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            math::AABB3& bounds    = i < leftCount ? split.left : split.right;
+            math::AABB3& centroids = i < leftCount ? leftCentroids : rightCentroids;
+            bounds    = bounds.GetMerged(range[i].bounds);
+            centroids = centroids.GetMerged(range[i].bounds.GetCenter());
+        }
+    }
+
+    uint32_t child  = static_cast<uint32_t>(nodes.size());
+    uint32_t middle = task.begin + leftCount;
+    //node is invalidated by the resize
+    nodes[task.node].first = child;
+    nodes[task.node].count = 0;
+    nodes.resize(nodes.size() + 2);
+    nodes[child]     = Node{split.left.min, 0, split.left.max, 0};
+    nodes[child + 1] = Node{split.right.min, 0, split.right.max, 0};
+
+    left  = Task{child, task.begin, middle, task.depth + 1, leftCentroids};
+    right = Task{child + 1, middle, task.end, task.depth + 1, rightCentroids};
+    return true;
+}
+
+//Builds the subtree of a node with at most MaxSweepSize references with the
+//exact surface area heuristic. The references are sorted along every axis
+//once, the children keep the order of their parent
+struct SweepBuilder
+{
+    using Orders = std::array<std::array<uint8_t, MaxSweepSize>, 3>;
+
+    std::span<Reference> references;
+    std::vector<Node>& nodes;
+    uint32_t first;
+    //Only the first references.size() elements are written and read
+    std::array<Box, MaxSweepSize> boxes;
+    std::array<std::array<float, MaxSweepSize>, 3> keys;
+    //References in leaf order, copied back once the subtree is built
+    std::array<Reference, MaxSweepSize> sorted;
+    uint32_t sortedCount {0};
+
+    SweepBuilder(std::span<Reference> references, std::vector<Node>& nodes, uint32_t first) :
+        references{references}, nodes{nodes}, first{first}
+    {
+    }
+
+    void Build(uint32_t node, uint32_t depth)
+    {
+        uint32_t count = static_cast<uint32_t>(references.size());
+        Orders orders;
+
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            boxes[i] = Box::Load(references[i].bounds);
+            for(uint32_t axis = 0; axis < 3; ++axis)
+            {
+                keys[axis][i] = references[i].bounds.min[axis] + references[i].bounds.max[axis];
+            }
+        }
+
+        //Sorted on twice the centroids by counting the keys before each one,
+        //which does not branch on the keys like a comparison sort
+        for(uint32_t axis = 0; axis < 3; ++axis)
+        {
+            const std::array<float, MaxSweepSize>& axisKeys = keys[axis];
+
+            for(uint32_t i = 0; i < count; ++i)
+            {
+                //Equal keys keep their order
+                uint32_t rank = 0;
+                for(uint32_t j = 0; j < i; ++j)
+                {
+                    rank += axisKeys[j] <= axisKeys[i];
+                }
+
+                for(uint32_t j = i + 1; j < count; ++j)
+                {
+                    rank += axisKeys[j] < axisKeys[i];
+                }
+
+                orders[axis][rank] = static_cast<uint8_t>(i);
+            }
+        }
+
+        BuildNode(node, orders, count, depth);
+        std::copy_n(sorted.begin(), count, references.begin());
+    }
+
+    void MakeLeaf(uint32_t node, const std::array<uint8_t, MaxSweepSize>& order, uint32_t count)
+    {
+        nodes[node].first = first + sortedCount;
+        nodes[node].count = count;
+
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            sorted[sortedCount++] = references[order[i]];
+        }
+    }
+
+    void BuildNode(uint32_t node, const Orders& orders, uint32_t count, uint32_t depth)
+    {
+        if(count == 1)
+        {
+            return MakeLeaf(node, orders[0], count);
+        }
+
+        uint32_t axis      = 0;
+        uint32_t leftCount = count / 2;
+
+        if(depth < MaxSahDepth)
+        {
+            std::array<float, MaxSweepSize> rightCosts;
+            float bestCost = std::numeric_limits<float>::infinity();
+            //Every split of two references costs the same
+            uint32_t axisCount = count == 2 ? 1 : 3;
+
+            for(uint32_t splitAxis = 0; splitAxis < axisCount; ++splitAxis)
+            {
+                const std::array<uint8_t, MaxSweepSize>& order = orders[splitAxis];
+
+                Box box = Box::CreateEmpty();
+                for(uint32_t i = count - 1; i > 0; --i)
+                {
+                    box           = box.GetMerged(boxes[order[i]]);
+                    rightCosts[i] = box.GetSurfaceArea() * static_cast<float>(count - i);
+                }
+
+                box = Box::CreateEmpty();
+                for(uint32_t i = 1; i < count; ++i)
+                {
+                    box        = box.GetMerged(boxes[order[i - 1]]);
+                    float cost = box.GetSurfaceArea() * static_cast<float>(i) + rightCosts[i];
+
+                    if(cost < bestCost)
+                    {
+                        axis      = splitAxis;
+                        leftCount = i;
+                        bestCost  = cost;
+                    }
+                }
+            }
+
+            float area = math::AABB3(nodes[node].min, nodes[node].max).GetSurfaceArea();
+            if(count <= MaxLeafSize && !(TraversalCost + bestCost / area < static_cast<float>(count)))
+            {
+                return MakeLeaf(node, orders[0], count);
+            }
+        }
+        else if(count <= MaxLeafSize)
+        {
+            return MakeLeaf(node, orders[0], count);
+        }
+        else
+        {
+            //Too deep, halve along the longest centroid axis
+            float longest = -1;
+            for(uint32_t splitAxis = 0; splitAxis < 3; ++splitAxis)
+            {
+                const std::array<float, MaxSweepSize>& axisKeys = keys[splitAxis];
+                float size = axisKeys[orders[splitAxis][count - 1]] - axisKeys[orders[splitAxis][0]];
+
+                if(size > longest)
+                {
+                    axis    = splitAxis;
+                    longest = size;
+                }
+            }
+        }
+
+        //Both sides keep the order of every axis
+        std::array<bool, MaxSweepSize> isLeft;
+        Box left  = Box::CreateEmpty();
+        Box right = Box::CreateEmpty();
+
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t index = orders[axis][i];
+            isLeft[index]  = i < leftCount;
+
+            Box& side = i < leftCount ? left : right;
+            side      = side.GetMerged(boxes[index]);
+        }
+
+        Orders leftOrders, rightOrders;
+        for(uint32_t splitAxis = 0; splitAxis < 3; ++splitAxis)
+        {
+            uint32_t leftIndex  = 0;
+            uint32_t rightIndex = 0;
+
+            for(uint32_t i = 0; i < count; ++i)
+            {
+                uint8_t index = orders[splitAxis][i];
+                leftOrders[splitAxis][leftIndex]   = index;
+                rightOrders[splitAxis][rightIndex] = index;
+                leftIndex  += isLeft[index];
+                rightIndex += !isLeft[index];
+            }
+        }
+
+        uint32_t child = static_cast<uint32_t>(nodes.size());
+        math::AABB3 leftBounds  = left.ToAABB();
+        math::AABB3 rightBounds = right.ToAABB();
+
+        nodes[node].first = child;
+        nodes[node].count = 0;
+        nodes.push_back(Node{leftBounds.min, 0, leftBounds.max, 0});
+        nodes.push_back(Node{rightBounds.min, 0, rightBounds.max, 0});
+
+        BuildNode(child, leftOrders, leftCount, depth + 1);
+        BuildNode(child + 1, rightOrders, count - leftCount, depth + 1);
+    }
+};
+
+//Depth first build of a subtree whose root is already in nodes
+void BuildSubtree(std::span<Reference> references, std::vector<Node>& nodes, const Task& root)
+{
+    std::vector<Task> stack {root};
+    Bins bins {};
+
+    while(!stack.empty())
+    {
+        Task task = stack.back();
+        stack.pop_back();
+
+        uint32_t count = task.end - task.begin;
+        if(count <= MaxSweepSize)
+        {
+            SweepBuilder(references.subspan(task.begin, count), nodes, task.begin).Build(task.node, task.depth);
+            continue;
+        }
+
+        Task left {}, right {};
+        if(SplitNode(references, {}, nodes, task, 1, bins, left, right))
+        {
+            stack.push_back(right);
+            stack.push_back(left);
+        }
+    }
+}
+
+//The top levels are split one node at a time with every thread until there
+//are a few subtrees per thread to balance the work, the subtrees are then
+//built in parallel in their own arrays and copied after the top levels
+void BuildSubtrees(std::span<Reference> references, std::vector<Node>& nodes, const Task& root, uint32_t threadCount)
+{
+    std::vector<Task> subtrees {root};
+    std::vector<Reference> scratch(references.size());
+    Bins bins {};
+
+    while(!subtrees.empty() && subtrees.size() < threadCount * 4)
+    {
+        std::vector<Task> level {};
+
+        for(const Task& task : subtrees)
+        {
+            Task left {}, right {};
+            if(SplitNode(references, scratch, nodes, task, threadCount, bins, left, right))
+            {
+                level.push_back(left);
+                level.push_back(right);
+            }
+        }
+
+        subtrees = std::move(level);
+    }
+
+    //Biggest first, every subtree is built in its own array with its root at 0
+    std::sort(subtrees.begin(), subtrees.end(),
+        [](const Task& a, const Task& b) { return a.end - a.begin > b.end - b.begin; });
+
+    std::vector<std::vector<Node>> subtreeNodes(subtrees.size());
+    std::atomic<std::size_t> next {0};
+    math::ParallelFor(threadCount, threadCount, [&](uint32_t, std::size_t, std::size_t)
+    {
+        for(std::size_t i = next++; i < subtrees.size(); i = next++)
+        {
+            Task task = subtrees[i];
+            subtreeNodes[i].reserve((task.end - task.begin) * 2);
+            subtreeNodes[i].push_back(nodes[task.node]);
+            task.node = 0;
+
+            BuildSubtree(references, subtreeNodes[i], task);
+        }
+    });
+
+    //Appended after the top so children still come after their parents, the
+    //root of every subtree replaces its node in the top levels
+    std::vector<std::size_t> offsets(subtrees.size() + 1, nodes.size());
+    for(std::size_t i = 0; i < subtrees.size(); ++i)
+    {
+        offsets[i + 1] = offsets[i] + subtreeNodes[i].size() - 1;
+    }
+
+    nodes.resize(offsets.back());
+    next = 0;
+    math::ParallelFor(threadCount, threadCount, [&](uint32_t, std::size_t, std::size_t)
+    {
+        for(std::size_t i = next++; i < subtrees.size(); i = next++)
+        {
+            const std::vector<Node>& subtree = subtreeNodes[i];
+            uint32_t offset                  = static_cast<uint32_t>(offsets[i]) - 1;
+
+            for(std::size_t j = 0; j < subtree.size(); ++j)
+            {
+                Node node = subtree[j];
+                if(node.count == 0)
+                {
+                    node.first += offset;
+                }
+
+                nodes[j == 0 ? subtrees[i].node : offset + j] = node;
+            }
+        }
+    });
+}
+
+//Slab test of the ray against every lane, returns the mask of lanes entered
+//before maxDistance and their entry distances
+uint32_t IntersectLanes(const WideNode& node, const math::Vec3& origin, const math::Vec3& invDirection,
+    float maxDistance, float* distances)
+{
+    uint32_t valid = (1u << node.childCount) - 1;
+
+#if MATH_SIMD_SSE
+    using namespace math::simd;
+
+    Pack tMin = ZeroPack();
+    Pack tMax = SetPack(maxDistance);
+    IntersectSlab(SetPack(origin.x), SetPack(invDirection.x), LoadPack(node.minX), LoadPack(node.maxX), tMin, tMax);
+    IntersectSlab(SetPack(origin.y), SetPack(invDirection.y), LoadPack(node.minY), LoadPack(node.maxY), tMin, tMax);
+    IntersectSlab(SetPack(origin.z), SetPack(invDirection.z), LoadPack(node.minZ), LoadPack(node.maxZ), tMin, tMax);
+
+    StorePackUnaligned(distances, tMin);
+    return static_cast<uint32_t>(MoveMask(GreaterEqual(tMax, tMin))) & valid;
+#else
+    uint32_t mask = 0;
+
+    for(uint32_t i = 0; i < node.childCount; ++i)
+    {
+        math::Vec3 min(node.minX[i], node.minY[i], node.minZ[i]);
+        math::Vec3 max(node.maxX[i], node.maxY[i], node.maxZ[i]);
+
+        if(math::detail::IntersectSlabs(origin, invDirection, min, max, distances[i]) && distances[i] <= maxDistance)
+        {
+            mask |= 1u << i;
+        }
+    }
+
+    return mask & valid;
+#endif
+}
+
+//Squared distance from point to every lane, returns the mask of lanes within
+//maxDistanceSquared
+uint32_t DistanceLanes(const WideNode& node, const math::Vec3& point, float maxDistanceSquared, float* distances)
+{
+    uint32_t valid = (1u << node.childCount) - 1;
+
+#if MATH_SIMD_SSE
+    using namespace math::simd;
+
+    Pack px = SetPack(point.x);
+    Pack py = SetPack(point.y);
+    Pack pz = SetPack(point.z);
+    Pack dx = Max(Max(Sub(LoadPack(node.minX), px), Sub(px, LoadPack(node.maxX))), ZeroPack());
+    Pack dy = Max(Max(Sub(LoadPack(node.minY), py), Sub(py, LoadPack(node.maxY))), ZeroPack());
+    Pack dz = Max(Max(Sub(LoadPack(node.minZ), pz), Sub(pz, LoadPack(node.maxZ))), ZeroPack());
+    Pack d2 = MulAdd(dz, dz, MulAdd(dy, dy, Mul(dx, dx)));
+
+    StorePackUnaligned(distances, d2);
+    return static_cast<uint32_t>(MoveMask(GreaterEqual(SetPack(maxDistanceSquared), d2))) & valid;
+#else
+    uint32_t mask = 0;
+
+    for(uint32_t i = 0; i < node.childCount; ++i)
+    {
+        math::Vec3 min(node.minX[i], node.minY[i], node.minZ[i]);
+        math::Vec3 max(node.maxX[i], node.maxY[i], node.maxZ[i]);
+        math::AABB3 box(min, max);
+
+        distances[i] = (box.GetClosestPoint(point) - point).LengthSquared();
+        if(distances[i] <= maxDistanceSquared)
+        {
+            mask |= 1u << i;
+        }
+    }
+
+    return mask & valid;
+#endif
+}
+
+//Lanes of mask sorted by increasing distance, returns their count
+uint32_t SortLanes(uint32_t mask, const float* distances, uint32_t* lanes)
+{
+    uint32_t count = 0;
+
+    for(; mask != 0; mask &= mask - 1)
+    {
+        uint32_t lane = static_cast<uint32_t>(std::countr_zero(mask));
+        uint32_t i    = count++;
+
+        for(; i > 0 && distances[lanes[i - 1]] > distances[lane]; --i)
+        {
+            lanes[i] = lanes[i - 1];
+        }
+        lanes[i] = lane;
+    }
+
+    return count;
+}
+
+} //namespace
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(uint32_t threadCount) :
+    m_threadCount{math::ResolveThreadCount(threadCount)}
+{
+}
+
+template<typename BoundsFunc>
+void BoundingVolumeHierarchy::BuildFromBounds(std::size_t count, const BoundsFunc& getBounds)
+{
+    m_nodes.clear();
+    m_wideNodes.clear();
+    m_wideSources.clear();
+
+    if(count == 0)
+    {
+        m_primitives.clear();
+        return;
+    }
+
+    //References and the bounds of the root
+    std::vector<Reference> references(count);
+    std::vector<math::AABB3> rootBounds(m_threadCount, math::AABB3::CreateEmpty());
+    std::vector<math::AABB3> rootCentroids(m_threadCount, math::AABB3::CreateEmpty());
+    math::ParallelFor(m_threadCount, count, [&](uint32_t thread, std::size_t begin, std::size_t end)
+    {
+        Box box      = Box::CreateEmpty();
+        Box centroid = Box::CreateEmpty();
+
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            references[i] = Reference{getBounds(i), static_cast<uint32_t>(i)};
+
+            Box bounds = Box::Load(references[i].bounds);
+            box        = box.GetMerged(bounds);
+            centroid   = centroid.GetMerged(bounds.GetCenter());
+        }
+
+        rootBounds[thread]    = box.ToAABB();
+        rootCentroids[thread] = centroid.ToAABB();
+    });
+
+    math::AABB3 box      = math::AABB3::CreateEmpty();
+    math::AABB3 centroid = math::AABB3::CreateEmpty();
+    for(uint32_t i = 0; i < m_threadCount; ++i)
+    {
+        box      = box.GetMerged(rootBounds[i]);
+        centroid = centroid.GetMerged(rootCentroids[i]);
+    }
+
+    m_nodes.reserve(count * 2);
+    m_nodes.push_back(Node{box.min, 0, box.max, 0});
+
+    Task root {0, 0, static_cast<uint32_t>(count), 0, centroid};
+
+    if(m_threadCount == 1)
+    {
+        BuildSubtree(references, m_nodes, root);
+    }
+    else
+    {
+        BuildSubtrees(references, m_nodes, root, m_threadCount);
+    }
+
+    m_primitives.resize(references.size());
+    math::ParallelFor(m_threadCount, references.size(), [&](uint32_t, std::size_t begin, std::size_t end)
+    {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            m_primitives[i] = references[i].primitive;
+        }
+    });
+
+    Collapse();
+}
+
+void BoundingVolumeHierarchy::Build(std::span<const math::AABB3> bounds)
+{
+    BuildFromBounds(bounds.size(), [&](std::size_t i) { return bounds[i]; });
+}
+
+void BoundingVolumeHierarchy::Build(std::span<const math::Triangle3> triangles)
+{
+    BuildFromBounds(triangles.size(), [&](std::size_t i) { return triangles[i].GetBounds(); });
+}
+
+//Children always come after their parent, so a reverse pass sees every
+//child before its parent
+void BoundingVolumeHierarchy::Refit(std::span<const math::AABB3> bounds)
+{
+    assert(bounds.size() == m_primitives.size());
+
+    for(std::size_t i = m_nodes.size(); i-- > 0;)
+    {
+        Node& node = m_nodes[i];
+        math::AABB3 box {};
+
+        if(node.count == 0)
+        {
+            box = MergeNodes(m_nodes[node.first], m_nodes[node.first + 1]);
+        }
+        else
+        {
+            box = math::AABB3::CreateEmpty();
+            for(uint32_t j = node.first; j < node.first + node.count; ++j)
+            {
+                box = box.GetMerged(bounds[m_primitives[j]]);
+            }
+        }
+
+        node.min = box.min;
+        node.max = box.max;
+    }
+
+    RefitWideNodes();
+}
+
+void BoundingVolumeHierarchy::Refit(std::span<const math::Triangle3> triangles)
+{
+    assert(triangles.size() == m_primitives.size());
+
+    for(std::size_t i = m_nodes.size(); i-- > 0;)
+    {
+        Node& node = m_nodes[i];
+        math::AABB3 box {};
+
+        if(node.count == 0)
+        {
+            box = MergeNodes(m_nodes[node.first], m_nodes[node.first + 1]);
+        }
+        else
+        {
+            box = math::AABB3::CreateEmpty();
+            for(uint32_t j = node.first; j < node.first + node.count; ++j)
+            {
+                box = box.GetMerged(triangles[m_primitives[j]].GetBounds());
+            }
+        }
+
+        node.min = box.min;
+        node.max = box.max;
+    }
+
+    RefitWideNodes();
+}
+
+BoundingVolumeHierarchy::RayHit BoundingVolumeHierarchy::IntersectRay(const math::Ray3& ray,
+    std::span<const math::Triangle3> triangles, float maxDistance) const
+{
+    RayHit hit {};
+    hit.distance = maxDistance;
+
+    if(m_wideNodes.empty())
+    {
+        return hit;
+    }
+
+    math::Vec3 invDirection(1 / ray.direction.x, 1 / ray.direction.y, 1 / ray.direction.z);
+    std::array<StackEntry, StackSize> stack;
+    std::size_t size = 0;
+    stack[size++]    = StackEntry{0, 0};
+
+    while(size > 0)
+    {
+        StackEntry entry = stack[--size];
+        if(entry.distance > hit.distance)
+        {
+            continue;
+        }
+
+        const WideNode& node = m_wideNodes[entry.node];
+        alignas(32) float distances[Width];
+        uint32_t lanes[Width];
+        uint32_t count = SortLanes(IntersectLanes(node, ray.origin, invDirection, hit.distance, distances),
+            distances, lanes);
+
+        //Leaves are tested right away so they can shorten the ray before the
+        //nodes are pushed, the nearest node is pushed last
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t lane = lanes[i];
+            if(node.counts[lane] == 0 || distances[lane] > hit.distance)
+            {
+                continue;
+            }
+
+            for(uint32_t j = node.children[lane]; j < node.children[lane] + node.counts[lane]; ++j)
+            {
+                uint32_t primitive = m_primitives[j];
+                float distance {};
+                math::Vec2 barycentric {};
+
+                if(ray.IntersectsTriangle(triangles[primitive], distance, barycentric) && distance < hit.distance)
+                {
+                    hit.primitive   = primitive;
+                    hit.distance    = distance;
+                    hit.barycentric = barycentric;
+                }
+            }
+        }
+
+        for(uint32_t i = count; i-- > 0;)
+        {
+            uint32_t lane = lanes[i];
+            if(node.counts[lane] == 0 && distances[lane] <= hit.distance)
+            {
+                stack[size++] = StackEntry{node.children[lane], distances[lane]};
+            }
+        }
+    }
+
+    if(hit.primitive == InvalidPrimitive)
+    {
+        hit.distance = std::numeric_limits<float>::infinity();
+    }
+
+    return hit;
+}
+
+void BoundingVolumeHierarchy::QuerySphere(const math::Sphere3& sphere, std::span<const math::AABB3> bounds,
+    std::vector<uint32_t>& primitives) const
+{
+    TraverseSphere(sphere.center, sphere.radius * sphere.radius, [&](uint32_t first, uint32_t count)
+    {
+        for(uint32_t i = first; i < first + count; ++i)
+        {
+            if(sphere.IntersectsAABB(bounds[m_primitives[i]]))
+            {
+                primitives.push_back(m_primitives[i]);
+            }
+        }
+    });
+}
+
+void BoundingVolumeHierarchy::QuerySphere(const math::Sphere3& sphere, std::span<const math::Triangle3> triangles,
+    std::vector<uint32_t>& primitives) const
+{
+    float radiusSquared = sphere.radius * sphere.radius;
+
+    TraverseSphere(sphere.center, radiusSquared, [&](uint32_t first, uint32_t count)
+    {
+        for(uint32_t i = first; i < first + count; ++i)
+        {
+            math::Vec3 closest = triangles[m_primitives[i]].GetClosestPoint(sphere.center);
+            if((closest - sphere.center).LengthSquared() <= radiusSquared)
+            {
+                primitives.push_back(m_primitives[i]);
+            }
+        }
+    });
+}
+
+//Nearest boxes first, anything farther than the best point so far is skipped
+BoundingVolumeHierarchy::PointHit BoundingVolumeHierarchy::GetClosestPoint(const math::Vec3& point,
+    std::span<const math::Triangle3> triangles, float maxDistance) const
+{
+    PointHit hit {};
+
+    if(m_wideNodes.empty())
+    {
+        return hit;
+    }
+
+    float best = maxDistance * maxDistance;
+    std::array<StackEntry, StackSize> stack;
+    std::size_t size = 0;
+    stack[size++]    = StackEntry{0, 0};
+
+    while(size > 0)
+    {
+        StackEntry entry = stack[--size];
+        if(entry.distance > best)
+        {
+            continue;
+        }
+
+        const WideNode& node = m_wideNodes[entry.node];
+        alignas(32) float distances[Width];
+        uint32_t lanes[Width];
+        uint32_t count = SortLanes(DistanceLanes(node, point, best, distances), distances, lanes);
+
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t lane = lanes[i];
+            if(node.counts[lane] == 0 || distances[lane] > best)
+            {
+                continue;
+            }
+
+            for(uint32_t j = node.children[lane]; j < node.children[lane] + node.counts[lane]; ++j)
+            {
+                uint32_t primitive = m_primitives[j];
+                math::Vec3 closest = triangles[primitive].GetClosestPoint(point);
+                float distance     = (closest - point).LengthSquared();
+
+                if(distance <= best)
+                {
+                    best          = distance;
+                    hit.primitive = primitive;
+                    hit.point     = closest;
+                }
+            }
+        }
+
+        for(uint32_t i = count; i-- > 0;)
+        {
+            uint32_t lane = lanes[i];
+            if(node.counts[lane] == 0 && distances[lane] <= best)
+            {
+                stack[size++] = StackEntry{node.children[lane], distances[lane]};
+            }
+        }
+    }
+
+    if(hit.primitive != InvalidPrimitive)
+    {
+        hit.distance = math::Sqrt(best);
+    }
+
+    return hit;
+}
+
+math::AABB3 BoundingVolumeHierarchy::GetBounds() const
+{
+    if(m_nodes.empty())
+    {
+        return math::AABB3::CreateEmpty();
+    }
+
+    return math::AABB3(m_nodes[0].min, m_nodes[0].max);
+}
+
+void BoundingVolumeHierarchy::Collapse()
+{
+    m_wideNodes.reserve(m_nodes.size() / 2 + 1);
+    m_wideSources.reserve((m_nodes.size() / 2 + 1) * Width);
+
+    CollapseNode(0);
+}
+
+//Opens the interior child with the largest surface area until the node is
+//full, so the wide node keeps the boxes a ray is most likely to enter
+uint32_t BoundingVolumeHierarchy::CollapseNode(uint32_t node)
+{
+    uint32_t sources[Width] {};
+    uint32_t count = 0;
+
+    if(m_nodes[node].count != 0)
+    {
+        sources[count++] = node;
+    }
+    else
+    {
+        sources[count++] = m_nodes[node].first;
+        sources[count++] = m_nodes[node].first + 1;
+    }
+
+    while(count < Width)
+    {
+        uint32_t largest  = Width;
+        float largestArea = -1;
+
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            const Node& child = m_nodes[sources[i]];
+            float area        = math::AABB3(child.min, child.max).GetSurfaceArea();
+
+            if(child.count == 0 && area > largestArea)
+            {
+                largest     = i;
+                largestArea = area;
+            }
+        }
+
+        if(largest == Width)
+        {
+            break;
+        }
+
+        uint32_t first   = m_nodes[sources[largest]].first;
+        sources[largest] = first;
+        sources[count++] = first + 1;
+    }
+
+    uint32_t index = static_cast<uint32_t>(m_wideNodes.size());
+    m_wideNodes.push_back(WideNode{});
+    m_wideSources.insert(m_wideSources.end(), sources, sources + Width);
+    m_wideNodes[index].childCount = count;
+
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        const Node& child = m_nodes[sources[i]];
+        uint32_t target   = child.count == 0 ? CollapseNode(sources[i]) : child.first;
+
+        //The recursion may reallocate the wide nodes
+        WideNode& wide   = m_wideNodes[index];
+        wide.children[i] = target;
+        wide.counts[i]   = static_cast<uint8_t>(child.count);
+    }
+
+    RefitWideNode(index);
+    return index;
+}
+
+void BoundingVolumeHierarchy::RefitWideNodes()
+{
+    for(uint32_t i = 0; i < m_wideNodes.size(); ++i)
+    {
+        RefitWideNode(i);
+    }
+}
+
+//Copies the boxes of the binary nodes the lanes were collapsed from
+void BoundingVolumeHierarchy::RefitWideNode(uint32_t node)
+{
+    WideNode& wide          = m_wideNodes[node];
+    const uint32_t* sources = m_wideSources.data() + node * Width;
+
+    for(uint32_t i = 0; i < wide.childCount; ++i)
+    {
+        const Node& source = m_nodes[sources[i]];
+        wide.minX[i] = source.min.x;
+        wide.minY[i] = source.min.y;
+        wide.minZ[i] = source.min.z;
+        wide.maxX[i] = source.max.x;
+        wide.maxY[i] = source.max.y;
+        wide.maxZ[i] = source.max.z;
+    }
+}
+
+template<typename Func>
+void BoundingVolumeHierarchy::TraverseSphere(const math::Vec3& center, float radiusSquared, const Func& visit) const
+{
+    if(m_wideNodes.empty())
+    {
+        return;
+    }
+
+    std::array<uint32_t, StackSize> stack;
+    std::size_t size = 0;
+    stack[size++]    = 0;
+
+    while(size > 0)
+    {
+        const WideNode& node = m_wideNodes[stack[--size]];
+        alignas(32) float distances[Width];
+
+        for(uint32_t mask = DistanceLanes(node, center, radiusSquared, distances); mask != 0; mask &= mask - 1)
+        {
+            uint32_t lane = static_cast<uint32_t>(std::countr_zero(mask));
+
+            if(node.counts[lane] == 0)
+            {
+                stack[size++] = node.children[lane];
+            }
+            else
+            {
+                visit(node.children[lane], node.counts[lane]);
+            }
+        }
+    }
+}
+
+} //namespace scene
@@ -0,0 +1,169 @@
+#include <engine/scene/SpatialSort.hpp>
+#include <algorithm>
+#include <barrier>
+#include <numeric>
+#include <engine/math/Parallel.hpp>
+#include <engine/math/spatial/Morton.hpp>
+
+namespace scene
+{
+
+namespace
+{
+
+//11 bit digits sort 32 bit keys in 3 passes with histograms that fit in L1
+constexpr uint32_t DigitBits   = 11;
+constexpr uint32_t BucketCount = 1u << DigitBits;
+constexpr uint32_t PassCount   = (32 + DigitBits - 1) / DigitBits;
+
+} //namespace
+
+SpatialSort::SpatialSort(uint32_t threadCount) : m_threadCount{math::ResolveThreadCount(threadCount)}
+{
+}
+
+void SpatialSort::Sort(std::span<const math::Vec3> positions)
+{
+    math::AABB3 bounds(math::Vec3(0), math::Vec3(0));
+
+    if(!positions.empty())
+    {
+        bounds = math::AABB3(positions[0], positions[0]);
+        for(const math::Vec3& position : positions)
+        {
+            bounds = bounds.GetMerged(position);
+        }
+    }
+
+    Sort(positions, bounds);
+}
+
+void SpatialSort::Sort(std::span<const math::Vec3> positions, const math::AABB3& bounds)
+{
+    m_keys.resize(positions.size());
+
+    uint32_t threadCount = static_cast<uint32_t>(std::clamp<std::size_t>(positions.size() / m_MinElementsPerThread,
+        1, m_threadCount));
+    math::ParallelFor(threadCount, positions.size(), [&](uint32_t, std::size_t begin, std::size_t end)
+    {
+        math::EncodeMorton<uint32_t>(positions.subspan(begin, end - begin), bounds,
+            std::span(m_keys).subspan(begin, end - begin));
+    });
+
+    SortKeys();
+}
+
+void SpatialSort::Sort(std::span<const math::Vec2> positions, const math::Vec2& min, const math::Vec2& max)
+{
+    m_keys.resize(positions.size());
+
+    uint32_t threadCount = static_cast<uint32_t>(std::clamp<std::size_t>(positions.size() / m_MinElementsPerThread,
+        1, m_threadCount));
+    math::ParallelFor(threadCount, positions.size(), [&](uint32_t, std::size_t begin, std::size_t end)
+    {
+        math::EncodeMorton<uint32_t>(positions.subspan(begin, end - begin), min, max,
+            std::span(m_keys).subspan(begin, end - begin));
+    });
+
+    SortKeys();
+}
+
+void SpatialSort::Sort(std::span<const uint32_t> keys)
+{
+    m_keys.assign(keys.begin(), keys.end());
+    SortKeys();
+}
+
+//Least significant digit radix sort, each pass counts the digits of every
+//thread's chunk, turns the counts into offsets (digit major, thread minor so
+//the scatter is stable) and scatters into the other buffer. Passes where every
+//key has the same digit are skipped
+void SpatialSort::SortKeys()
+{
+    std::size_t count    = m_keys.size();
+    uint32_t threadCount = static_cast<uint32_t>(std::clamp<std::size_t>(count / m_MinElementsPerThread,
+        1, m_threadCount));
+
+    m_order.resize(count);
+    m_scratchKeys.resize(count);
+    m_scratchOrder.resize(count);
+    m_histograms.resize(static_cast<std::size_t>(threadCount) * BucketCount);
+
+    uint32_t* keys         = m_keys.data();
+    uint32_t* order        = m_order.data();
+    uint32_t* scratchKeys  = m_scratchKeys.data();
+    uint32_t* scratchOrder = m_scratchOrder.data();
+    uint32_t shift         = 0;
+    bool skip              = false;
+
+    auto computeOffsets = [&]() noexcept
+    {
+        std::size_t offset = 0;
+        skip               = false;
+
+        for(uint32_t bucket = 0; bucket < BucketCount; ++bucket)
+        {
+            std::size_t begin = offset;
+            for(uint32_t thread = 0; thread < threadCount; ++thread)
+            {
+                std::size_t& histogram = m_histograms[thread * BucketCount + bucket];
+                std::size_t digitCount = histogram;
+                histogram              = offset;
+                offset                += digitCount;
+            }
+
+            skip = skip || offset - begin == count;
+        }
+    };
+
+    auto finishPass = [&]() noexcept
+    {
+        if(!skip)
+        {
+            std::swap(keys, scratchKeys);
+            std::swap(order, scratchOrder);
+        }
+        shift += DigitBits;
+    };
+
+    std::barrier offsetsBarrier(static_cast<std::ptrdiff_t>(threadCount), computeOffsets);
+    std::barrier passBarrier(static_cast<std::ptrdiff_t>(threadCount), finishPass);
+
+    math::ParallelFor(threadCount, count, [&](uint32_t thread, std::size_t begin, std::size_t end)
+    {
+        std::iota(order + begin, order + end, static_cast<uint32_t>(begin));
+        std::size_t* histogram = m_histograms.data() + thread * BucketCount;
+
+        for(uint32_t pass = 0; pass < PassCount; ++pass)
+        {
+            std::fill(histogram, histogram + BucketCount, 0);
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                histogram[(keys[i] >> shift) & (BucketCount - 1)]++;
+            }
+
+            offsetsBarrier.arrive_and_wait();
+
+            if(!skip)
+            {
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    std::size_t& offset  = histogram[(keys[i] >> shift) & (BucketCount - 1)];
+                    scratchKeys[offset]  = keys[i];
+                    scratchOrder[offset] = order[i];
+                    ++offset;
+                }
+            }
+
+            passBarrier.arrive_and_wait();
+        }
+    });
+
+    if(keys != m_keys.data())
+    {
+        m_keys.swap(m_scratchKeys);
+        m_order.swap(m_scratchOrder);
+    }
+}
+
+} //namespace scene
@@ -0,0 +1,308 @@
+#include <engine/scene/TransformHierarchy.hpp>
+#include <algorithm>
+#include <cassert>
+#include <engine/math/Parallel.hpp>
+#include <engine/math/simd/Matrix4Simd.hpp>
+
+namespace scene
+{
+
+TransformHierarchy::TransformHierarchy(uint32_t threadCount) : 
+    m_barrier(static_cast<std::ptrdiff_t>(math::ResolveThreadCount(threadCount)))
+{
+    uint32_t workerCount = math::ResolveThreadCount(threadCount) - 1;
+    m_workers.reserve(workerCount);
+
+    for(uint32_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&TransformHierarchy::WorkerLoop, this, i + 1);
+    }
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+    if(!m_workers.empty())
+    {
+        m_stop = true;
+        m_barrier.arrive_and_wait();
+
+        for(std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+}
+
+TransformHierarchy::NodeId TransformHierarchy::AddNode(NodeId parent, const math::Vec3& scale, 
+    const math::Quat& rotation, const math::Vec3& translation)
+{
+    assert(parent == InvalidNode || static_cast<std::size_t>(parent) < m_indices.size());
+
+    NodeId id           = static_cast<NodeId>(m_indices.size());
+    int32_t parentIndex = parent == InvalidNode ? -1 : static_cast<int32_t>(m_indices[parent]);
+    uint32_t level      = parent == InvalidNode ? 0 : m_levels[parentIndex] + 1;
+
+    //Appending keeps the breadth first order as long as the node does not go
+    //before the last one, either by level or by parent
+    if(!m_levels.empty() && (level < m_levels.back() || (level == m_levels.back() && parentIndex < m_parents.back())))
+    {
+        m_needsSort = true;
+    }
+
+    m_indices.push_back(static_cast<uint32_t>(m_parents.size()));
+    m_parents.push_back(parentIndex);
+    m_levels.push_back(level);
+    m_ids.push_back(id);
+    m_scales.push_back(scale);
+    m_rotations.push_back(rotation);
+    m_translations.push_back(translation);
+    m_worlds.emplace_back();
+    m_dirty.push_back(1);
+    m_anyDirty = true;
+
+    return id;
+}
+
+void TransformHierarchy::Reserve(std::size_t count)
+{
+    m_parents.reserve(count);
+    m_levels.reserve(count);
+    m_ids.reserve(count);
+    m_scales.reserve(count);
+    m_rotations.reserve(count);
+    m_translations.reserve(count);
+    m_worlds.reserve(count);
+    m_dirty.reserve(count);
+    m_indices.reserve(count);
+}
+
+void TransformHierarchy::SetScale(NodeId node, const math::Vec3& scale)
+{
+    m_scales[m_indices[node]] = scale;
+    MarkDirty(node);
+}
+
+void TransformHierarchy::SetRotation(NodeId node, const math::Quat& rotation)
+{
+    m_rotations[m_indices[node]] = rotation;
+    MarkDirty(node);
+}
+
+void TransformHierarchy::SetTranslation(NodeId node, const math::Vec3& translation)
+{
+    m_translations[m_indices[node]] = translation;
+    MarkDirty(node);
+}
+
+void TransformHierarchy::SetLocal(NodeId node, const math::Vec3& scale, const math::Quat& rotation, 
+    const math::Vec3& translation)
+{
+    uint32_t index = m_indices[node];
+    m_scales[index]       = scale;
+    m_rotations[index]    = rotation;
+    m_translations[index] = translation;
+    MarkDirty(node);
+}
+
+TransformHierarchy::NodeId TransformHierarchy::GetParent(NodeId node) const
+{
+    int32_t parentIndex = m_parents[m_indices[node]];
+
+    return parentIndex < 0 ? InvalidNode : m_ids[parentIndex];
+}
+
+void TransformHierarchy::Update()
+{
+    if(m_needsSort || m_levelOffsets.back() != m_parents.size())
+    {
+        Sort();
+    }
+
+    if(!m_anyDirty)
+    {
+        return;
+    }
+
+    //Small hierarchies are not worth waking the workers
+    if(m_workers.empty() || m_parents.size() < m_MinNodesPerThread * 2)
+    {
+        UpdateRange(0, m_parents.size());
+    }
+    else
+    {
+        m_barrier.arrive_and_wait();
+        UpdateLevels(0, static_cast<uint32_t>(m_workers.size() + 1));
+    }
+
+    std::fill(m_dirty.begin(), m_dirty.end(), 0);
+    m_anyDirty = false;
+}
+
+//Breadth first traversal from the roots, so children of the same parent are
+//contiguous and every level reads its parents in increasing order
+void TransformHierarchy::Sort()
+{
+    uint32_t levelCount = m_levels.empty() ? 0 : *std::max_element(m_levels.begin(), m_levels.end()) + 1;
+
+    m_levelOffsets.assign(levelCount + 1, 0);
+    for(uint32_t level : m_levels)
+    {
+        m_levelOffsets[level + 1]++;
+    }
+    for(uint32_t i = 0; i < levelCount; ++i)
+    {
+        m_levelOffsets[i + 1] += m_levelOffsets[i];
+    }
+
+    if(!m_needsSort)
+    {
+        return;
+    }
+
+    //Children of every node as a compressed adjacency list
+    std::size_t count = m_parents.size();
+    std::vector<uint32_t> childOffsets(count + 1, 0);
+    std::vector<uint32_t> children(count);
+    for(int32_t parent : m_parents)
+    {
+        if(parent >= 0)
+        {
+            childOffsets[parent + 1]++;
+        }
+    }
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        childOffsets[i + 1] += childOffsets[i];
+    }
+
+    std::vector<uint32_t> cursor(childOffsets.begin(), childOffsets.end() - 1);
+    std::vector<uint32_t> order {};
+    order.reserve(count);
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        if(m_parents[i] >= 0)
+        {
+            children[cursor[m_parents[i]]++] = i;
+        }
+        else
+        {
+            order.push_back(i);
+        }
+    }
+
+    for(std::size_t head = 0; head < order.size(); ++head)
+    {
+        uint32_t node = order[head];
+        order.insert(order.end(), children.begin() + childOffsets[node], children.begin() + childOffsets[node + 1]);
+    }
+
+    //Parents are stored as ids while the arrays are permuted, order maps
+    //new index -> old index
+    for(int32_t& parent : m_parents)
+    {
+        if(parent >= 0)
+        {
+            parent = m_ids[parent];
+        }
+    }
+
+    auto permute = [&order](auto& values)
+    {
+        auto sorted = values;
+        for(std::size_t i = 0; i < order.size(); ++i)
+        {
+            sorted[i] = values[order[i]];
+        }
+        values = std::move(sorted);
+    };
+
+    permute(m_levels);
+    permute(m_ids);
+    permute(m_scales);
+    permute(m_rotations);
+    permute(m_translations);
+    permute(m_worlds);
+    permute(m_dirty);
+    permute(m_parents);
+
+    for(uint32_t i = 0; i < m_ids.size(); ++i)
+    {
+        m_indices[m_ids[i]] = i;
+    }
+    for(int32_t& parent : m_parents)
+    {
+        if(parent >= 0)
+        {
+            parent = static_cast<int32_t>(m_indices[parent]);
+        }
+    }
+
+    m_needsSort = false;
+}
+
+void TransformHierarchy::WorkerLoop(uint32_t thread)
+{
+    while(true)
+    {
+        m_barrier.arrive_and_wait();
+        if(m_stop)
+        {
+            return;
+        }
+
+        UpdateLevels(thread, static_cast<uint32_t>(m_workers.size() + 1));
+    }
+}
+
+//Every thread takes a contiguous chunk of each level and waits for the others
+//before moving on to the next level
+void TransformHierarchy::UpdateLevels(uint32_t thread, uint32_t threadCount)
+{
+    for(std::size_t level = 0; level + 1 < m_levelOffsets.size(); ++level)
+    {
+        std::size_t levelBegin = m_levelOffsets[level];
+        std::size_t levelEnd   = m_levelOffsets[level + 1];
+        std::size_t chunk      = std::max((levelEnd - levelBegin + threadCount - 1) / threadCount, m_MinNodesPerThread);
+        std::size_t begin      = std::min(levelBegin + chunk * thread, levelEnd);
+        std::size_t end        = std::min(begin + chunk, levelEnd);
+
+        UpdateRange(begin, end);
+        m_barrier.arrive_and_wait();
+    }
+}
+
+void TransformHierarchy::UpdateRange(std::size_t begin, std::size_t end)
+{
+    for(std::size_t i = begin; i < end; ++i)
+    {
+        int32_t parent = m_parents[i];
+
+        if(!m_dirty[i] && (parent < 0 || !m_dirty[parent]))
+        {
+            continue;
+        }
+
+        m_dirty[i] = 1;
+
+        if(parent < 0)
+        {
+            m_worlds[i] = math::Mat4::CreateTransform(m_scales[i], m_rotations[i], m_translations[i]);
+            continue;
+        }
+
+#if MATH_SIMD_SSE
+        math::simd::Matrix4ComposeTransform(m_worlds[parent].arr, &m_scales[i].x, &m_rotations[i].x, 
+            &m_translations[i].x, m_worlds[i].arr);
+#else
+        m_worlds[i] = m_worlds[parent] * math::Mat4::CreateTransform(m_scales[i], m_rotations[i], m_translations[i]);
+#endif
+    }
+}
+
+void TransformHierarchy::MarkDirty(NodeId node)
+{
+    m_dirty[m_indices[node]] = 1;
+    m_anyDirty = true;
+}
+
+} //namespace scene
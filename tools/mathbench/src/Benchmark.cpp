@@ -0,0 +1,68 @@
+#include "Benchmark.hpp"
+
+namespace bench
+{
+
+Runner::Runner(std::size_t elements, std::chrono::nanoseconds sampleTime, std::string filter) : 
+    m_elements{elements}, m_sampleTime{sampleTime}, m_filter{std::move(filter)} { }
+
+nlohmann::json Runner::ToJson() const
+{
+    nlohmann::json data = nlohmann::json::array();
+
+    for(const Result& result : m_results)
+    {
+        data.push_back({
+            {"name",      result.name},
+            {"type",      result.type},
+            {"mode",      result.mode},
+            {"ns_per_op", result.nsPerOp},
+            {"gflops",    result.gflops}
+        });
+    }
+
+    return data;
+}
+
+bool Runner::Passed() const
+{
+    return std::ranges::all_of(m_validations, [](const Validation& validation) 
+    { 
+        return validation.maxError <= validation.tolerance; 
+    });
+}
+
+nlohmann::json Runner::ValidationsToJson() const
+{
+    nlohmann::json data = nlohmann::json::array();
+
+    for(const Validation& validation : m_validations)
+    {
+        data.push_back({
+            {"name",      validation.name},
+            {"type",      validation.type},
+            {"max_error", validation.maxError},
+            {"tolerance", validation.tolerance},
+            {"passed",    validation.maxError <= validation.tolerance}
+        });
+    }
+
+    return data;
+}
+
+bool Runner::Matches(const std::string& name) const
+{
+    return m_filter.empty() || name.find(m_filter) != std::string::npos;
+}
+
+void Runner::AddResult(const std::string& name, const std::string& type, const std::string& mode, 
+    double flopsPerOp, std::size_t operations, std::chrono::nanoseconds best, std::size_t iterations)
+{
+    double total   = static_cast<double>(iterations) * static_cast<double>(operations);
+    double nsPerOp = static_cast<double>(best.count()) / total;
+
+    //flop / ns is GFLOP/s
+    m_results.push_back(Result{name, type, mode, nsPerOp, flopsPerOp / nsPerOp});
+}
+
+} //namespace bench
@@ -0,0 +1,227 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace bench
+{
+
+//Keeps the compiler from optimising away the computation of value
+template<typename T>
+inline void DoNotOptimize(T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+m"(value) : : "memory");
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<volatile char*>(&value);
+#endif
+}
+
+struct Result
+{
+    std::string name;
+    std::string type;
+    std::string mode;
+    double nsPerOp;
+    double gflops;
+};
+
+struct Validation
+{
+    std::string name;
+    std::string type;
+    double maxError;
+    double tolerance;
+};
+
+//Times operations over a fixed number of elements. Every benchmark function
+//processes Elements() operations per call, the reported time is the fastest of
+//several samples divided by the number of operations
+class Runner
+{
+public:
+    Runner(std::size_t elements, std::chrono::nanoseconds sampleTime, std::string filter);
+
+    //flopsPerOp is the nominal number of arithmetic operations (add, mul, div,
+    //sqrt) in the scalar formulation of one operation
+    template<typename Func>
+    void Run(const std::string& name, const std::string& type, const std::string& mode, 
+        double flopsPerOp, Func&& func);
+    //For functions that process a fixed number of operations instead of Elements()
+    template<typename Func>
+    void Run(const std::string& name, const std::string& type, const std::string& mode, 
+        double flopsPerOp, std::size_t operations, Func&& func);
+
+    //Checks results against a reference computation, func returns the largest
+    //error. Filtered like the benchmarks, failures make the run exit with 1
+    template<typename Func>
+    void Validate(const std::string& name, const std::string& type, double tolerance, Func&& func);
+
+    std::size_t Elements() const { return m_elements; }
+    bool Passed() const;
+    nlohmann::json ToJson() const;
+    nlohmann::json ValidationsToJson() const;
+
+private:
+    bool Matches(const std::string& name) const;
+    void AddResult(const std::string& name, const std::string& type, const std::string& mode, 
+        double flopsPerOp, std::size_t operations, std::chrono::nanoseconds best, std::size_t iterations);
+
+private:
+    inline static constexpr int32_t m_SampleCount {5};
+
+    std::size_t m_elements;
+    std::chrono::nanoseconds m_sampleTime;
+    std::string m_filter;
+    std::vector<Result> m_results {};
+    std::vector<Validation> m_validations {};
+};
+
+template<typename Func>
+void Runner::Run(const std::string& name, const std::string& type, const std::string& mode, 
+    double flopsPerOp, Func&& func)
+{
+    Run(name, type, mode, flopsPerOp, m_elements, std::forward<Func>(func));
+}
+
+template<typename Func>
+void Runner::Run(const std::string& name, const std::string& type, const std::string& mode, 
+    double flopsPerOp, std::size_t operations, Func&& func)
+{
+    using Clock = std::chrono::steady_clock;
+
+    if(!Matches(name))
+        return;
+
+    //Warm up and find how many iterations fill a sample
+    std::size_t iterations = 1;
+    while(true)
+    {
+        auto start = Clock::now();
+        for(std::size_t i = 0; i < iterations; ++i)
+            func();
+        auto elapsed = Clock::now() - start;
+
+        if(elapsed >= m_sampleTime || iterations >= (std::size_t{1} << 30))
+            break;
+        iterations *= 2;
+    }
+
+    auto best = std::chrono::nanoseconds::max();
+    for(int32_t s = 0; s < m_SampleCount; ++s)
+    {
+        auto start = Clock::now();
+        for(std::size_t i = 0; i < iterations; ++i)
+            func();
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+        best = std::min(best, elapsed);
+    }
+
+    AddResult(name, type, mode, flopsPerOp, operations, best, iterations);
+}
+
+template<typename Func>
+void Runner::Validate(const std::string& name, const std::string& type, double tolerance, Func&& func)
+{
+    if(!Matches(name))
+        return;
+
+    double maxError = static_cast<double>(func());
+    m_validations.push_back(Validation{name, type, maxError, tolerance});
+}
+
+template<typename T>
+constexpr const char* TypeName()
+{
+    if constexpr (std::is_same_v<T, float>)
+        return "float";
+    else
+        return "double";
+}
+
+//Fills vectors, quaternions and matrices with values in [-1, 1]
+template<typename V>
+std::vector<V> RandomData(std::size_t count, uint32_t seed)
+{
+    using T = typename V::Type;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<T> dist(-1, 1);
+    std::vector<V> data(count);
+
+    for(V& value : data)
+    {
+        if constexpr (requires { value.arr; })
+        {
+            for(T& component : value.arr)
+                component = dist(rng);
+        }
+        else
+        {
+            for(int32_t i = 0; i < V::Size; ++i)
+                value[i] = dist(rng);
+        }
+    }
+
+    return data;
+}
+
+//Times out[i] = op(a[i]) over the whole input
+template<typename A, typename Op>
+void RunScalar(Runner& runner, const std::string& name, double flopsPerOp, const std::vector<A>& a, Op op)
+{
+    using Out = std::decay_t<std::invoke_result_t<Op, const A&>>;
+    std::vector<Out> out(a.size());
+
+    runner.Run(name, TypeName<typename A::Type>(), "scalar", flopsPerOp, [&]()
+    {
+        for(std::size_t i = 0; i < a.size(); ++i)
+            out[i] = op(a[i]);
+        DoNotOptimize(out.front());
+    });
+}
+
+//Times out[i] = op(a[i], b[i]) over the whole input
+template<typename A, typename B, typename Op>
+void RunScalar(Runner& runner, const std::string& name, double flopsPerOp, const std::vector<A>& a, 
+    const std::vector<B>& b, Op op)
+{
+    using Out = std::decay_t<std::invoke_result_t<Op, const A&, const B&>>;
+    std::vector<Out> out(a.size());
+
+    runner.Run(name, TypeName<typename A::Type>(), "scalar", flopsPerOp, [&]()
+    {
+        for(std::size_t i = 0; i < a.size(); ++i)
+            out[i] = op(a[i], b[i]);
+        DoNotOptimize(out.front());
+    });
+}
+
+//Times a batched function that processes Elements() operations per call
+template<typename T, typename Func>
+void RunBatched(Runner& runner, const std::string& name, double flopsPerOp, Func&& func)
+{
+    runner.Run(name, TypeName<T>(), "batched", flopsPerOp, std::forward<Func>(func));
+}
+
+//! Registration, one function per module instantiated for float and double
+template<typename T>
+void RunVectorBenchmarks(Runner& runner);
+template<typename T>
+void RunMatrixBenchmarks(Runner& runner);
+template<typename T>
+void RunQuaternionBenchmarks(Runner& runner);
+template<typename T>
+void RunOperationsBenchmarks(Runner& runner);
+template<typename T>
+void RunGeometryBenchmarks(Runner& runner);
+//Float only, the scene structures are not templated
+void RunSceneBenchmarks(Runner& runner);
+
+} //namespace bench
@@ -0,0 +1,215 @@
+#include "Benchmark.hpp"
+#include <limits>
+#include <engine/math/geometry/Frustum.hpp>
+#include <engine/math/collision/Gjk.hpp>
+#include <engine/math/operations.hpp>
+
+namespace bench
+{
+
+//Penetration depth of two boxes from the separating axis theorem, the smallest
+//projected overlap over the face normals and the edge cross products that are
+//not degenerate. Negative when the boxes are apart
+template<typename T>
+T ComputeSatDepth(const math::OBB<T>& a, const math::OBB<T>& b)
+{
+    using V3 = math::Vector3<T>;
+
+    V3 axes[15];
+    int32_t count = 0;
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        axes[count++] = a.axes[i];
+        axes[count++] = b.axes[i];
+    }
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        for(int32_t j = 0; j < 3; ++j)
+        {
+            V3 axis = a.axes[i].Cross(b.axes[j]);
+            if(axis.LengthSquared() > static_cast<T>(1e-6))
+                axes[count++] = axis.GetNormalized();
+        }
+    }
+
+    V3 offset = b.center - a.center;
+    T depth   = std::numeric_limits<T>::max();
+    for(int32_t k = 0; k < count; ++k)
+    {
+        T ra = 0;
+        T rb = 0;
+        for(int32_t i = 0; i < 3; ++i)
+        {
+            ra += std::abs(a.axes[i].Dot(axes[k])) * a.extents[i];
+            rb += std::abs(b.axes[i].Dot(axes[k])) * b.extents[i];
+        }
+        depth = std::min(depth, ra + rb - std::abs(offset.Dot(axes[k])));
+    }
+
+    return depth;
+}
+
+template<typename T>
+void RunGeometryBenchmarks(Runner& runner)
+{
+    using namespace math;
+    using V3 = Vector3<T>;
+
+    //Bounds spread around a camera looking down -z, roughly 10% end up visible
+    Matrix4<T> view       = Matrix4<T>::CreateLookAt(V3(0, 0, 0), V3(0, 0, -1), V3(0, 1, 0));
+    Matrix4<T> projection = Matrix4<T>::CreatePerspective(static_cast<T>(0.1), 100, static_cast<T>(1.2), 
+        static_cast<T>(16.0 / 9.0));
+    Frustum<T> frustum(projection * view);
+
+    std::vector<V3> centerData = RandomData<V3>(runner.Elements(), 41);
+    std::vector<V3> extentData = RandomData<V3>(runner.Elements(), 42);
+    std::vector<T> radii(runner.Elements());
+    for(std::size_t i = 0; i < centerData.size(); ++i)
+    {
+        centerData[i] *= 100;
+        extentData[i] = V3(std::abs(extentData[i].x), std::abs(extentData[i].y), std::abs(extentData[i].z)) * 2;
+        radii[i]      = extentData[i].x;
+    }
+
+    Vector3Stream<T> centers{std::span<const V3>(centerData)};
+    Vector3Stream<T> extents{std::span<const V3>(extentData)};
+    std::vector<uint32_t> visible(runner.Elements());
+
+    //6 planes of 3 multiply-adds and a comparison, the boxes add the projected extents
+    runner.Run("Frustum::CullSpheres", TypeName<T>(), "scalar", 42, [&]()
+    {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < centerData.size(); ++i)
+        {
+            if(frustum.IntersectsSphere(centerData[i], radii[i]))
+                visible[count++] = static_cast<uint32_t>(i);
+        }
+        DoNotOptimize(count);
+    });
+    RunBatched<T>(runner, "Frustum::CullSpheres", 42, [&]()
+    {
+        std::size_t count = frustum.CullSpheres(centers, radii, visible);
+        DoNotOptimize(count);
+    });
+
+    runner.Run("Frustum::CullAABBs", TypeName<T>(), "scalar", 78, [&]()
+    {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < centerData.size(); ++i)
+        {
+            if(frustum.IntersectsAABB(centerData[i], extentData[i]))
+                visible[count++] = static_cast<uint32_t>(i);
+        }
+        DoNotOptimize(count);
+    });
+    RunBatched<T>(runner, "Frustum::CullAABBs", 78, [&]()
+    {
+        std::size_t count = frustum.CullAABBs(centers, extents, visible);
+        DoNotOptimize(count);
+    });
+
+    //Boxes and triangles built around the same centers, a ray through the field
+    std::vector<AABB<T>> boxes(runner.Elements());
+    std::vector<Triangle<T>> triangles(runner.Elements());
+    for(std::size_t i = 0; i < centerData.size(); ++i)
+    {
+        boxes[i]     = AABB<T>::CreateFromCenter(centerData[i], extentData[i]);
+        triangles[i] = Triangle<T>(centerData[i] - extentData[i], centerData[i] + V3(extentData[i].x, 0, 0), 
+            centerData[i] + V3(0, extentData[i].y, extentData[i].z));
+    }
+
+    Ray<T> ray(V3(-150, 1, 2), V3(1, static_cast<T>(0.01), static_cast<T>(0.02)).GetNormalized());
+    std::vector<T> distances(runner.Elements());
+
+    //3 slabs of 2 subtractions and 2 multiplies plus the min/max reduction
+    runner.Run("IntersectRayAABBs", TypeName<T>(), "scalar", 24, [&]()
+    {
+        for(std::size_t i = 0; i < boxes.size(); ++i)
+        {
+            if(!ray.IntersectsAABB(boxes[i], distances[i]))
+                distances[i] = std::numeric_limits<T>::infinity();
+        }
+        DoNotOptimize(distances.front());
+    });
+    RunBatched<T>(runner, "IntersectRayAABBs", 24, [&]()
+    {
+        IntersectRayAABBs(ray, std::span<const AABB<T>>(boxes), std::span<T>(distances));
+        DoNotOptimize(distances.front());
+    });
+
+    //Moller-Trumbore, 2 cross products, 4 dot products and a division
+    runner.Run("IntersectRayTriangles", TypeName<T>(), "scalar", 50, [&]()
+    {
+        for(std::size_t i = 0; i < triangles.size(); ++i)
+        {
+            if(!ray.IntersectsTriangle(triangles[i], distances[i]))
+                distances[i] = std::numeric_limits<T>::infinity();
+        }
+        DoNotOptimize(distances.front());
+    });
+    RunBatched<T>(runner, "IntersectRayTriangles", 50, [&]()
+    {
+        IntersectRayTriangles(ray, std::span<const Triangle<T>>(triangles), std::span<T>(distances));
+        DoNotOptimize(distances.front());
+    });
+
+    //Box pairs with the transforms of the centers, about half of them overlap.
+    //The cached runs reuse the simplex of the previous run, the best case of
+    //frame to frame coherence. Flops are rough averages of a few iterations
+    std::vector<V3> rotationData = RandomData<V3>(runner.Elements(), 43);
+    std::vector<RigidTransform<T>> transforms(runner.Elements());
+    std::vector<GjkCache<T>> caches(runner.Elements());
+    for(std::size_t i = 0; i < transforms.size(); ++i)
+    {
+        transforms[i] = RigidTransform<T>(centerData[i] / 50, Quaternion<T>::FromAxis(rotationData[i].GetSafeNormalized(), 
+            rotationData[i].x * 3));
+    }
+
+    const OBB<T> box(V3(0), V3(1));
+    const RigidTransform<T> origin {};
+
+    runner.Run("Gjk::ComputeDistance(OBB)", TypeName<T>(), "scalar", 400, [&]()
+    {
+        for(std::size_t i = 0; i < transforms.size(); ++i)
+            distances[i] = ComputeDistance(box, origin, box, transforms[i]).distance;
+        DoNotOptimize(distances.front());
+    });
+    runner.Run("Gjk::ComputeDistance(OBB)", TypeName<T>(), "cached", 400, [&]()
+    {
+        for(std::size_t i = 0; i < transforms.size(); ++i)
+            distances[i] = ComputeDistance(box, origin, box, transforms[i], &caches[i]).distance;
+        DoNotOptimize(distances.front());
+    });
+    runner.Run("Epa::ComputePenetration(OBB)", TypeName<T>(), "scalar", 1500, [&]()
+    {
+        for(std::size_t i = 0; i < transforms.size(); ++i)
+            distances[i] = ComputePenetration(box, origin, box, transforms[i]).depth;
+        DoNotOptimize(distances.front());
+    });
+
+    //EPA depths of the same pairs against the separating axis depths, which are
+    //exact for boxes. Pairs closer than margin to touching are skipped, GJK may
+    //land on either side of the contact there
+    runner.Validate("Epa::ComputePenetration(OBB)", TypeName<T>(), std::is_same_v<T, float> ? 1e-4 : 1e-9, [&]()
+    {
+        constexpr T margin = static_cast<T>(std::is_same_v<T, float> ? 1e-3 : 1e-6);
+
+        T maxError = 0;
+        for(std::size_t i = 0; i < transforms.size(); ++i)
+        {
+            PenetrationResult<T> result = ComputePenetration(box, origin, box, transforms[i]);
+            T sat = ComputeSatDepth(box, OBB<T>(transforms[i].position, box.extents, transforms[i].rotation));
+
+            if(sat > margin)
+                maxError = std::max(maxError, result.intersecting ? std::abs(result.depth - sat) : sat);
+            else if(sat < -margin && result.intersecting)
+                maxError = std::max(maxError, -sat);
+        }
+        return maxError;
+    });
+}
+
+template void RunGeometryBenchmarks<float>(Runner& runner);
+template void RunGeometryBenchmarks<double>(Runner& runner);
+
+} //namespace bench
@@ -0,0 +1,115 @@
+#include "Benchmark.hpp"
+#include <engine/math/matrix/Matrix2.hpp>
+#include <engine/math/matrix/Matrix3.hpp>
+#include <engine/math/matrix/Matrix4.hpp>
+#include <engine/math/quat/Quaternion.hpp>
+#include <engine/math/expr/Expression.hpp>
+
+namespace bench
+{
+
+//Operations shared by Matrix2, Matrix3 and Matrix4. Determinant and inverse
+//flops are nominal cofactor expansion counts passed by the caller
+template<typename M>
+static void RunCommonMatrixBenchmarks(Runner& runner, const std::string& prefix, 
+    double determinantFlops, double inverseFlops)
+{
+    using T = typename M::Type;
+    constexpr double n    = M::NumColumns;
+    constexpr double size = M::Size;
+
+    std::vector<M> a = RandomData<M>(runner.Elements(), 11);
+    std::vector<M> b = RandomData<M>(runner.Elements(), 12);
+    T s = static_cast<T>(0.5);
+
+    RunScalar(runner, prefix + "::operator+",     size, a, b, [](const M& l, const M& r) { return l + r; });
+    RunScalar(runner, prefix + "::operator+=",    size, a, b, [](M l, const M& r) { return l += r; });
+    RunScalar(runner, prefix + "::operator-",     size, a, b, [](const M& l, const M& r) { return l - r; });
+    RunScalar(runner, prefix + "::operator-=",    size, a, b, [](M l, const M& r) { return l -= r; });
+    RunScalar(runner, prefix + "::operator*(T)",  size, a, [s](const M& m) { return m * s; });
+    RunScalar(runner, prefix + "::operator*=(T)", size, a, [s](M m) { return m *= s; });
+    RunScalar(runner, prefix + "::operator/(T)",  size + 1, a, [s](const M& m) { return m / s; });
+    RunScalar(runner, prefix + "::operator/=(T)", size + 1, a, [s](M m) { return m /= s; });
+
+    //n^3 multiplications and n^2 * (n - 1) additions
+    RunScalar(runner, prefix + "::operator*",  2 * n * n * n - n * n, a, b, [](const M& l, const M& r) { return l * r; });
+    RunScalar(runner, prefix + "::operator*=", 2 * n * n * n - n * n, a, b, [](M l, const M& r) { return l *= r; });
+
+    RunScalar(runner, prefix + "::Determinant",  determinantFlops, a, [](const M& m) { return M(m.Determinant()); });
+    RunScalar(runner, prefix + "::GetInverse",   inverseFlops, a, [](const M& m) { return m.GetInverse(); });
+    RunScalar(runner, prefix + "::GetTranspose", 0, a, [](const M& m) { return m.GetTranspose(); });
+}
+
+//Sine, cosine and tangent are not counted in the flops of the rotation and
+//projection builders
+template<typename T>
+void RunMatrixBenchmarks(Runner& runner)
+{
+    using namespace math;
+
+    RunCommonMatrixBenchmarks<Matrix2<T>>(runner, "Matrix2", 3, 8);
+    RunCommonMatrixBenchmarks<Matrix3<T>>(runner, "Matrix3", 14, 42);
+    RunCommonMatrixBenchmarks<Matrix4<T>>(runner, "Matrix4", 47, 140);
+
+    std::vector<Matrix2<T>> m2    = RandomData<Matrix2<T>>(runner.Elements(), 13);
+    std::vector<Matrix3<T>> m3    = RandomData<Matrix3<T>>(runner.Elements(), 14);
+    std::vector<Matrix4<T>> m4    = RandomData<Matrix4<T>>(runner.Elements(), 15);
+    std::vector<Vector2<T>> v2    = RandomData<Vector2<T>>(runner.Elements(), 16);
+    std::vector<Vector3<T>> v3    = RandomData<Vector3<T>>(runner.Elements(), 17);
+    std::vector<Vector3<T>> w3    = RandomData<Vector3<T>>(runner.Elements(), 18);
+    std::vector<Vector4<T>> v4    = RandomData<Vector4<T>>(runner.Elements(), 19);
+    std::vector<Quaternion<T>> q  = RandomData<Quaternion<T>>(runner.Elements(), 20);
+    for(Quaternion<T>& rotation : q)
+        rotation = rotation.GetNormalized();
+
+    using M2 = Matrix2<T>;
+    using M3 = Matrix3<T>;
+    using M4 = Matrix4<T>;
+    using V2 = Vector2<T>;
+    using V3 = Vector3<T>;
+
+    //! Matrix2
+    RunScalar(runner, "Matrix2::GetScaled",      4,  m2, v2, [](const M2& m, const V2& v) { return m.GetScaled(v); });
+    RunScalar(runner, "Matrix2::GetRotated",     12, m2, v2, [](const M2& m, const V2& v) { return m.GetRotated(v.x); });
+    RunScalar(runner, "Matrix2::CreateScale",    0,  v2, [](const V2& v) { return M2::CreateScale(v); });
+    RunScalar(runner, "Matrix2::CreateRotation", 0,  v2, [](const V2& v) { return M2::CreateRotation(v.x); });
+
+    //! Matrix3
+    RunScalar(runner, "Matrix3::GetScaled",           9,  m3, v3, [](const M3& m, const V3& v) { return m.GetScaled(v); });
+    RunScalar(runner, "Matrix3::GetScaled2D",         6,  m3, v2, [](const M3& m, const V2& v) { return m.GetScaled2D(v); });
+    RunScalar(runner, "Matrix3::GetRotatedX",         18, m3, v2, [](const M3& m, const V2& v) { return m.GetRotatedX(v.x); });
+    RunScalar(runner, "Matrix3::GetRotatedY",         18, m3, v2, [](const M3& m, const V2& v) { return m.GetRotatedY(v.x); });
+    RunScalar(runner, "Matrix3::GetRotatedZ",         18, m3, v2, [](const M3& m, const V2& v) { return m.GetRotatedZ(v.x); });
+    RunScalar(runner, "Matrix3::GetTranslated2D",     12, m3, v2, [](const M3& m, const V2& v) { return m.GetTranslated2D(v); });
+    RunScalar(runner, "Matrix3::CreateScale",         0,  v3, [](const V3& v) { return M3::CreateScale(v); });
+    RunScalar(runner, "Matrix3::CreateScale2D",       0,  v2, [](const V2& v) { return M3::CreateScale2D(v); });
+    RunScalar(runner, "Matrix3::CreateRotationX",     0,  v2, [](const V2& v) { return M3::CreateRotationX(v.x); });
+    RunScalar(runner, "Matrix3::CreateRotationY",     0,  v2, [](const V2& v) { return M3::CreateRotationY(v.x); });
+    RunScalar(runner, "Matrix3::CreateRotationZ",     0,  v2, [](const V2& v) { return M3::CreateRotationZ(v.x); });
+    RunScalar(runner, "Matrix3::CreateTranslation2D", 0,  v2, [](const V2& v) { return M3::CreateTranslation2D(v); });
+    RunScalar(runner, "Matrix3::CreateTransform2D",   10, v2, [](const V2& v) { return M3::CreateTransform2D(v, v.x, v); });
+
+    //! Matrix4
+    RunScalar(runner, "Matrix4::operator*(Vector4)", 28, m4, v4, [](const M4& m, const Vector4<T>& v) { return m * v; });
+    //Two matrix products and one matrix vector product against three matrix vector products
+    RunScalar(runner, "Matrix4::m*m*m*v",       252, m4, v4, [](const M4& m, const Vector4<T>& v) { return m * m * m * v; });
+    RunScalar(runner, "Matrix4::Lazy(m*m*m*v)", 84,  m4, v4, [](const M4& m, const Vector4<T>& v) { return expr::Lazy(m) * m * m * v; });
+    RunScalar(runner, "Matrix4::GetScaled",          12, m4, v3, [](const M4& m, const V3& v) { return m.GetScaled(v); });
+    RunScalar(runner, "Matrix4::GetRotatedX",        24, m4, v3, [](const M4& m, const V3& v) { return m.GetRotatedX(v.x); });
+    RunScalar(runner, "Matrix4::GetRotatedY",        24, m4, v3, [](const M4& m, const V3& v) { return m.GetRotatedY(v.x); });
+    RunScalar(runner, "Matrix4::GetRotatedZ",        24, m4, v3, [](const M4& m, const V3& v) { return m.GetRotatedZ(v.x); });
+    RunScalar(runner, "Matrix4::GetTranslated",      24, m4, v3, [](const M4& m, const V3& v) { return m.GetTranslated(v); });
+    RunScalar(runner, "Matrix4::CreateScale",        0,  v3, [](const V3& v) { return M4::CreateScale(v); });
+    RunScalar(runner, "Matrix4::CreateRotationX",    0,  v3, [](const V3& v) { return M4::CreateRotationX(v.x); });
+    RunScalar(runner, "Matrix4::CreateRotationY",    0,  v3, [](const V3& v) { return M4::CreateRotationY(v.x); });
+    RunScalar(runner, "Matrix4::CreateRotationZ",    0,  v3, [](const V3& v) { return M4::CreateRotationZ(v.x); });
+    RunScalar(runner, "Matrix4::CreateTranslation",  0,  v3, [](const V3& v) { return M4::CreateTranslation(v); });
+    RunScalar(runner, "Matrix4::CreateLookAt",       69, v3, w3, [](const V3& c, const V3& t) { return M4::CreateLookAt(c, t, V3(0, 1, 0)); });
+    RunScalar(runner, "Matrix4::CreatePerspective",  8,  v3, [](const V3& v) { return M4::CreatePerspective(v.x, v.y + 2, v.z, v.x + 2); });
+    RunScalar(runner, "Matrix4::CreateTransform",    42, q, v3, [](const Quaternion<T>& r, const V3& v) { return M4::CreateTransform(v, r, v); });
+}
+
+template void RunMatrixBenchmarks<float>(Runner& runner);
+template void RunMatrixBenchmarks<double>(Runner& runner);
+
+} //namespace bench
@@ -0,0 +1,609 @@
+#include "Benchmark.hpp"
+#include <cmath>
+#include <engine/math/operations.hpp>
+#include <engine/math/curve/Curve.hpp>
+#include <engine/math/noise/Noise.hpp>
+#include <engine/math/random/Random.hpp>
+#include <engine/math/spatial/Morton.hpp>
+
+namespace bench
+{
+
+//Every batched function is timed next to the equivalent loop of scalar
+//operations under the same name, so the two modes can be compared directly
+template<typename T>
+void RunOperationsBenchmarks(Runner& runner)
+{
+    using namespace math;
+    using V2 = Vector2<T>;
+    using V3 = Vector3<T>;
+    using V4 = Vector4<T>;
+    using Q  = Quaternion<T>;
+
+    std::vector<Matrix2<T>> m2 = RandomData<Matrix2<T>>(runner.Elements(), 31);
+    std::vector<Matrix3<T>> m3 = RandomData<Matrix3<T>>(runner.Elements(), 32);
+    std::vector<Matrix4<T>> m4 = RandomData<Matrix4<T>>(runner.Elements(), 33);
+    std::vector<V2> v2         = RandomData<V2>(runner.Elements(), 34);
+    std::vector<V3> v3         = RandomData<V3>(runner.Elements(), 35);
+    std::vector<V4> v4         = RandomData<V4>(runner.Elements(), 36);
+    std::vector<Q> qa          = RandomData<Q>(runner.Elements(), 37);
+    std::vector<Q> qb          = RandomData<Q>(runner.Elements(), 38);
+    std::vector<T> weights(runner.Elements(), static_cast<T>(0.25));
+    for(std::size_t i = 0; i < qa.size(); ++i)
+    {
+        qa[i] = qa[i].GetNormalized();
+        qb[i] = qb[i].GetNormalized();
+    }
+
+    const Matrix4<T> m = m4.front();
+    const Q q          = qa.front();
+
+    std::vector<V2> out2(runner.Elements());
+    std::vector<V3> out3(runner.Elements());
+    std::vector<V4> out4(runner.Elements());
+    std::vector<Q> outQ(runner.Elements());
+
+    //! Free operators
+    RunScalar(runner, "operator*(Matrix2, Vector2)",    6,  m2, v2, [](const Matrix2<T>& l, const V2& r) { return l * r; });
+    RunScalar(runner, "operator*(Matrix3, Vector3)",    15, m3, v3, [](const Matrix3<T>& l, const V3& r) { return l * r; });
+    RunScalar(runner, "operator*(Quaternion, Vector3)", 30, qa, v3, [](const Q& l, const V3& r) { return l * r; });
+
+    //! Transforms
+    RunScalar(runner, "TransformPoints", 18, v3, [&m](const V3& p) 
+    { 
+        V4 r = m * V4(p.x, p.y, p.z, 1);
+        return V3(r.x, r.y, r.z); 
+    });
+    RunBatched<T>(runner, "TransformPoints", 18, [&]() 
+    { 
+        TransformPoints(m, std::span<const V3>(v3), std::span<V3>(out3)); 
+        DoNotOptimize(out3.front());
+    });
+
+    RunScalar(runner, "TransformDirections", 15, v3, [&m](const V3& d) 
+    { 
+        V4 r = m * V4(d.x, d.y, d.z, 0);
+        return V3(r.x, r.y, r.z); 
+    });
+    RunBatched<T>(runner, "TransformDirections", 15, [&]() 
+    { 
+        TransformDirections(m, std::span<const V3>(v3), std::span<V3>(out3)); 
+        DoNotOptimize(out3.front());
+    });
+
+    RunScalar(runner, "TransformVec4", 28, v4, [&m](const V4& v) { return m * v; });
+    RunBatched<T>(runner, "TransformVec4", 28, [&]() 
+    { 
+        TransformVec4(m, std::span<const V4>(v4), std::span<V4>(out4)); 
+        DoNotOptimize(out4.front());
+    });
+
+    //! Rotations
+    RunScalar(runner, "RotateVectors", 30, v3, [&q](const V3& v) { return q * v; });
+    RunBatched<T>(runner, "RotateVectors", 30, [&]() 
+    { 
+        RotateVectors(q, std::span<const V3>(v3), std::span<V3>(out3)); 
+        DoNotOptimize(out3.front());
+    });
+
+    RunScalar(runner, "RotateVectors(per element)", 30, qa, v3, [](const Q& r, const V3& v) { return r * v; });
+    RunBatched<T>(runner, "RotateVectors(per element)", 30, [&]() 
+    { 
+        RotateVectors(std::span<const Q>(qa), std::span<const V3>(v3), std::span<V3>(out3)); 
+        DoNotOptimize(out3.front());
+    });
+
+    //! Rotation blending
+    struct BlendMode
+    {
+        const char* name;
+        RotationBlend mode;
+        double flops;
+        Q (*blend)(const Q&, const Q&, T);
+    };
+    const BlendMode blendModes[] = {
+        {"BlendRotations(Nlerp)",     RotationBlend::Nlerp,     34, &Q::Nlerp},
+        {"BlendRotations(Slerp)",     RotationBlend::Slerp,     40, &Q::Slerp},
+        {"BlendRotations(FastSlerp)", RotationBlend::FastSlerp, 45, &Q::FastSlerp}
+    };
+
+    for(const BlendMode& blend : blendModes)
+    {
+        runner.Run(blend.name, TypeName<T>(), "scalar", blend.flops, [&]()
+        {
+            for(std::size_t i = 0; i < qa.size(); ++i)
+                outQ[i] = blend.blend(qa[i], qb[i], weights[i]);
+            DoNotOptimize(outQ.front());
+        });
+        RunBatched<T>(runner, blend.name, blend.flops, [&]() 
+        { 
+            BlendRotations(std::span<const Q>(qa), std::span<const Q>(qb), std::span<const T>(weights), 
+                std::span<Q>(outQ), blend.mode); 
+            DoNotOptimize(outQ.front());
+        });
+    }
+
+    //Dot, sign flip and one multiply-add per component
+    runner.Run("AccumulateRotations", TypeName<T>(), "scalar", 15, [&]()
+    {
+        for(std::size_t i = 0; i < qa.size(); ++i)
+        {
+            T w = outQ[i].Dot(qa[i]) < 0 ? -weights[i] : weights[i];
+            outQ[i] += qa[i] * w;
+        }
+        DoNotOptimize(outQ.front());
+    });
+    RunBatched<T>(runner, "AccumulateRotations", 15, [&]() 
+    { 
+        AccumulateRotations(std::span<Q>(outQ), std::span<const Q>(qa), std::span<const T>(weights)); 
+        DoNotOptimize(outQ.front());
+    });
+
+    //! Normalisation, repeated in place on already normalised data after the first call
+    RunScalar(runner, "NormalizeRotations", 13, qa, [](const Q& r) { return r.GetNormalized(); });
+    RunBatched<T>(runner, "NormalizeRotations", 13, [&]() 
+    { 
+        NormalizeRotations(std::span<Q>(qa)); 
+        DoNotOptimize(qa.front());
+    });
+
+    RunScalar(runner, "FastNormalizeRotations", 13, qa, [](const Q& r) { return r.GetFastNormalized(); });
+    RunBatched<T>(runner, "FastNormalizeRotations", 13, [&]() 
+    { 
+        FastNormalizeRotations(std::span<Q>(qa)); 
+        DoNotOptimize(qa.front());
+    });
+
+    RunScalar(runner, "FastNormalizeVectors(Vector2)", 7, v2, [](const V2& v) { return v.GetFastNormalized(); });
+    RunBatched<T>(runner, "FastNormalizeVectors(Vector2)", 7, [&]() 
+    { 
+        FastNormalizeVectors(std::span<V2>(v2)); 
+        DoNotOptimize(v2.front());
+    });
+
+    RunScalar(runner, "FastNormalizeVectors(Vector3)", 10, v3, [](const V3& v) { return v.GetFastNormalized(); });
+    RunBatched<T>(runner, "FastNormalizeVectors(Vector3)", 10, [&]() 
+    { 
+        FastNormalizeVectors(std::span<V3>(v3)); 
+        DoNotOptimize(v3.front());
+    });
+
+    RunScalar(runner, "FastNormalizeVectors(Vector4)", 13, v4, [](const V4& v) { return v.GetFastNormalized(); });
+    RunBatched<T>(runner, "FastNormalizeVectors(Vector4)", 13, [&]() 
+    { 
+        FastNormalizeVectors(std::span<V4>(v4)); 
+        DoNotOptimize(v4.front());
+    });
+
+    //! Transcendentals, angles in [-pi, pi] and positive values in (0, 2].
+    //Flop counts are the polynomial evaluations of the accurate SIMD path
+    std::vector<T> angles(runner.Elements());
+    std::vector<T> positive(runner.Elements());
+    std::vector<T> outA(runner.Elements());
+    std::vector<T> outB(runner.Elements());
+    for(std::size_t i = 0; i < angles.size(); ++i)
+    {
+        angles[i]   = v4[i].x * static_cast<T>(3.14159265);
+        positive[i] = v4[i].y + static_cast<T>(1.000001);
+    }
+
+    auto runUnary = [&](const char* name, double flops, T (*scalar)(T), 
+        void (*batched)(std::span<const T>, std::span<T>, Precision), const std::vector<T>& input)
+    {
+        runner.Run(name, TypeName<T>(), "scalar", flops, [&]()
+        {
+            for(std::size_t i = 0; i < input.size(); ++i)
+                outA[i] = scalar(input[i]);
+            DoNotOptimize(outA.front());
+        });
+        RunBatched<T>(runner, name, flops, [&]() 
+        { 
+            batched(std::span<const T>(input), std::span<T>(outA), Precision::Accurate); 
+            DoNotOptimize(outA.front());
+        });
+        RunBatched<T>(runner, std::string(name) + "(Fast)", flops, [&]() 
+        { 
+            batched(std::span<const T>(input), std::span<T>(outA), Precision::Fast); 
+            DoNotOptimize(outA.front());
+        });
+    };
+
+    runUnary("Sin", 22, [](T x) { return std::sin(x); }, &Sin<T>, angles);
+    runUnary("Cos", 22, [](T x) { return std::cos(x); }, &Cos<T>, angles);
+    runUnary("Exp", 20, [](T x) { return std::exp(x); }, &Exp<T>, angles);
+    runUnary("Log", 28, [](T x) { return std::log(x); }, &Log<T>, positive);
+
+    runner.Run("SinCos", TypeName<T>(), "scalar", 24, [&]()
+    {
+        for(std::size_t i = 0; i < angles.size(); ++i)
+        {
+            outA[i] = std::sin(angles[i]);
+            outB[i] = std::cos(angles[i]);
+        }
+        DoNotOptimize(outA.front());
+    });
+    RunBatched<T>(runner, "SinCos", 24, [&]() 
+    { 
+        SinCos(std::span<const T>(angles), std::span<T>(outA), std::span<T>(outB)); 
+        DoNotOptimize(outA.front());
+    });
+
+    runner.Run("Atan2", TypeName<T>(), "scalar", 25, [&]()
+    {
+        for(std::size_t i = 0; i < angles.size(); ++i)
+            outA[i] = std::atan2(angles[i], positive[i]);
+        DoNotOptimize(outA.front());
+    });
+    RunBatched<T>(runner, "Atan2", 25, [&]() 
+    { 
+        Atan2(std::span<const T>(angles), std::span<const T>(positive), std::span<T>(outA)); 
+        DoNotOptimize(outA.front());
+    });
+
+    runner.Run("Pow", TypeName<T>(), "scalar", 48, [&]()
+    {
+        for(std::size_t i = 0; i < angles.size(); ++i)
+            outA[i] = std::pow(positive[i], angles[i]);
+        DoNotOptimize(outA.front());
+    });
+    RunBatched<T>(runner, "Pow", 48, [&]() 
+    { 
+        Pow(std::span<const T>(positive), std::span<const T>(angles), std::span<T>(outA)); 
+        DoNotOptimize(outA.front());
+    });
+
+    //! Random sampling, the scalar mode is std::mt19937 with the standard
+    //distributions. Flop counts are the float math after the generator
+    if constexpr (std::is_same_v<T, float>)
+    {
+        std::mt19937 engine(51);
+        Random random(51);
+
+        std::uniform_real_distribution<T> uniform(-1, 1);
+        runner.Run("Random::FillUniform", TypeName<T>(), "scalar", 2, [&]()
+        {
+            for(std::size_t i = 0; i < outA.size(); ++i)
+                outA[i] = uniform(engine);
+            DoNotOptimize(outA.front());
+        });
+        RunBatched<T>(runner, "Random::FillUniform", 2, [&]() 
+        { 
+            random.FillUniform(std::span<T>(outA), -1, 1); 
+            DoNotOptimize(outA.front());
+        });
+
+        std::normal_distribution<T> normal(0, 1);
+        runner.Run("Random::FillGaussian", TypeName<T>(), "scalar", 30, [&]()
+        {
+            for(std::size_t i = 0; i < outA.size(); ++i)
+                outA[i] = normal(engine);
+            DoNotOptimize(outA.front());
+        });
+        RunBatched<T>(runner, "Random::FillGaussian", 30, [&]() 
+        { 
+            random.FillGaussian(std::span<T>(outA)); 
+            DoNotOptimize(outA.front());
+        });
+
+        //Height and angle around z, like FillOnUnitSphere
+        std::uniform_real_distribution<T> angle(static_cast<T>(-3.14159265), static_cast<T>(3.14159265));
+        runner.Run("Random::FillOnUnitSphere", TypeName<T>(), "scalar", 30, [&]()
+        {
+            for(std::size_t i = 0; i < out3.size(); ++i)
+            {
+                T z      = uniform(engine);
+                T radius = std::sqrt(1 - z * z);
+                T a      = angle(engine);
+                out3[i]  = V3(radius * std::cos(a), radius * std::sin(a), z);
+            }
+            DoNotOptimize(out3.front());
+        });
+        RunBatched<T>(runner, "Random::FillOnUnitSphere", 30, [&]() 
+        { 
+            random.FillOnUnitSphere(std::span<V3>(out3)); 
+            DoNotOptimize(out3.front());
+        });
+    }
+
+    //! Noise, one octave at positions spread over 100 cells
+    if constexpr (std::is_same_v<T, float>)
+    {
+        std::vector<V3> positions(v3.size());
+        for(std::size_t i = 0; i < v3.size(); ++i)
+            positions[i] = v3[i] * 100;
+
+        NoiseSettings settings;
+        settings.fractal = FractalType::None;
+
+        for(NoiseType type : { NoiseType::Gradient, NoiseType::Simplex })
+        {
+            settings.type    = type;
+            std::string name = type == NoiseType::Gradient ? "SampleNoise(Gradient3)" : "SampleNoise(Simplex3)";
+            double flops     = type == NoiseType::Gradient ? 90 : 70;
+
+            runner.Run(name, TypeName<T>(), "scalar", flops, [&]()
+            {
+                for(std::size_t i = 0; i < positions.size(); ++i)
+                    outA[i] = SampleNoise(settings, positions[i]);
+                DoNotOptimize(outA.front());
+            });
+            RunBatched<T>(runner, name, flops, [&]() 
+            { 
+                SampleNoise(settings, std::span<const V3>(positions), std::span<T>(outA)); 
+                DoNotOptimize(outA.front());
+            });
+        }
+    }
+
+    //! Curves, a Catmull-Rom path through 32 points followed at random
+    //parameters and at the matching distances
+    {
+        std::vector<V3> points = RandomData<V3>(32, 39);
+        Curve<V3> curve        = Curve<V3>::CreateCatmullRom(std::span<const V3>(points));
+
+        std::vector<T> parameters(runner.Elements());
+        std::vector<T> distances(runner.Elements());
+        for(std::size_t i = 0; i < parameters.size(); ++i)
+        {
+            parameters[i] = v4[i].y * static_cast<T>(0.5) + static_cast<T>(0.5);
+            distances[i]  = parameters[i] * curve.GetLength();
+        }
+
+        runner.Run("Curve::Evaluate", TypeName<T>(), "scalar", 20, [&]()
+        {
+            for(std::size_t i = 0; i < parameters.size(); ++i)
+                out3[i] = curve.Evaluate(parameters[i]);
+            DoNotOptimize(out3.front());
+        });
+        RunBatched<T>(runner, "Curve::Evaluate", 20, [&]() 
+        { 
+            curve.Evaluate(std::span<const T>(parameters), std::span<V3>(out3)); 
+            DoNotOptimize(out3.front());
+        });
+        runner.Run("Curve::EvaluateAtDistance", TypeName<T>(), "scalar", 35, [&]()
+        {
+            for(std::size_t i = 0; i < distances.size(); ++i)
+                out3[i] = curve.EvaluateAtDistance(distances[i]);
+            DoNotOptimize(out3.front());
+        });
+        RunBatched<T>(runner, "Curve::EvaluateAtDistance", 35, [&]() 
+        { 
+            curve.EvaluateAtDistances(std::span<const T>(distances), std::span<V3>(out3)); 
+            DoNotOptimize(out3.front());
+        });
+    }
+
+    //! Morton keys, 32 bit with 10 bits per axis
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const AABB<T> bounds(V3(-1), V3(1));
+        std::vector<uint32_t> keys(runner.Elements());
+
+        runner.Run("EncodeMorton(Vector3)", TypeName<T>(), "scalar", 40, [&]()
+        {
+            auto quantise = [](T v) { return static_cast<uint32_t>(std::clamp((v + 1) * 512, T(0), T(1023))); };
+            for(std::size_t i = 0; i < v3.size(); ++i)
+                keys[i] = EncodeMorton3(quantise(v3[i].x), quantise(v3[i].y), quantise(v3[i].z));
+            DoNotOptimize(keys.front());
+        });
+        RunBatched<T>(runner, "EncodeMorton(Vector3)", 40, [&]() 
+        { 
+            EncodeMorton(std::span<const V3>(v3), bounds, std::span<uint32_t>(keys)); 
+            DoNotOptimize(keys.front());
+        });
+        runner.Run("DecodeMorton(Vector3)", TypeName<T>(), "scalar", 40, [&]()
+        {
+            auto center = [](uint32_t cell) { return (static_cast<T>(cell) + T(0.5)) / 512 - 1; };
+            for(std::size_t i = 0; i < keys.size(); ++i)
+            {
+                Vector3<uint32_t> cell = DecodeMorton3(keys[i]);
+                out3[i]                = V3(center(cell.x), center(cell.y), center(cell.z));
+            }
+            DoNotOptimize(out3.front());
+        });
+        RunBatched<T>(runner, "DecodeMorton(Vector3)", 40, [&]() 
+        { 
+            DecodeMorton(std::span<const uint32_t>(keys), bounds, std::span<V3>(out3)); 
+            DoNotOptimize(out3.front());
+        });
+    }
+
+    //! Packed storage, every component converted on its own. Flop counts are
+    //the float math per element: a conversion for half, clamp, scale and round
+    //for the normalised formats
+    if constexpr (std::is_same_v<T, float>)
+    {
+        std::vector<Vec3h> halves(runner.Elements());
+        std::vector<Vec3Snorm16> snorms(runner.Elements());
+        std::vector<Vec4Unorm8> unorms(runner.Elements());
+        std::vector<OctNormal32> octahedral(runner.Elements());
+        std::vector<V3> normals(runner.Elements());
+        std::vector<V4> colors(runner.Elements());
+        for(std::size_t i = 0; i < normals.size(); ++i)
+        {
+            normals[i] = v3[i].GetSafeNormalized();
+            colors[i]  = v4[i] * static_cast<T>(0.5) + V4(static_cast<T>(0.5));
+        }
+
+        runner.Run("PackHalf(Vector3)", TypeName<T>(), "scalar", 3, [&]()
+        {
+            for(std::size_t i = 0; i < normals.size(); ++i)
+                halves[i] = Vec3h(Half(normals[i].x), Half(normals[i].y), Half(normals[i].z));
+            DoNotOptimize(halves.front());
+        });
+        RunBatched<T>(runner, "PackHalf(Vector3)", 3, [&]() 
+        { 
+            PackHalf(std::span<const V3>(normals), std::span<Vec3h>(halves)); 
+            DoNotOptimize(halves.front());
+        });
+        runner.Run("UnpackHalf(Vector3)", TypeName<T>(), "scalar", 3, [&]()
+        {
+            for(std::size_t i = 0; i < halves.size(); ++i)
+                out3[i] = V3(halves[i].x, halves[i].y, halves[i].z);
+            DoNotOptimize(out3.front());
+        });
+        RunBatched<T>(runner, "UnpackHalf(Vector3)", 3, [&]() 
+        { 
+            UnpackHalf(std::span<const Vec3h>(halves), std::span<V3>(out3)); 
+            DoNotOptimize(out3.front());
+        });
+
+        runner.Run("PackSnorm16(Vector3)", TypeName<T>(), "scalar", 12, [&]()
+        {
+            for(std::size_t i = 0; i < normals.size(); ++i)
+                snorms[i] = Vec3Snorm16(Snorm16(normals[i].x), Snorm16(normals[i].y), Snorm16(normals[i].z));
+            DoNotOptimize(snorms.front());
+        });
+        RunBatched<T>(runner, "PackSnorm16(Vector3)", 12, [&]() 
+        { 
+            PackSnorm(std::span<const V3>(normals), std::span<Vec3Snorm16>(snorms)); 
+            DoNotOptimize(snorms.front());
+        });
+        runner.Run("UnpackSnorm16(Vector3)", TypeName<T>(), "scalar", 6, [&]()
+        {
+            for(std::size_t i = 0; i < snorms.size(); ++i)
+                out3[i] = V3(snorms[i].x, snorms[i].y, snorms[i].z);
+            DoNotOptimize(out3.front());
+        });
+        RunBatched<T>(runner, "UnpackSnorm16(Vector3)", 6, [&]() 
+        { 
+            UnpackSnorm(std::span<const Vec3Snorm16>(snorms), std::span<V3>(out3)); 
+            DoNotOptimize(out3.front());
+        });
+
+        runner.Run("PackUnorm8(Vector4)", TypeName<T>(), "scalar", 16, [&]()
+        {
+            for(std::size_t i = 0; i < colors.size(); ++i)
+                unorms[i] = Vec4Unorm8(Unorm8(colors[i].x), Unorm8(colors[i].y), Unorm8(colors[i].z), Unorm8(colors[i].w));
+            DoNotOptimize(unorms.front());
+        });
+        RunBatched<T>(runner, "PackUnorm8(Vector4)", 16, [&]() 
+        { 
+            PackUnorm(std::span<const V4>(colors), std::span<Vec4Unorm8>(unorms)); 
+            DoNotOptimize(unorms.front());
+        });
+        runner.Run("UnpackUnorm8(Vector4)", TypeName<T>(), "scalar", 4, [&]()
+        {
+            for(std::size_t i = 0; i < unorms.size(); ++i)
+                out4[i] = V4(unorms[i].x, unorms[i].y, unorms[i].z, unorms[i].w);
+            DoNotOptimize(out4.front());
+        });
+        RunBatched<T>(runner, "UnpackUnorm8(Vector4)", 4, [&]() 
+        { 
+            UnpackUnorm(std::span<const Vec4Unorm8>(unorms), std::span<V4>(out4)); 
+            DoNotOptimize(out4.front());
+        });
+
+        //Projection and fold, then the snorm16 quantisation of both components
+        runner.Run("PackOctahedral(OctNormal32)", TypeName<T>(), "scalar", 20, [&]()
+        {
+            for(std::size_t i = 0; i < normals.size(); ++i)
+            {
+                Vector2<T> e  = EncodeOctahedral(normals[i]);
+                octahedral[i] = OctNormal32(Snorm16(e.x), Snorm16(e.y));
+            }
+            DoNotOptimize(octahedral.front());
+        });
+        RunBatched<T>(runner, "PackOctahedral(OctNormal32)", 20, [&]() 
+        { 
+            PackOctahedral(std::span<const V3>(normals), std::span<OctNormal32>(octahedral)); 
+            DoNotOptimize(octahedral.front());
+        });
+        //Unfold and normalisation
+        runner.Run("UnpackOctahedral(OctNormal32)", TypeName<T>(), "scalar", 20, [&]()
+        {
+            for(std::size_t i = 0; i < octahedral.size(); ++i)
+                out3[i] = DecodeOctahedral(Vector2<T>(octahedral[i].x, octahedral[i].y));
+            DoNotOptimize(out3.front());
+        });
+        RunBatched<T>(runner, "UnpackOctahedral(OctNormal32)", 20, [&]() 
+        { 
+            UnpackOctahedral(std::span<const OctNormal32>(octahedral), std::span<V3>(out3)); 
+            DoNotOptimize(out3.front());
+        });
+    }
+
+    //! Smallest three rotation compression of normalised rotations. Flop
+    //counts are the largest component search and three quantisations, and the
+    //three dequantisations and the square root of the dropped component
+    if constexpr (std::is_same_v<T, float>)
+    {
+        std::vector<Quat32> quat32(runner.Elements());
+        std::vector<Quat48> quat48(runner.Elements());
+
+        auto runCompression = [&]<typename S>(const std::string& suffix, std::vector<S>& compressed)
+        {
+            runner.Run("CompressRotations" + suffix, TypeName<T>(), "scalar", 12, [&]()
+            {
+                for(std::size_t i = 0; i < qa.size(); ++i)
+                    compressed[i] = S(qa[i]);
+                DoNotOptimize(compressed.front());
+            });
+            RunBatched<T>(runner, "CompressRotations" + suffix, 12, [&]() 
+            { 
+                CompressRotations(std::span<const Q>(qa), std::span<S>(compressed)); 
+                DoNotOptimize(compressed.front());
+            });
+            runner.Run("DecompressRotations" + suffix, TypeName<T>(), "scalar", 14, [&]()
+            {
+                for(std::size_t i = 0; i < compressed.size(); ++i)
+                    outQ[i] = compressed[i].ToQuaternion();
+                DoNotOptimize(outQ.front());
+            });
+            RunBatched<T>(runner, "DecompressRotations" + suffix, 14, [&]() 
+            { 
+                DecompressRotations(std::span<const S>(compressed), std::span<Q>(outQ)); 
+                DoNotOptimize(outQ.front());
+            });
+        };
+
+        runCompression("(Quat32)", quat32);
+        runCompression("(Quat48)", quat48);
+    }
+
+    //! Camera relative rebasing, double world data to float render data
+    if constexpr (std::is_same_v<T, double>)
+    {
+        const V3 origin(6.4e6, -2.5e5, 1.5e11);
+        std::vector<Vector3<float>> rebased(runner.Elements());
+        std::vector<Matrix4<float>> rebasedTransforms(runner.Elements());
+
+        runner.Run("RebasePositions", TypeName<T>(), "scalar", 3, [&]()
+        {
+            for(std::size_t i = 0; i < v3.size(); ++i)
+            {
+                V3 p       = v3[i] - origin;
+                rebased[i] = Vector3<float>(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.z));
+            }
+            DoNotOptimize(rebased.front());
+        });
+        RunBatched<T>(runner, "RebasePositions", 3, [&]() 
+        { 
+            RebasePositions(std::span<const V3>(v3), origin, std::span<Vector3<float>>(rebased)); 
+            DoNotOptimize(rebased.front());
+        });
+
+        //Translation by -origin times the transform, only the columns' w terms are counted
+        const Matrix4<T> translation = Matrix4<T>::CreateTranslation(-origin);
+        runner.Run("RebaseTransforms", TypeName<T>(), "scalar", 24, [&]()
+        {
+            for(std::size_t i = 0; i < m4.size(); ++i)
+            {
+                Matrix4<T> rebasedTransform = translation * m4[i];
+                for(int32_t k = 0; k < Matrix4<T>::Size; ++k)
+                    rebasedTransforms[i].arr[k] = static_cast<float>(rebasedTransform.arr[k]);
+            }
+            DoNotOptimize(rebasedTransforms.front());
+        });
+        RunBatched<T>(runner, "RebaseTransforms", 24, [&]() 
+        { 
+            RebaseTransforms(std::span<const Matrix4<T>>(m4), origin, std::span<Matrix4<float>>(rebasedTransforms)); 
+            DoNotOptimize(rebasedTransforms.front());
+        });
+    }
+}
+
+template void RunOperationsBenchmarks<float>(Runner& runner);
+template void RunOperationsBenchmarks<double>(Runner& runner);
+
+} //namespace bench
@@ -0,0 +1,57 @@
+#include "Benchmark.hpp"
+#include <engine/math/quat/Quaternion.hpp>
+#include <engine/math/matrix/Matrix4.hpp>
+
+namespace bench
+{
+
+//Sine, cosine and arc cosine are not counted in the flops
+template<typename T>
+void RunQuaternionBenchmarks(Runner& runner)
+{
+    using namespace math;
+    using Q = Quaternion<T>;
+
+    std::vector<Q> a = RandomData<Q>(runner.Elements(), 21);
+    std::vector<Q> b = RandomData<Q>(runner.Elements(), 22);
+    std::vector<Vector3<T>> axes = RandomData<Vector3<T>>(runner.Elements(), 23);
+    for(std::size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = a[i].GetNormalized();
+        b[i] = b[i].GetNormalized();
+    }
+
+    T s = static_cast<T>(0.5);
+
+    RunScalar(runner, "Quaternion::operator+",     4,  a, b, [](const Q& l, const Q& r) { return l + r; });
+    RunScalar(runner, "Quaternion::operator+=",    4,  a, b, [](Q l, const Q& r) { return l += r; });
+    RunScalar(runner, "Quaternion::operator-",     4,  a, b, [](const Q& l, const Q& r) { return l - r; });
+    RunScalar(runner, "Quaternion::operator-=",    4,  a, b, [](Q l, const Q& r) { return l -= r; });
+    RunScalar(runner, "Quaternion::operator*(T)",  4,  a, [s](const Q& q) { return q * s; });
+    RunScalar(runner, "Quaternion::operator*=(T)", 4,  a, [s](Q q) { return q *= s; });
+    RunScalar(runner, "Quaternion::operator/(T)",  5,  a, [s](const Q& q) { return q / s; });
+    RunScalar(runner, "Quaternion::operator/=(T)", 5,  a, [s](Q q) { return q /= s; });
+    //16 multiplications and 12 additions
+    RunScalar(runner, "Quaternion::operator*",     28, a, b, [](const Q& l, const Q& r) { return l * r; });
+    RunScalar(runner, "Quaternion::operator*=",    28, a, b, [](Q l, const Q& r) { return l *= r; });
+
+    RunScalar(runner, "Quaternion::Dot",               7,  a, b, [](const Q& l, const Q& r) { return Q(l.Dot(r), 0, 0, 0); });
+    RunScalar(runner, "Quaternion::Length",            8,  a, [](const Q& q) { return Q(q.Length(), 0, 0, 0); });
+    RunScalar(runner, "Quaternion::LengthSquared",     7,  a, [](const Q& q) { return Q(q.LengthSquared(), 0, 0, 0); });
+    RunScalar(runner, "Quaternion::GetNormalized",     13, a, [](const Q& q) { return q.GetNormalized(); });
+    RunScalar(runner, "Quaternion::GetSafeNormalized", 13, a, [](const Q& q) { return q.GetSafeNormalized(); });
+    RunScalar(runner, "Quaternion::GetFastNormalized", 13, a, [](const Q& q) { return q.GetFastNormalized(); });
+    RunScalar(runner, "Quaternion::GetConjugated",     0,  a, [](const Q& q) { return q.GetConjugated(); });
+    RunScalar(runner, "Quaternion::GetInverse",        12, a, [](const Q& q) { return q.GetInverse(); });
+    RunScalar(runner, "Quaternion::ToMatrix4",         30, a, [](const Q& q) { return q.ToMatrix4(); });
+    RunScalar(runner, "Quaternion::FromAxis",          4,  axes, [](const Vector3<T>& v) { return Q::FromAxis(v, v.x); });
+
+    RunScalar(runner, "Quaternion::Nlerp",     34, a, b, [s](const Q& l, const Q& r) { return Q::Nlerp(l, r, s); });
+    RunScalar(runner, "Quaternion::Slerp",     40, a, b, [s](const Q& l, const Q& r) { return Q::Slerp(l, r, s); });
+    RunScalar(runner, "Quaternion::FastSlerp", 45, a, b, [s](const Q& l, const Q& r) { return Q::FastSlerp(l, r, s); });
+}
+
+template void RunQuaternionBenchmarks<float>(Runner& runner);
+template void RunQuaternionBenchmarks<double>(Runner& runner);
+
+} //namespace bench
@@ -0,0 +1,83 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <engine/math/spatial/Morton.hpp>
+#include <engine/scene/BoundingVolumeHierarchy.hpp>
+#include <engine/scene/SpatialSort.hpp>
+
+namespace bench
+{
+
+//Whole structures are built over a fixed number of elements, independent of
+//-n, and reported per element. The threaded runs use every hardware thread
+constexpr std::size_t SceneElements = std::size_t{1} << 20;
+
+void RunSceneBenchmarks(Runner& runner)
+{
+    using namespace math;
+
+    //! Spatial sort of points spread over a cube, against sorting key and
+    //index pairs with std::sort. Flops are the Morton encoding only
+    {
+        std::vector<Vec3> positions = RandomData<Vec3>(SceneElements, 51);
+        const AABB3 bounds(Vec3(-1), Vec3(1));
+
+        std::vector<uint32_t> keys(SceneElements);
+        std::vector<uint64_t> pairs(SceneElements);
+        runner.Run("SpatialSort::Sort", "float", "scalar", 40, SceneElements, [&]()
+        {
+            EncodeMorton(std::span<const Vec3>(positions), bounds, std::span<uint32_t>(keys));
+            for(std::size_t i = 0; i < keys.size(); ++i)
+                pairs[i] = static_cast<uint64_t>(keys[i]) << 32 | i;
+            std::sort(pairs.begin(), pairs.end());
+            DoNotOptimize(pairs.front());
+        });
+
+        scene::SpatialSort sort(1);
+        runner.Run("SpatialSort::Sort", "float", "batched", 40, SceneElements, [&]()
+        {
+            sort.Sort(std::span<const Vec3>(positions), bounds);
+            uint32_t first = sort.GetOrder().front();
+            DoNotOptimize(first);
+        });
+
+        scene::SpatialSort threadedSort(0);
+        runner.Run("SpatialSort::Sort", "float", "threaded", 40, SceneElements, [&]()
+        {
+            threadedSort.Sort(std::span<const Vec3>(positions), bounds);
+            uint32_t first = threadedSort.GetOrder().front();
+            DoNotOptimize(first);
+        });
+    }
+
+    //! Surface area heuristic build over small triangles spread over a cube,
+    //with one thread and with every thread. No nominal flop count
+    {
+        std::vector<Vec3> centers = RandomData<Vec3>(SceneElements, 52);
+        std::vector<Vec3> offsets = RandomData<Vec3>(SceneElements * 3, 53);
+        std::vector<Triangle3> triangles(SceneElements);
+
+        for(std::size_t i = 0; i < SceneElements; ++i)
+        {
+            Vec3 center  = centers[i] * 100.0f;
+            triangles[i] = Triangle3(center + offsets[i * 3], center + offsets[i * 3 + 1], center + offsets[i * 3 + 2]);
+        }
+
+        scene::BoundingVolumeHierarchy bvh(1);
+        runner.Run("BoundingVolumeHierarchy::Build", "float", "batched", 0, SceneElements, [&]()
+        {
+            bvh.Build(std::span<const Triangle3>(triangles));
+            AABB3 bounds = bvh.GetBounds();
+            DoNotOptimize(bounds);
+        });
+
+        scene::BoundingVolumeHierarchy threadedBvh(0);
+        runner.Run("BoundingVolumeHierarchy::Build", "float", "threaded", 0, SceneElements, [&]()
+        {
+            threadedBvh.Build(std::span<const Triangle3>(triangles));
+            AABB3 bounds = threadedBvh.GetBounds();
+            DoNotOptimize(bounds);
+        });
+    }
+}
+
+} //namespace bench
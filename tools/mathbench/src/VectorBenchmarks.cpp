@@ -0,0 +1,81 @@
+#include "Benchmark.hpp"
+#include <engine/math/vector/Vector2.hpp>
+#include <engine/math/vector/Vector3.hpp>
+#include <engine/math/vector/Vector4.hpp>
+#include <engine/math/expr/Expression.hpp>
+
+namespace bench
+{
+
+//Operations shared by Vector2, Vector3 and Vector4
+template<typename V>
+static void RunCommonVectorBenchmarks(Runner& runner, const std::string& prefix)
+{
+    using T = typename V::Type;
+    constexpr double n = V::Size;
+
+    std::vector<V> a = RandomData<V>(runner.Elements(), 1);
+    std::vector<V> b = RandomData<V>(runner.Elements(), 2);
+    T s = static_cast<T>(0.5);
+
+    RunScalar(runner, prefix + "::operator+",     n, a, b, [](const V& l, const V& r) { return l + r; });
+    RunScalar(runner, prefix + "::operator+=",    n, a, b, [](V l, const V& r) { return l += r; });
+    RunScalar(runner, prefix + "::operator-",     n, a, b, [](const V& l, const V& r) { return l - r; });
+    RunScalar(runner, prefix + "::operator-=",    n, a, b, [](V l, const V& r) { return l -= r; });
+    RunScalar(runner, prefix + "::operator*",     n, a, b, [](const V& l, const V& r) { return l * r; });
+    RunScalar(runner, prefix + "::operator*=",    n, a, b, [](V l, const V& r) { return l *= r; });
+    RunScalar(runner, prefix + "::operator/",     n, a, b, [](const V& l, const V& r) { return l / r; });
+    RunScalar(runner, prefix + "::operator/=",    n, a, b, [](V l, const V& r) { return l /= r; });
+    RunScalar(runner, prefix + "::operator*(T)",  n, a, [s](const V& v) { return v * s; });
+    RunScalar(runner, prefix + "::operator*=(T)", n, a, [s](V v) { return v *= s; });
+    RunScalar(runner, prefix + "::operator/(T)",  n + 1, a, [s](const V& v) { return v / s; });
+    RunScalar(runner, prefix + "::operator/=(T)", n + 1, a, [s](V v) { return v /= s; });
+
+    if constexpr (requires(V v) { -v; })
+        RunScalar(runner, prefix + "::operator-()", n, a, [](const V& v) { return -v; });
+
+    //Scalar results are wrapped in a vector so the output buffer has a math type
+    RunScalar(runner, prefix + "::Dot",           2 * n - 1, a, b, [](const V& l, const V& r) { return V(l.Dot(r)); });
+    RunScalar(runner, prefix + "::Length",        2 * n, a, [](const V& v) { return V(v.Length()); });
+    RunScalar(runner, prefix + "::LengthSquared", 2 * n - 1, a, [](const V& v) { return V(v.LengthSquared()); });
+
+    //Dot, sqrt, reciprocal and one multiplication per component
+    RunScalar(runner, prefix + "::GetNormalized",     3 * n + 1, a, [](const V& v) { return v.GetNormalized(); });
+    RunScalar(runner, prefix + "::GetSafeNormalized", 3 * n + 1, a, [](const V& v) { return v.GetSafeNormalized(); });
+    RunScalar(runner, prefix + "::GetFastNormalized", 3 * n + 1, a, [](const V& v) { return v.GetFastNormalized(); });
+
+    if constexpr (requires(V v) { v.GetReflected(v); })
+        RunScalar(runner, prefix + "::GetReflected", 4 * n, a, b, [](const V& v, const V& r) { return v.GetReflected(r); });
+
+    //Chained operators, one temporary per operator against a single fused pass
+    RunScalar(runner, prefix + "::a+b*s-a",       3 * n, a, b, [s](const V& l, const V& r) { return l + r * s - l; });
+    RunScalar(runner, prefix + "::Lazy(a+b*s-a)", 3 * n, a, b, [s](const V& l, const V& r) { return V(math::expr::Lazy(l) + math::expr::Lazy(r) * s - l); });
+}
+
+template<typename T>
+void RunVectorBenchmarks(Runner& runner)
+{
+    using namespace math;
+
+    RunCommonVectorBenchmarks<Vector2<T>>(runner, "Vector2");
+    RunCommonVectorBenchmarks<Vector3<T>>(runner, "Vector3");
+    RunCommonVectorBenchmarks<Vector4<T>>(runner, "Vector4");
+
+    std::vector<Vector2<T>> a2 = RandomData<Vector2<T>>(runner.Elements(), 3);
+    std::vector<Vector2<T>> b2 = RandomData<Vector2<T>>(runner.Elements(), 4);
+    std::vector<Vector3<T>> a3 = RandomData<Vector3<T>>(runner.Elements(), 5);
+    std::vector<Vector3<T>> b3 = RandomData<Vector3<T>>(runner.Elements(), 6);
+
+    RunScalar(runner, "Vector2::Cross2D", 3, a2, b2, 
+        [](const Vector2<T>& l, const Vector2<T>& r) { return Vector2<T>(l.Cross2D(r)); });
+    //Sine and cosine are not counted
+    RunScalar(runner, "Vector2::GetRotated", 6, a2, 
+        [](const Vector2<T>& v) { return v.GetRotated(static_cast<T>(0.5)); });
+    RunScalar(runner, "Vector3::Cross", 9, a3, b3, 
+        [](const Vector3<T>& l, const Vector3<T>& r) { return l.Cross(r); });
+}
+
+template void RunVectorBenchmarks<float>(Runner& runner);
+template void RunVectorBenchmarks<double>(Runner& runner);
+
+} //namespace bench
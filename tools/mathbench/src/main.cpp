@@ -0,0 +1,99 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <engine/math/simd/Simd.hpp>
+#include "Benchmark.hpp"
+
+//Usage: math_bench [-o output.json] [-f name filter] [-n elements] [-t sample milliseconds]
+//Results are written as JSON to the output file or to stdout, the exit code is
+//1 when a validation fails
+int main(int argc, char* argv[])
+{
+    std::string output {};
+    std::string filter {};
+    std::size_t elements {1024};
+    int64_t sampleMs {20};
+
+    try
+    {
+        for(int i = 1; i < argc; i += 2)
+        {
+            std::string option = argv[i];
+
+            if(i + 1 == argc)
+                throw std::runtime_error("Option \"" + option + "\" needs a value");
+
+            if(option == "-o")
+                output = argv[i + 1];
+            else if(option == "-f")
+                filter = argv[i + 1];
+            else if(option == "-n")
+                elements = std::stoull(argv[i + 1]);
+            else if(option == "-t")
+                sampleMs = std::stoll(argv[i + 1]);
+            else
+                throw std::runtime_error("Unknown option \"" + option + "\"");
+        }
+
+        if(elements == 0)
+            throw std::runtime_error("The element count must be greater than 0");
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "[ERROR]: " << e.what() << '\n';
+        return 1;
+    }
+
+    bench::Runner runner(elements, std::chrono::milliseconds(sampleMs), filter);
+
+    bench::RunVectorBenchmarks<float>(runner);
+    bench::RunVectorBenchmarks<double>(runner);
+    bench::RunMatrixBenchmarks<float>(runner);
+    bench::RunMatrixBenchmarks<double>(runner);
+    bench::RunQuaternionBenchmarks<float>(runner);
+    bench::RunQuaternionBenchmarks<double>(runner);
+    bench::RunOperationsBenchmarks<float>(runner);
+    bench::RunOperationsBenchmarks<double>(runner);
+    bench::RunGeometryBenchmarks<float>(runner);
+    bench::RunGeometryBenchmarks<double>(runner);
+    bench::RunSceneBenchmarks(runner);
+
+#if MATH_SIMD_AVX2
+    const char* simd = "avx2";
+#elif MATH_SIMD_SSE
+    const char* simd = "sse";
+#else
+    const char* simd = "none";
+#endif
+
+    nlohmann::json report = {
+        {"simd",       simd},
+        {"elements",   elements},
+        {"results",    runner.ToJson()},
+        {"validation", runner.ValidationsToJson()}
+    };
+
+    if(output.empty())
+    {
+        std::cout << report.dump(4) << '\n';
+    }
+    else
+    {
+        std::ofstream file(output);
+        if(!file)
+        {
+            std::cerr << "[ERROR]: Could not open \"" << output << "\"\n";
+            return 1;
+        }
+
+        file << report.dump(4) << '\n';
+    }
+
+    if(!runner.Passed())
+    {
+        std::cerr << "[ERROR]: Validation failed, see \"validation\" in the report\n";
+        return 1;
+    }
+}